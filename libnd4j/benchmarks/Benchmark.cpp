@@ -0,0 +1,448 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+
+#include "Benchmark.h"
+#include <helpers/logger.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <omp.h>
+
+namespace nd4j {
+    namespace benchmark {
+        // at least this number of measured iterations is done, unless maxIterations is smaller
+        static const Nd4jLong MIN_MEASURED_ITERATIONS = 3;
+
+        BenchmarkState::BenchmarkState(const std::vector<Nd4jLong> &args, Nd4jLong warmup, Nd4jLong maxIterations, Nd4jLong minTimeNanos) {
+            _args = args;
+            _warmup = warmup;
+            _maxIterations = maxIterations;
+            _minTime = minTimeNanos;
+        }
+
+        bool BenchmarkState::keepRunning() {
+            auto now = std::chrono::steady_clock::now();
+
+            if (_iteration >= 0) {
+                if (!_paused)
+                    _elapsed += (Nd4jLong) std::chrono::duration_cast<std::chrono::nanoseconds>(now - _start).count();
+
+                if (_iteration >= _warmup)
+                    _times.emplace_back(_elapsed);
+            }
+
+            _iteration++;
+            _elapsed = 0;
+            _paused = false;
+
+            if (!_skipped.empty())
+                return false;
+
+            auto measured = static_cast<Nd4jLong>(_times.size());
+            if (measured >= _maxIterations)
+                return false;
+
+            if (measured >= MIN_MEASURED_ITERATIONS) {
+                Nd4jLong total = 0;
+                for (auto t: _times)
+                    total += t;
+
+                if (total >= _minTime)
+                    return false;
+            }
+
+            _start = std::chrono::steady_clock::now();
+            return true;
+        }
+
+        void BenchmarkState::pauseTiming() {
+            if (_paused)
+                return;
+
+            _elapsed += (Nd4jLong) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _start).count();
+            _paused = true;
+        }
+
+        void BenchmarkState::resumeTiming() {
+            if (!_paused)
+                return;
+
+            _paused = false;
+            _start = std::chrono::steady_clock::now();
+        }
+
+        Nd4jLong BenchmarkState::range(int index) const {
+            if (index < 0 || index >= (int) _args.size())
+                throw std::runtime_error("Benchmark argument index is out of range");
+
+            return _args[index];
+        }
+
+        void BenchmarkState::setBytesProcessed(Nd4jLong bytes) {
+            _bytes = bytes;
+        }
+
+        void BenchmarkState::setItemsProcessed(Nd4jLong items) {
+            _items = items;
+        }
+
+        void BenchmarkState::setLabel(const std::string &label) {
+            _label = label;
+        }
+
+        void BenchmarkState::skip(const std::string &reason) {
+            _skipped = reason;
+        }
+
+        const std::vector<Nd4jLong>& BenchmarkState::times() const {
+            return _times;
+        }
+
+        Nd4jLong BenchmarkState::bytesProcessed() const {
+            return _bytes;
+        }
+
+        Nd4jLong BenchmarkState::itemsProcessed() const {
+            return _items;
+        }
+
+        const std::string& BenchmarkState::label() const {
+            return _label;
+        }
+
+        const std::string& BenchmarkState::skipped() const {
+            return _skipped;
+        }
+
+////////////////////////////////////////////////////////////////////////
+        Benchmark::Benchmark(const char *name, BenchmarkFunction function) {
+            _name = name;
+            _function = function;
+        }
+
+        Benchmark* Benchmark::args(const std::vector<Nd4jLong> &args) {
+            _args.emplace_back(args);
+            return this;
+        }
+
+        Benchmark* Benchmark::ranges(const std::vector<std::vector<Nd4jLong>> &ranges) {
+            std::vector<std::vector<Nd4jLong>> product(1);
+            for (auto &range: ranges) {
+                std::vector<std::vector<Nd4jLong>> next;
+                for (auto &prefix: product)
+                    for (auto v: range) {
+                        auto tmp = prefix;
+                        tmp.emplace_back(v);
+                        next.emplace_back(tmp);
+                    }
+
+                product = next;
+            }
+
+            for (auto &a: product)
+                _args.emplace_back(a);
+
+            return this;
+        }
+
+        const std::string& Benchmark::name() const {
+            return _name;
+        }
+
+        const std::vector<std::vector<Nd4jLong>>& Benchmark::arguments() const {
+            return _args;
+        }
+
+        BenchmarkFunction& Benchmark::function() {
+            return _function;
+        }
+
+////////////////////////////////////////////////////////////////////////
+        BenchmarkRegistry::~BenchmarkRegistry() {
+            for (auto v: _benchmarks)
+                delete v;
+        }
+
+        BenchmarkRegistry* BenchmarkRegistry::getInstance() {
+            static BenchmarkRegistry registry;
+            return &registry;
+        }
+
+        Benchmark* BenchmarkRegistry::add(const char *name, BenchmarkFunction function) {
+            auto benchmark = new Benchmark(name, function);
+            _benchmarks.emplace_back(benchmark);
+            return benchmark;
+        }
+
+        const std::vector<Benchmark*>& BenchmarkRegistry::benchmarks() const {
+            return _benchmarks;
+        }
+
+////////////////////////////////////////////////////////////////////////
+        static std::string fullName(Benchmark *benchmark, const std::vector<Nd4jLong> &args) {
+            std::string name = benchmark->name();
+            for (auto v: args)
+                name += "/" + std::to_string(v);
+
+            return name;
+        }
+
+        BenchmarkResult BenchmarkRunner::run(Benchmark *benchmark, const std::vector<Nd4jLong> &args, const BenchmarkOptions &options) {
+            BenchmarkState state(args, options.warmup, options.maxIterations, options.minTime);
+
+            BenchmarkResult result;
+            result.name = fullName(benchmark, args);
+
+            try {
+                benchmark->function()(state);
+            } catch (std::exception &e) {
+                state.skip(e.what());
+            }
+
+            result.label = state.label();
+            result.skipped = state.skipped();
+
+            auto times = state.times();
+            result.iterations = static_cast<Nd4jLong>(times.size());
+            if (times.empty()) {
+                if (result.skipped.empty())
+                    result.skipped = "no iterations were measured";
+
+                return result;
+            }
+
+            std::sort(times.begin(), times.end());
+            auto n = times.size();
+
+            double sum = 0.0;
+            for (auto t: times)
+                sum += (double) t;
+
+            result.minTime = (double) times[0];
+            result.medianTime = n % 2 == 1 ? (double) times[n / 2] : ((double) times[n / 2 - 1] + (double) times[n / 2]) / 2.0;
+            result.meanTime = sum / (double) n;
+
+            double var = 0.0;
+            for (auto t: times)
+                var += ((double) t - result.meanTime) * ((double) t - result.meanTime);
+
+            result.stdDev = n > 1 ? std::sqrt(var / (double) (n - 1)) : 0.0;
+
+            // throughput is based on median, it's less sensitive to outliers
+            if (result.medianTime > 0.0) {
+                result.bytesPerSecond = (double) state.bytesProcessed() * 1e9 / result.medianTime;
+                result.itemsPerSecond = (double) state.itemsProcessed() * 1e9 / result.medianTime;
+            }
+
+            return result;
+        }
+
+        static std::string escape(const std::string &value) {
+            std::string result;
+            for (auto c: value) {
+                if (c == '"' || c == '\\')
+                    result += '\\';
+
+                result += c < 0x20 ? ' ' : c;
+            }
+
+            return result;
+        }
+
+        std::string BenchmarkRunner::asJson(const std::vector<BenchmarkResult> &results) {
+            std::ostringstream stream;
+            stream.precision(15);
+
+            char date[64];
+            auto now = std::time(nullptr);
+            std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+            stream << "{\n\"context\": {\"date\": \"" << date << "\", \"threads\": " << omp_get_max_threads() << ", \"dtype\": \"float\"},\n";
+            stream << "\"benchmarks\": [\n";
+
+            // one benchmark per line, so results are easy to diff and to parse back
+            for (size_t e = 0; e < results.size(); e++) {
+                auto &r = results[e];
+                stream << "{\"name\": \"" << escape(r.name) << "\", \"label\": \"" << escape(r.label) << "\"";
+
+                if (!r.skipped.empty())
+                    stream << ", \"skipped\": \"" << escape(r.skipped) << "\"";
+
+                stream << ", \"iterations\": " << r.iterations << ", \"min_ns\": " << r.minTime << ", \"median_ns\": " << r.medianTime
+                       << ", \"mean_ns\": " << r.meanTime << ", \"stddev_ns\": " << r.stdDev << ", \"bytes_per_second\": " << r.bytesPerSecond
+                       << ", \"items_per_second\": " << r.itemsPerSecond << "}" << (e + 1 < results.size() ? "," : "") << "\n";
+            }
+
+            stream << "]\n}\n";
+            return stream.str();
+        }
+
+        static bool readValue(const std::string &line, const char *key, std::string &value) {
+            std::string k = std::string("\"") + key + "\": ";
+            auto pos = line.find(k);
+            if (pos == std::string::npos)
+                return false;
+
+            pos += k.length();
+            if (line[pos] == '"') {
+                auto end = line.find('"', pos + 1);
+                value = line.substr(pos + 1, end - pos - 1);
+            } else {
+                auto end = line.find_first_of(",}", pos);
+                value = line.substr(pos, end - pos);
+            }
+
+            return true;
+        }
+
+        int BenchmarkRunner::compare(const std::vector<BenchmarkResult> &results, const std::string &baselineJson, double threshold) {
+            std::map<std::string, double> baseline;
+            std::istringstream stream(baselineJson);
+            std::string line;
+            while (std::getline(stream, line)) {
+                std::string name, median;
+                if (readValue(line, "name", name) && readValue(line, "median_ns", median) && line.find("\"skipped\"") == std::string::npos)
+                    baseline[name] = std::stod(median);
+            }
+
+            int regressions = 0;
+            nd4j_printf("\n%-60s %14s %14s %9s\n", "Comparison", "baseline, ns", "current, ns", "delta");
+            for (auto &r: results) {
+                if (!r.skipped.empty() || baseline.count(r.name) == 0 || baseline[r.name] <= 0.0)
+                    continue;
+
+                auto delta = r.medianTime / baseline[r.name] - 1.0;
+                bool regression = delta > threshold;
+                if (regression)
+                    regressions++;
+
+                nd4j_printf("%-60s %14.0f %14.0f %+8.1f%%%s\n", r.name.c_str(), baseline[r.name], r.medianTime, delta * 100.0, regression ? "  REGRESSION" : "");
+            }
+
+            return regressions;
+        }
+
+        static bool readOption(const char *arg, const char *key, std::string &value) {
+            auto length = strlen(key);
+            if (strncmp(arg, key, length) != 0 || arg[length] != '=')
+                return false;
+
+            value = arg + length + 1;
+            return true;
+        }
+
+        int BenchmarkRunner::main(int argc, char **argv) {
+            BenchmarkOptions options;
+            bool listOnly = false;
+
+            for (int e = 1; e < argc; e++) {
+                std::string value;
+                if (readOption(argv[e], "--filter", value))
+                    options.filter = value;
+                else if (readOption(argv[e], "--json", value))
+                    options.jsonOutput = value;
+                else if (readOption(argv[e], "--baseline", value))
+                    options.baseline = value;
+                else if (readOption(argv[e], "--threshold", value))
+                    options.threshold = std::stod(value);
+                else if (readOption(argv[e], "--warmup", value))
+                    options.warmup = std::stoll(value);
+                else if (readOption(argv[e], "--max_iterations", value))
+                    options.maxIterations = std::stoll(value);
+                else if (readOption(argv[e], "--min_time_ms", value))
+                    options.minTime = std::stoll(value) * 1000000L;
+                else if (strcmp(argv[e], "--list") == 0)
+                    listOnly = true;
+                else {
+                    nd4j_printf("Usage: %s [--list] [--filter=substring] [--json=results.json] [--baseline=old.json] [--threshold=0.10] [--warmup=N] [--max_iterations=N] [--min_time_ms=N]\n", argv[0]);
+                    return strcmp(argv[e], "--help") == 0 ? 0 : 1;
+                }
+            }
+
+            std::vector<BenchmarkResult> results;
+            if (!listOnly)
+                nd4j_printf("%-60s %12s %14s %14s %12s %10s\n", "Benchmark", "iterations", "median, ns", "min, ns", "stddev, %", "GB/s");
+
+            for (auto benchmark: BenchmarkRegistry::getInstance()->benchmarks()) {
+                auto arguments = benchmark->arguments();
+                if (arguments.empty())
+                    arguments.emplace_back(std::vector<Nd4jLong>());
+
+                for (auto &args: arguments) {
+                    auto name = fullName(benchmark, args);
+                    if (!options.filter.empty() && name.find(options.filter) == std::string::npos)
+                        continue;
+
+                    if (listOnly) {
+                        nd4j_printf("%s\n", name.c_str());
+                        continue;
+                    }
+
+                    auto result = run(benchmark, args, options);
+                    if (!result.skipped.empty()) {
+                        nd4j_printf("%-60s skipped: %s\n", name.c_str(), result.skipped.c_str());
+                    } else {
+                        nd4j_printf("%-60s %12lld %14.0f %14.0f %12.1f %10.2f %s\n", name.c_str(), (long long) result.iterations, result.medianTime, result.minTime,
+                                    result.meanTime > 0.0 ? result.stdDev * 100.0 / result.meanTime : 0.0, result.bytesPerSecond / 1e9, result.label.c_str());
+                    }
+
+                    results.emplace_back(result);
+                }
+            }
+
+            if (listOnly)
+                return 0;
+
+            if (!options.jsonOutput.empty()) {
+                std::ofstream file(options.jsonOutput, std::ios::out | std::ios::trunc);
+                if (!file.is_open()) {
+                    nd4j_printf("Can't open file for writing: [%s]\n", options.jsonOutput.c_str());
+                    return 1;
+                }
+
+                file << asJson(results);
+            }
+
+            if (!options.baseline.empty()) {
+                std::ifstream file(options.baseline);
+                if (!file.is_open()) {
+                    nd4j_printf("Can't open baseline file: [%s]\n", options.baseline.c_str());
+                    return 1;
+                }
+
+                std::stringstream content;
+                content << file.rdbuf();
+
+                auto regressions = compare(results, content.str(), options.threshold);
+                if (regressions > 0) {
+                    nd4j_printf("%i benchmarks regressed by more than %.1f%%\n", regressions, options.threshold * 100.0);
+                    return 2;
+                }
+            }
+
+            return 0;
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    return nd4j::benchmark::BenchmarkRunner::main(argc, argv);
+}
@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Minimal benchmark harness in spirit of Google Benchmark:
+//
+//      static void matmul(BenchmarkState &state) {
+//          NDArray<float> a('c', {state.range(0), state.range(0)});
+//          ...
+//          while (state.keepRunning())
+//              MmulHelper<float>::mmul(&a, &b, &c, 1.0f, 0.0f);
+//      }
+//      ND4J_BENCHMARK(matmul)->args({256})->args({1024});
+//
+// Results are printed as table, and optionally written as JSON, which can be compared against baseline of other commit.
+//
+
+#ifndef LIBND4J_BENCHMARK_H
+#define LIBND4J_BENCHMARK_H
+
+#include <pointercast.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <functional>
+
+namespace nd4j {
+    namespace benchmark {
+        class BenchmarkState {
+        private:
+            std::vector<Nd4jLong> _args;
+
+            Nd4jLong _warmup;
+            Nd4jLong _maxIterations;
+            Nd4jLong _minTime;
+
+            Nd4jLong _iteration = -1;
+            Nd4jLong _elapsed = 0;
+            bool _paused = false;
+            std::chrono::time_point<std::chrono::steady_clock> _start;
+            std::vector<Nd4jLong> _times;
+
+            Nd4jLong _bytes = 0;
+            Nd4jLong _items = 0;
+            std::string _label;
+            std::string _skipped;
+
+        public:
+            BenchmarkState(const std::vector<Nd4jLong> &args, Nd4jLong warmup, Nd4jLong maxIterations, Nd4jLong minTimeNanos);
+
+            /**
+             * This method closes timing of previous iteration, and returns true if one more iteration should be done.
+             * First warmup iterations aren't measured.
+             */
+            bool keepRunning();
+
+            /**
+             * These methods exclude setup done inside of timing loop from measurements
+             */
+            void pauseTiming();
+            void resumeTiming();
+
+            Nd4jLong range(int index) const;
+
+            /**
+             * These methods set amounts processed by single iteration, used for throughput reporting
+             */
+            void setBytesProcessed(Nd4jLong bytes);
+            void setItemsProcessed(Nd4jLong items);
+
+            void setLabel(const std::string &label);
+
+            /**
+             * This method marks benchmark as skipped, i.e. if resource isn't available
+             */
+            void skip(const std::string &reason);
+
+            const std::vector<Nd4jLong>& times() const;
+            Nd4jLong bytesProcessed() const;
+            Nd4jLong itemsProcessed() const;
+            const std::string& label() const;
+            const std::string& skipped() const;
+        };
+
+        typedef std::function<void(BenchmarkState&)> BenchmarkFunction;
+
+        class Benchmark {
+        private:
+            std::string _name;
+            BenchmarkFunction _function;
+            std::vector<std::vector<Nd4jLong>> _args;
+
+        public:
+            Benchmark(const char *name, BenchmarkFunction function);
+
+            Benchmark* args(const std::vector<Nd4jLong> &args);
+
+            /**
+             * This method adds cartesian product of given argument values
+             */
+            Benchmark* ranges(const std::vector<std::vector<Nd4jLong>> &ranges);
+
+            const std::string& name() const;
+            const std::vector<std::vector<Nd4jLong>>& arguments() const;
+            BenchmarkFunction& function();
+        };
+
+        struct BenchmarkResult {
+            std::string name;
+            std::string label;
+            std::string skipped;
+            Nd4jLong iterations = 0;
+            double minTime = 0.0;
+            double medianTime = 0.0;
+            double meanTime = 0.0;
+            double stdDev = 0.0;
+            double bytesPerSecond = 0.0;
+            double itemsPerSecond = 0.0;
+        };
+
+        class BenchmarkRegistry {
+        private:
+            std::vector<Benchmark*> _benchmarks;
+
+            BenchmarkRegistry() = default;
+            ~BenchmarkRegistry();
+
+        public:
+            static BenchmarkRegistry* getInstance();
+
+            Benchmark* add(const char *name, BenchmarkFunction function);
+
+            const std::vector<Benchmark*>& benchmarks() const;
+        };
+
+        struct BenchmarkOptions {
+            std::string filter;
+            std::string jsonOutput;
+            std::string baseline;
+            // relative slowdown of median time treated as regression
+            double threshold = 0.10;
+            Nd4jLong warmup = 2;
+            Nd4jLong maxIterations = 1000;
+            Nd4jLong minTime = 500000000L;
+        };
+
+        class BenchmarkRunner {
+        public:
+            static BenchmarkResult run(Benchmark *benchmark, const std::vector<Nd4jLong> &args, const BenchmarkOptions &options);
+
+            static std::string asJson(const std::vector<BenchmarkResult> &results);
+
+            /**
+             * This method compares median times against baseline JSON produced earlier, and returns number of regressions
+             */
+            static int compare(const std::vector<BenchmarkResult> &results, const std::string &baselineJson, double threshold);
+
+            static int main(int argc, char **argv);
+        };
+    }
+}
+
+#define ND4J_BENCHMARK_CONCAT_(A, B) A ## B
+#define ND4J_BENCHMARK_CONCAT(A, B) ND4J_BENCHMARK_CONCAT_(A, B)
+
+#define ND4J_BENCHMARK(FUNCTION) static nd4j::benchmark::Benchmark* ND4J_BENCHMARK_CONCAT(_benchmark_, __LINE__) = nd4j::benchmark::BenchmarkRegistry::getInstance()->add(#FUNCTION, FUNCTION)
+
+#endif //LIBND4J_BENCHMARK_H
@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// End-to-end FlatGraph execution benchmarks, graphs are taken from test resources
+//
+
+#include "Benchmark.h"
+#include <GraphExecutioner.h>
+#include <graph/FlowPath.h>
+#include <fstream>
+#include <stdexcept>
+
+using namespace nd4j;
+using namespace nd4j::graph;
+using namespace nd4j::benchmark;
+
+#ifndef BENCHMARK_RESOURCES
+#define BENCHMARK_RESOURCES "./resources"
+#endif
+
+static void executeGraph(BenchmarkState &state, const char *fileName) {
+    auto env = std::getenv("ND4J_BENCHMARK_RESOURCES");
+    std::string path = std::string(env != nullptr ? env : BENCHMARK_RESOURCES) + "/" + fileName;
+
+    state.setLabel(fileName);
+
+    if (!std::ifstream(path).good()) {
+        state.skip("can't find " + path);
+        state.keepRunning();
+        return;
+    }
+
+    auto graph = GraphExecutioner<float>::importFromFlatBuffers(path.c_str());
+
+    // every run starts from the same state, like GraphProfilingHelper does
+    auto variableSpace = graph->getVariableSpace()->clone();
+
+    while (state.keepRunning()) {
+        state.pauseTiming();
+        FlowPath flowPath;
+        auto runSpace = variableSpace->clone();
+        runSpace->setFlowPath(&flowPath);
+        state.resumeTiming();
+
+        auto status = GraphExecutioner<float>::execute(graph, runSpace);
+
+        state.pauseTiming();
+        delete runSpace;
+        state.resumeTiming();
+
+        if (status != ND4J_STATUS_OK) {
+            delete variableSpace;
+            delete graph;
+            throw std::runtime_error("graph execution failed");
+        }
+    }
+
+    delete variableSpace;
+    delete graph;
+}
+
+static void graph_ae_00(BenchmarkState &state) {
+    executeGraph(state, "ae_00.fb");
+}
+ND4J_BENCHMARK(graph_ae_00);
+
+static void graph_conv_0(BenchmarkState &state) {
+    executeGraph(state, "conv_0.fb");
+}
+ND4J_BENCHMARK(graph_conv_0);
+
+static void graph_mnist_00(BenchmarkState &state) {
+    executeGraph(state, "mnist_00.fb");
+}
+ND4J_BENCHMARK(graph_mnist_00);
+
+static void graph_gru_dynamic_mnist(BenchmarkState &state) {
+    executeGraph(state, "gru_dynamic_mnist.fb");
+}
+ND4J_BENCHMARK(graph_gru_dynamic_mnist);
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Benchmarks of legacy op loops: transform, scalar, pairwise, broadcast, reduce, reduce3 and index reduce,
+// over different sizes and memory layouts of operands
+//
+
+#include "Benchmark.h"
+#include <NDArray.h>
+#include <ops/ops.h>
+
+using namespace nd4j;
+using namespace nd4j::benchmark;
+
+// all arrays are 2D matrices with this number of columns
+#define LOOPS_COLUMNS 256
+
+// operand layouts:
+//      0 - contiguous 'c'
+//      1 - contiguous 'f'
+//      2 - strided view, i.e. left half of wider 'c' matrix
+//      3 - mixed, inputs are 'c' and output is 'f'
+#define LAYOUT_C 0
+#define LAYOUT_F 1
+#define LAYOUT_STRIDED 2
+#define LAYOUT_MIXED 3
+
+static const char* layoutName(Nd4jLong layout) {
+    switch (layout) {
+        case LAYOUT_C: return "c";
+        case LAYOUT_F: return "f";
+        case LAYOUT_STRIDED: return "strided";
+        default: return "mixed";
+    }
+}
+
+// owns all arrays created for one benchmark run
+class Operands {
+private:
+    std::vector<NDArray<float>*> _views;
+    std::vector<NDArray<float>*> _arrays;
+
+public:
+    ~Operands() {
+        for (auto v: _views)
+            delete v;
+
+        for (auto v: _arrays)
+            delete v;
+    }
+
+    NDArray<float>* create(Nd4jLong length, Nd4jLong layout, bool isOutput) {
+        Nd4jLong rows = length / LOOPS_COLUMNS;
+
+        NDArray<float>* result = nullptr;
+        switch (layout) {
+            case LAYOUT_F:
+                result = new NDArray<float>('f', {rows, LOOPS_COLUMNS});
+                break;
+            case LAYOUT_STRIDED: {
+                auto parent = new NDArray<float>('c', {rows, 2 * LOOPS_COLUMNS});
+                parent->linspace(-1.0f, 1.0f / (float) length);
+                _arrays.emplace_back(parent);
+
+                result = new NDArray<float>((*parent)({0,0, 0,LOOPS_COLUMNS}));
+                _views.emplace_back(result);
+                return result;
+            }
+            case LAYOUT_MIXED:
+                result = new NDArray<float>(isOutput ? 'f' : 'c', {rows, LOOPS_COLUMNS});
+                break;
+            default:
+                result = new NDArray<float>('c', {rows, LOOPS_COLUMNS});
+        }
+
+        result->linspace(-1.0f, 1.0f / (float) length);
+        _arrays.emplace_back(result);
+        return result;
+    }
+};
+
+static const std::vector<Nd4jLong> LENGTHS = {1 << 12, 1 << 16, 1 << 20, 1 << 22};
+static const std::vector<Nd4jLong> LAYOUTS = {LAYOUT_C, LAYOUT_F, LAYOUT_STRIDED, LAYOUT_MIXED};
+
+//////////////////////////////////////////////////////////////////////
+static void transform_abs(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+    auto z = operands.create(state.range(0), state.range(1), true);
+
+    while (state.keepRunning())
+        x->applyTransform<simdOps::Abs<float>>(z, nullptr);
+
+    state.setBytesProcessed(2 * state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(transform_abs)->ranges({LENGTHS, LAYOUTS});
+
+static void transform_tanh(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+    auto z = operands.create(state.range(0), state.range(1), true);
+
+    while (state.keepRunning())
+        x->applyTransform<simdOps::Tanh<float>>(z, nullptr);
+
+    state.setBytesProcessed(2 * state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(transform_tanh)->ranges({LENGTHS, LAYOUTS});
+
+//////////////////////////////////////////////////////////////////////
+static void scalar_add(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+    auto z = operands.create(state.range(0), state.range(1), true);
+
+    while (state.keepRunning())
+        x->applyScalar<simdOps::Add<float>>(1.0f, z, nullptr);
+
+    state.setBytesProcessed(2 * state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(scalar_add)->ranges({LENGTHS, LAYOUTS});
+
+//////////////////////////////////////////////////////////////////////
+static void pairwise_add(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+    auto y = operands.create(state.range(0), state.range(1), false);
+    auto z = operands.create(state.range(0), state.range(1), true);
+
+    while (state.keepRunning())
+        x->applyPairwiseTransform<simdOps::Add<float>>(y, z, nullptr);
+
+    state.setBytesProcessed(3 * state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(pairwise_add)->ranges({LENGTHS, LAYOUTS});
+
+//////////////////////////////////////////////////////////////////////
+static void broadcast_add_row(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+    auto z = operands.create(state.range(0), state.range(1), true);
+
+    NDArray<float> row('c', {1, LOOPS_COLUMNS});
+    row.linspace(1.0f);
+
+    while (state.keepRunning())
+        x->applyBroadcast<simdOps::Add<float>>({1}, &row, z, nullptr);
+
+    state.setBytesProcessed(2 * state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(broadcast_add_row)->ranges({LENGTHS, {LAYOUT_C, LAYOUT_F, LAYOUT_MIXED}});
+
+//////////////////////////////////////////////////////////////////////
+static void reduce_sum_full(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+
+    float sum = 0.0f;
+    while (state.keepRunning())
+        sum += x->reduceNumber<simdOps::Sum<float>>();
+
+    state.setBytesProcessed(state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(reduce_sum_full)->ranges({LENGTHS, {LAYOUT_C, LAYOUT_F, LAYOUT_STRIDED}});
+
+// range(2) is reduction dimension, 1 means along rows
+static void reduce_sum_dim(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+    int dimension = (int) state.range(2);
+
+    NDArray<float> z('c', {dimension == 1 ? x->sizeAt(0) : x->sizeAt(1)});
+
+    while (state.keepRunning())
+        x->reduceAlongDimension<simdOps::Sum<float>>(&z, {dimension});
+
+    state.setBytesProcessed(state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(reduce_sum_dim)->ranges({LENGTHS, {LAYOUT_C, LAYOUT_F, LAYOUT_STRIDED}, {0, 1}});
+
+//////////////////////////////////////////////////////////////////////
+static void reduce3_euclidean_full(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+    auto y = operands.create(state.range(0), state.range(1), false);
+
+    while (state.keepRunning()) {
+        auto z = x->applyReduce3<simdOps::EuclideanDistance<float>>(y);
+        delete z;
+    }
+
+    state.setBytesProcessed(2 * state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(reduce3_euclidean_full)->ranges({LENGTHS, {LAYOUT_C, LAYOUT_F, LAYOUT_STRIDED}});
+
+static void reduce3_euclidean_dim(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+    auto y = operands.create(state.range(0), state.range(1), false);
+
+    while (state.keepRunning()) {
+        auto z = x->applyReduce3<simdOps::EuclideanDistance<float>>(y, {1});
+        delete z;
+    }
+
+    state.setBytesProcessed(2 * state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(reduce3_euclidean_dim)->ranges({LENGTHS, {LAYOUT_C, LAYOUT_F, LAYOUT_STRIDED}});
+
+//////////////////////////////////////////////////////////////////////
+static void indexreduce_max_full(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+
+    Nd4jLong index = 0;
+    while (state.keepRunning())
+        index += x->indexReduceNumber<simdOps::IndexMax<float>>();
+
+    state.setBytesProcessed(state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(indexreduce_max_full)->ranges({LENGTHS, {LAYOUT_C, LAYOUT_F, LAYOUT_STRIDED}});
+
+static void indexreduce_max_dim(BenchmarkState &state) {
+    Operands operands;
+    auto x = operands.create(state.range(0), state.range(1), false);
+
+    NDArray<float> z('c', {x->sizeAt(0)});
+
+    while (state.keepRunning())
+        x->applyIndexReduce<simdOps::IndexMax<float>>(&z, {1});
+
+    state.setBytesProcessed(state.range(0) * sizeof(float));
+    state.setLabel(layoutName(state.range(1)));
+}
+ND4J_BENCHMARK(indexreduce_max_dim)->ranges({LENGTHS, {LAYOUT_C, LAYOUT_F, LAYOUT_STRIDED}});
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Benchmarks of heavy declarable ops
+//
+
+#include "Benchmark.h"
+#include <NDArray.h>
+#include <ops/declarable/CustomOperations.h>
+#include <stdexcept>
+
+using namespace nd4j;
+using namespace nd4j::benchmark;
+
+static void checkStatus(Nd4jStatus status, const char *opName) {
+    if (status != ND4J_STATUS_OK)
+        throw std::runtime_error(std::string(opName) + " op failed");
+}
+
+//////////////////////////////////////////////////////////////////////
+// square matrices of size range(0)
+static void op_matmul(BenchmarkState &state) {
+    auto n = state.range(0);
+    NDArray<float> a('c', {n, n});
+    NDArray<float> b('c', {n, n});
+    NDArray<float> c('c', {n, n});
+    a.linspace(0.0f, 1e-4f);
+    b.linspace(1.0f, -1e-4f);
+
+    nd4j::ops::matmul<float> op;
+    while (state.keepRunning())
+        checkStatus(op.execute({&a, &b}, {&c}, {}, {}), "matmul");
+
+    // items are flops here
+    state.setItemsProcessed(2 * n * n * n);
+    state.setBytesProcessed(3 * n * n * sizeof(float));
+}
+ND4J_BENCHMARK(op_matmul)->args({128})->args({512})->args({1024});
+
+//////////////////////////////////////////////////////////////////////
+// NCHW input [bS, iC, H, W], 3x3 kernel with oC channels, SAME mode
+static void op_conv2d(BenchmarkState &state) {
+    auto bS = state.range(0);
+    auto iC = state.range(1);
+    auto hw = state.range(2);
+    auto oC = state.range(3);
+
+    NDArray<float> input('c', {bS, iC, hw, hw});
+    NDArray<float> weights('c', {3, 3, iC, oC});
+    NDArray<float> bias('c', {oC});
+    NDArray<float> output('c', {bS, oC, hw, hw});
+    input.linspace(0.0f, 1e-5f);
+    weights.linspace(-1.0f, 1e-3f);
+    bias.assign(0.1f);
+
+    nd4j::ops::conv2d<float> op;
+    while (state.keepRunning())
+        checkStatus(op.execute({&input, &weights, &bias}, {&output}, {}, {3,3, 1,1, 0,0, 1,1, 1, 0}), "conv2d");
+
+    state.setItemsProcessed(2 * bS * oC * hw * hw * iC * 9);
+    state.setBytesProcessed((input.lengthOf() + output.lengthOf()) * sizeof(float));
+}
+ND4J_BENCHMARK(op_conv2d)->args({1, 64, 56, 64})->args({8, 32, 56, 64})->args({4, 3, 224, 32});
+
+//////////////////////////////////////////////////////////////////////
+// [rows, cols] softmax along last dimension
+static void op_softmax(BenchmarkState &state) {
+    NDArray<float> x('c', {state.range(0), state.range(1)});
+    NDArray<float> z('c', {state.range(0), state.range(1)});
+    x.linspace(-1.0f, 1e-4f);
+
+    nd4j::ops::softmax<float> op;
+    while (state.keepRunning())
+        checkStatus(op.execute({&x}, {&z}, {}, {}), "softmax");
+
+    state.setBytesProcessed(2 * x.lengthOf() * sizeof(float));
+}
+ND4J_BENCHMARK(op_softmax)->args({256, 1024})->args({4096, 128})->args({32, 32768});
+
+//////////////////////////////////////////////////////////////////////
+// range(2) random rows out of [rows, cols] matrix
+static void op_gather(BenchmarkState &state) {
+    auto rows = state.range(0);
+    auto cols = state.range(1);
+    auto numIndices = state.range(2);
+
+    NDArray<float> input('c', {rows, cols});
+    NDArray<float> indices('c', {numIndices});
+    NDArray<float> output('c', {numIndices, cols});
+    input.linspace(0.0f);
+
+    // lcg keeps indices reproducible between runs
+    Nd4jLong seed = 119;
+    for (Nd4jLong e = 0; e < numIndices; e++) {
+        seed = (seed * 6364136223846793005L + 1442695040888963407L) & 0x7fffffffffffffffL;
+        indices.putScalar(e, (float) ((seed >> 16) % rows));
+    }
+
+    nd4j::ops::gather<float> op;
+    while (state.keepRunning())
+        checkStatus(op.execute({&input, &indices}, {&output}, {}, {0}), "gather");
+
+    state.setBytesProcessed(2 * output.lengthOf() * sizeof(float));
+}
+ND4J_BENCHMARK(op_gather)->args({10000, 128, 4096})->args({100000, 64, 65536});
+
+//////////////////////////////////////////////////////////////////////
+// [time, bS, numUnits] lstm, input and projection sizes are equal to number of units
+static void op_lstm(BenchmarkState &state) {
+    auto time = state.range(0);
+    auto bS = state.range(1);
+    auto nU = state.range(2);
+
+    NDArray<float> x('c', {time, bS, nU});
+    NDArray<float> h0('c', {bS, nU});
+    NDArray<float> c0('c', {bS, nU});
+    NDArray<float> Wx('c', {nU, 4 * nU});
+    NDArray<float> Wh('c', {nU, 4 * nU});
+    NDArray<float> Wc('c', {3 * nU});
+    NDArray<float> Wp('c', {nU, nU});
+    NDArray<float> b('c', {4 * nU});
+    NDArray<float> h('c', {time, bS, nU});
+    NDArray<float> c('c', {time, bS, nU});
+
+    x.linspace(0.5f, 1e-4f);
+    h0 = 1.0f;
+    c0 = 2.0f;
+    Wx = 0.003f;
+    Wh = 0.006f;
+    Wc = 0.0f;
+    Wp = 0.0f;
+    b = 0.5f;
+
+    nd4j::ops::lstm<float> op;
+    while (state.keepRunning())
+        checkStatus(op.execute({&x, &h0, &c0, &Wx, &Wh, &Wc, &Wp, &b}, {&h, &c}, {0.0f, 0.0f, 0.0f}, {0, 0}), "lstm");
+
+    state.setItemsProcessed(time * 2 * bS * nU * 8 * nU);
+}
+ND4J_BENCHMARK(op_lstm)->args({32, 16, 128})->args({64, 32, 256});
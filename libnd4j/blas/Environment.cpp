@@ -32,6 +32,9 @@ namespace nd4j {
         _verbose.store(false);
         _debug.store(false);
         _profile.store(false);
+        _tracing.store(false);
+        _convolutionMemoryLimit.store(256L * 1024L * 1024L);
+        _winogradCacheLimit.store(128L * 1024L * 1024L);
 
 #ifndef ANDROID
         const char* omp_threads = std::getenv("OMP_NUM_THREADS");
@@ -46,6 +49,20 @@ namespace nd4j {
                 // still do nothing
             }
         }
+
+        const char* conv_limit = std::getenv("ND4J_CONV_MEMORY_LIMIT");
+        if (conv_limit != nullptr) {
+            try {
+                std::string limit(conv_limit);
+                Nd4jLong val = std::stoll(limit);
+                if (val > 0)
+                    _convolutionMemoryLimit.store(val);
+            } catch (std::invalid_argument &e) {
+                // just do nothing
+            } catch (std::out_of_range &e) {
+                // still do nothing
+            }
+        }
 #endif
     }
 
@@ -80,6 +97,14 @@ namespace nd4j {
         _profile.store(reallyProfile);
     }
 
+    bool Environment::isTracing() {
+        return _tracing.load();
+    }
+
+    void Environment::setTracing(bool reallyTrace) {
+        _tracing.store(reallyTrace);
+    }
+
     bool Environment::isDebugAndVerbose() {
         return this->isDebug() && this->isVerbose();
     }
@@ -112,6 +137,22 @@ namespace nd4j {
         _maxThreads.store(max);
     }
 
+    Nd4jLong Environment::convolutionMemoryLimit() {
+        return _convolutionMemoryLimit.load();
+    }
+
+    void Environment::setConvolutionMemoryLimit(Nd4jLong bytes) {
+        _convolutionMemoryLimit.store(bytes);
+    }
+
+    Nd4jLong Environment::winogradCacheLimit() {
+        return _winogradCacheLimit.load();
+    }
+
+    void Environment::setWinogradCacheLimit(Nd4jLong bytes) {
+        _winogradCacheLimit.store(bytes);
+    }
+
     nd4j::Environment *nd4j::Environment::_instance = 0;
 
 }
@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <dll.h>
+#include <pointercast.h>
 #include <helpers/StringUtils.h>
 #include <stdexcept>
 
@@ -34,8 +35,11 @@ namespace nd4j{
         std::atomic<bool> _verbose;
         std::atomic<bool> _debug;
         std::atomic<bool> _profile;
+        std::atomic<bool> _tracing;
         std::atomic<int> _maxThreads;
         std::atomic<bool> _useMKLDNN{true};
+        std::atomic<Nd4jLong> _convolutionMemoryLimit;
+        std::atomic<Nd4jLong> _winogradCacheLimit;
 
         static Environment* _instance;
 
@@ -51,6 +55,10 @@ namespace nd4j{
         bool isDebugAndVerbose();
         void setDebug(bool reallyDebug);
         void setProfiling(bool reallyProfile);
+
+        // node timings go to FlowPath trace ring buffer only, without the rest of profiling overhead
+        bool isTracing();
+        void setTracing(bool reallyTrace);
         
         int tadThreshold();
         void setTadThreshold(int threshold);
@@ -61,6 +69,14 @@ namespace nd4j{
         int maxThreads();
         void setMaxThreads(int max);
 
+        // upper bound (in bytes) for im2col/vol2col buffer of single convolution; bigger convolutions are processed in tiles
+        Nd4jLong convolutionMemoryLimit();
+        void setConvolutionMemoryLimit(Nd4jLong bytes);
+
+        // upper bound (in bytes) for all pre-transformed winograd filters kept between conv2d calls; least recently used go first
+        Nd4jLong winogradCacheLimit();
+        void setWinogradCacheLimit(Nd4jLong bytes);
+
         bool isUseMKLDNN() { return _useMKLDNN.load(); }
         void setUseMKLDNN(bool useMKLDNN) { _useMKLDNN.store(useMKLDNN); }
     };
@@ -42,7 +42,16 @@ namespace nd4j {
     template <typename T>
     class GraphExecutioner {
     protected:
+        /**
+         * This method checks if given Graph can be executed by dependency-driven parallel scheduler:
+         * there should be no LOGIC/RANDOM ops or embedded graphs, and at least one onion layer wider than 1 node
+         */
+        static bool isParallelizable(Graph<T> *graph);
 
+        /**
+         * This method executes non-logic Graph, running every Node as soon as all its inputs are available
+         */
+        static Nd4jStatus executeParallel(Graph<T> *graph, VariableSpace<T> *variableSpace);
 
     public:
         //static Nd4jStatus executeFlatNode(nd4j::graph::Graph *graph, nd4j::graph::Node *node, nd4j::graph::VariableSpace<float> *variableSpace);
@@ -71,6 +80,12 @@ namespace nd4j {
 
         static Graph<T> *importFromFlatBuffers(const char *filename);
 
+        /**
+        * This method maps given FlatBuffers file into memory, and restores Graph with variables pointing right into mapped file,
+        * whenever stored dtype and byte order match T. Processes mapping the same file share one page cache copy of weights.
+        */
+        static Graph<T> *importFromMappedFlatBuffers(const char *filename);
+
         static Graph<T> *importFromFlatPointer(Nd4jPointer ptr);
     };
 
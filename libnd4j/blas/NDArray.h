@@ -35,6 +35,10 @@
 namespace nd4j {
 
     template<typename T> class ND4J_EXPORT NDArray;
+
+    namespace expr {
+        template <typename T, typename Derived> class Expression;
+    }
     ND4J_EXPORT NDArray<float> operator-(const float, const NDArray<float>&);
     ND4J_EXPORT NDArray<float16> operator-(const float16, const NDArray<float16>&);
     ND4J_EXPORT NDArray<double> operator-(const double, const NDArray<double>&);
@@ -372,6 +376,12 @@ namespace nd4j {
         */ 
         void assign(const T value);
 
+        /**
+        *  this method evaluates lazy expression into this array in a single pass, see array/NDArrayExpression.h
+        */
+        template <typename E>
+        void assign(const nd4j::expr::Expression<T, E>& expression);
+
         /**
         *  returns new copy of this array, optionally in different order
         */
@@ -87,6 +87,14 @@ public:
      */
     void setTADThreshold(int num);
 
+    /**
+     * This method sets upper bound (in bytes) for im2col/vol2col buffer used by convolutions.
+     * Convolutions that need more are processed in tiles
+     *
+     * @param bytes
+     */
+    void setConvolutionMemoryLimit(Nd4jLong bytes);
+
     /**
        *
        * @param opNum
@@ -3184,6 +3192,13 @@ public:
     int registerGraphDouble(Nd4jPointer *extraPointers, Nd4jLong graphId, Nd4jPointer flatBufferPointer);
     int registerGraphHalf(Nd4jPointer *extraPointers, Nd4jLong graphId, Nd4jPointer flatBufferPointer);
 
+    /**
+     * These methods register graph stored in FlatBuffers file. File is memory-mapped, so weights aren't copied
+     */
+    int registerGraphFromFileFloat(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName);
+    int registerGraphFromFileDouble(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName);
+    int registerGraphFromFileHalf(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName);
+
     nd4j::graph::VariablesSet<float>* executeStoredGraphFloat(Nd4jPointer *extraPointers, Nd4jLong graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs);
     nd4j::graph::VariablesSet<double>* executeStoredGraphDouble(Nd4jPointer *extraPointers, Nd4jLong graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs);
     nd4j::graph::VariablesSet<float16>* executeStoredGraphHalf(Nd4jPointer *extraPointers, Nd4jLong graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs);
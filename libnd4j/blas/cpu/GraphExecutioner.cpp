@@ -50,6 +50,10 @@
 #include <helpers/ShapeUtils.h>
 #include <Status.h>
 #include <deque>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <algorithm>
 #include <graph/ResultWrapper.h>
 #include <graph/ExecutionResult.h>
 #include <graph/exceptions/graph_execution_exception.h>
@@ -199,6 +203,253 @@ template <typename T>
 }
 
 
+/**
+ * This method checks if Graph has anything that requires strict onion-order execution
+ */
+template <typename T>
+bool GraphExecutioner<T>::isParallelizable(Graph<T> *graph) {
+    bool wide = false;
+    for (auto &layer: *graph->getOnion()) {
+        if (layer.second->size() > 1)
+            wide = true;
+
+        for (auto node: *layer.second) {
+            // LOGIC ops drive frames & rewinds, RANDOM ops share RNG state, embedded graphs own their executioner
+            if (node->opType() == OpType_LOGIC || node->opType() == OpType_RANDOM || node->hasGraphEmbedded())
+                return false;
+        }
+    }
+
+    return wide;
+}
+
+/**
+ * Shared state of single parallel Graph execution
+ */
+template <typename T>
+struct ParallelExecution {
+    Graph<T> *graph;
+    VariableSpace<T> *variableSpace;
+    FlowPath *flowPath;
+    bool profiling;
+    bool tracing;
+
+    // nodes in onion order, and per-node lists of dependent nodes
+    std::vector<Node<T>*> nodes;
+    std::vector<std::vector<int>> consumers;
+    std::unique_ptr<std::atomic<int>[]> pending;
+
+    std::atomic<int> status;
+    std::exception_ptr failure;
+    std::mutex failureLock;
+
+    void run(int position);
+    void release(int position);
+};
+
+template <typename T>
+void ParallelExecution<T>::release(int position) {
+    for (auto c: consumers[position]) {
+        // last resolved input schedules consumer
+        if (--pending[c] == 0) {
+#pragma omp task default(shared) firstprivate(c)
+            run(c);
+        }
+    }
+}
+
+template <typename T>
+void ParallelExecution<T>::run(int position) {
+    // once something failed we're just draining the graph
+    if (status.load() != ND4J_STATUS_OK)
+        return;
+
+    auto node = nodes[position];
+    try {
+        // same skip rules as in sequential mode: disabled inputs, or inactive branch of divergent node
+        bool shouldSkip = false;
+        for (auto &inputId: *node->input()) {
+            if (inputId.first < 0 || variableSpace->hasExternalVariable(inputId.first) || graph->getMapped()->count(inputId.first) == 0)
+                continue;
+
+            Node<T> *prevNode = graph->getMapped()->at(inputId.first);
+            if (!flowPath->isNodeActive(inputId.first) || (prevNode->isDivergencePoint() && flowPath->branch(inputId.first) != inputId.second)) {
+                nd4j_debug("Skipping Node_%i due to inactive input [%i]\n", node->id(), inputId.first);
+                shouldSkip = true;
+                break;
+            }
+        }
+
+        if (shouldSkip) {
+            flowPath->markNodeActive(node->id(), false);
+        } else {
+            flowPath->markNodeActive(node->id(), true);
+
+            auto nodeTime = tracing ? GraphProfile::currentTime() : 0L;
+            auto timeStart = std::chrono::system_clock::now();
+
+            auto result = GraphExecutioner<T>::executeFlatNode(graph, node, variableSpace);
+
+            auto timeEnd = std::chrono::system_clock::now();
+            flowPath->setOuterTime(node->id(), std::chrono::duration_cast<std::chrono::nanoseconds>(timeEnd - timeStart).count());
+
+            if (tracing) {
+                auto totalTime = GraphProfile::relativeTime(nodeTime);
+                if (profiling)
+                    flowPath->profile()->nodeById(node->id())->setTotalTime(totalTime);
+
+                flowPath->profile()->traceNode(node->id(), TracePhase_TOTAL, nodeTime, totalTime);
+            }
+
+            if (result != ND4J_STATUS_OK) {
+                status.store(result);
+                return;
+            }
+
+            flowPath->markExecuted(node->id(), true);
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(failureLock);
+        if (failure == nullptr)
+            failure = std::current_exception();
+
+        status.store(ND4J_STATUS_BAD_GRAPH);
+        return;
+    }
+
+    release(position);
+}
+
+/**
+ * This method executes given Graph as dependency DAG: each Node is launched as OpenMP task once all of its inputs are resolved
+ *
+ * PLEASE NOTE: ops launched here won't use nested parallelism, so this path is used only for "wide" graphs
+ */
+template <typename T>
+Nd4jStatus GraphExecutioner<T>::executeParallel(Graph<T> *graph, VariableSpace<T> *variableSpace) {
+    ParallelExecution<T> execution;
+    execution.graph = graph;
+    execution.variableSpace = variableSpace;
+    execution.flowPath = variableSpace->flowPath();
+    execution.profiling = Environment::getInstance()->isProfiling();
+    execution.tracing = execution.profiling || Environment::getInstance()->isTracing();
+    execution.status.store(ND4J_STATUS_OK);
+
+    // flattening onion, position in this vector is used as tie-breaker for external variables
+    std::map<int, int> positions;
+    for (int l = 0; l < (int) graph->getOnion()->size(); l++) {
+        if (graph->getOnion()->count(l) == 0)
+            continue;
+
+        for (auto node: *graph->getOnion()->at(l)) {
+            positions[node->id()] = (int) execution.nodes.size();
+            execution.nodes.emplace_back(node);
+        }
+    }
+
+    int numNodes = (int) execution.nodes.size();
+    execution.consumers.resize(numNodes);
+    execution.pending.reset(new std::atomic<int>[numNodes]);
+    for (int e = 0; e < numNodes; e++)
+        execution.pending[e].store(0);
+
+    auto addDependency = [&](int producer, int consumer) {
+        execution.consumers[producer].emplace_back(consumer);
+        execution.pending[consumer]++;
+    };
+
+    std::map<int, std::vector<int>> externalReaders;
+    std::map<int, std::vector<int>> externalWriters;
+    std::map<std::pair<int, int>, std::vector<int>> readers;
+    std::map<std::pair<int, int>, std::vector<int>> inplaceWriters;
+    for (int e = 0; e < numNodes; e++) {
+        auto node = execution.nodes[e];
+
+        // std::map isn't safe for concurrent inserts, so all per-node entries are created before launch
+        execution.flowPath->registerNode(node->id());
+        if (execution.profiling)
+            execution.flowPath->profile()->nodeById(node->id(), node->name()->c_str());
+
+        for (auto &inputId: *node->input()) {
+            if (inputId.first < 0 || variableSpace->hasExternalVariable(inputId.first))
+                externalReaders[inputId.first].emplace_back(e);
+            else if (positions.count(inputId.first) > 0)
+                addDependency(positions[inputId.first], e);
+
+            readers[inputId].emplace_back(e);
+
+            // in-place op writes its outputs right into input arrays. Context follows prototype flag, not Node one
+            if (node->hasBlockAttached() ? node->getContextPrototype()->isInplace() : node->isInplace())
+                inplaceWriters[inputId].emplace_back(e);
+        }
+
+        if (node->hasExternalOutputs()) {
+            for (auto &outputId: *node->output())
+                if (variableSpace->hasExternalVariable(outputId.first))
+                    externalWriters[outputId.first].emplace_back(e);
+        }
+    }
+
+    // nodes writing into external variables must keep their sequential order against readers & other writers
+    for (auto &w: externalWriters) {
+        auto touching = w.second;
+        if (externalReaders.count(w.first) > 0)
+            touching.insert(touching.end(), externalReaders[w.first].begin(), externalReaders[w.first].end());
+
+        std::sort(touching.begin(), touching.end());
+        touching.erase(std::unique(touching.begin(), touching.end()), touching.end());
+
+        for (int e = 1; e < (int) touching.size(); e++)
+            addDependency(touching[e - 1], touching[e]);
+    }
+
+    // in-place node can't overwrite its input while other consumers of that variable are still reading it, and vice versa
+    for (auto &w: inplaceWriters) {
+        auto &touching = readers[w.first];
+        std::sort(touching.begin(), touching.end());
+        touching.erase(std::unique(touching.begin(), touching.end()), touching.end());
+
+        // readers between two writers may still run concurrently
+        int lastWriter = -1;
+        std::vector<int> sinceWriter;
+        for (auto t: touching) {
+            if (std::find(w.second.begin(), w.second.end(), t) != w.second.end()) {
+                if (sinceWriter.empty() && lastWriter >= 0)
+                    addDependency(lastWriter, t);
+
+                for (auto r: sinceWriter)
+                    addDependency(r, t);
+
+                lastWriter = t;
+                sinceWriter.clear();
+            } else {
+                if (lastWriter >= 0)
+                    addDependency(lastWriter, t);
+
+                sinceWriter.emplace_back(t);
+            }
+        }
+    }
+
+#pragma omp parallel default(shared)
+    {
+#pragma omp single
+        {
+            for (int e = 0; e < numNodes; e++) {
+                if (execution.pending[e].load() == 0) {
+#pragma omp task default(shared) firstprivate(e)
+                    execution.run(e);
+                }
+            }
+        }
+    }
+
+    if (execution.failure != nullptr)
+        std::rethrow_exception(execution.failure);
+
+    return execution.status.load();
+}
+
 /**
  * This method executes given Graph instance, and returns error code.
  *
@@ -216,6 +467,7 @@ Nd4jStatus GraphExecutioner<T>::execute(Graph<T> *graph, VariableSpace<T>* varia
     }
     auto flowPath = __variableSpace->flowPath();
 
+    bool tracing = Environment::getInstance()->isProfiling() || Environment::getInstance()->isTracing();
     Nd4jLong tb0 = Environment::getInstance()->isProfiling() ? GraphProfile::currentTime() : 0L;
     graph->buildGraph();
 
@@ -232,10 +484,35 @@ Nd4jStatus GraphExecutioner<T>::execute(Graph<T> *graph, VariableSpace<T>* varia
     if (Environment::getInstance()->isProfiling())
         flowPath->profile()->setBuildTime(GraphProfile::relativeTime(tb0));
 
+    // ring buffer has to exist before nodes start recording concurrently
+    if (tracing)
+        flowPath->profile()->trace()->prepare();
+
     Nd4jLong timeStart = Environment::getInstance()->isProfiling() ? GraphProfile::currentTime() : 0L;
 
     bool pe = graph->getExecutorConfiguration()->_executionMode == ExecutionMode_AUTO;
 
+    // graphs without logic ops can be executed as plain dependency DAG
+    bool parallel = pe && isParallelizable(graph);
+    flowPath->markParallel(parallel);
+    if (parallel) {
+        auto status = executeParallel(graph, __variableSpace);
+
+        if (Environment::getInstance()->isProfiling())
+            flowPath->profile()->setExecutionTime(GraphProfile::relativeTime(timeStart));
+
+        if (__variableSpace->workspace() != nullptr && status == Status::OK())
+            nd4j::memory::MemoryRegistrator::getInstance()->setGraphMemoryFootprintIfGreater(graph->hashCode(), __variableSpace->workspace()->getAllocatedSize());
+
+        if (tempFlow)
+            delete flowPath;
+
+        return status;
+    }
+
+    // sequential OPTIMIZED runs reuse intermediate memory via static plan. if shapes can't be inferred upfront, they're recorded by this run for the next one
+    bool plannable = __variableSpace == graph->getVariableSpace();
+    bool planned = plannable && graph->planMemory();
 
     // basically if at some point code diverges, code branch might be _DISABLED_, and all nodes within that branch will be disabled as well
 
@@ -264,9 +541,14 @@ Nd4jStatus GraphExecutioner<T>::execute(Graph<T> *graph, VariableSpace<T>* varia
             if (Environment::getInstance()->isProfiling())
                 flowPath->profile()->nodeById(node->id(), node->name()->c_str());
 
-            if (lastId != node->id() && Environment::getInstance()->isProfiling()) {
-                if (lastId != -10000000)
-                    flowPath->profile()->nodeById(lastId)->setTotalTime(GraphProfile::relativeTime(nodeTime));
+            if (lastId != node->id() && tracing) {
+                if (lastId != -10000000) {
+                    auto totalTime = GraphProfile::relativeTime(nodeTime);
+                    if (Environment::getInstance()->isProfiling())
+                        flowPath->profile()->nodeById(lastId)->setTotalTime(totalTime);
+
+                    flowPath->profile()->traceNode(lastId, TracePhase_TOTAL, nodeTime, totalTime);
+                }
 
                 lastId = node->id();
                 nodeTime = GraphProfile::currentTime();
@@ -482,12 +764,20 @@ Nd4jStatus GraphExecutioner<T>::execute(Graph<T> *graph, VariableSpace<T>* varia
     }
 
     // optionally saving execution time
+    if (tracing && lastId != -10000000)
+        flowPath->profile()->traceNode(lastId, TracePhase_TOTAL, nodeTime, GraphProfile::relativeTime(nodeTime));
+
     if (Environment::getInstance()->isProfiling()) {
-        flowPath->profile()->nodeById(lastId)->setTotalTime(GraphProfile::relativeTime(nodeTime));
+        auto totalTime = GraphProfile::relativeTime(nodeTime);
+        flowPath->profile()->nodeById(lastId)->setTotalTime(totalTime);
         flowPath->profile()->setExecutionTime(GraphProfile::relativeTime(timeStart));
         //flowPath->profile().printOut();
     }
 
+    // outputs of this run stay where they are, plan will be applied by next execution
+    if (plannable && !planned)
+        graph->recordOutputShapes();
+
     // saving memory footprint for current run
     if (__variableSpace->workspace() != nullptr) {
         auto m = __variableSpace->workspace()->getAllocatedSize();
@@ -842,12 +1132,13 @@ uint8_t* readFlatBuffers(const char * filename) {
     uint8_t * data = new uint8_t[fileLen];
 
     FILE *in = fopen(filename, "rb");
-    int cnt = 0;
-    int b = 0;
-    while (cnt < fileLen) {
-        b += fread(data + cnt, 1, 1, in);
+    size_t cnt = 0;
+    while (cnt < static_cast<size_t>(fileLen)) {
+        auto b = fread(data + cnt, 1, fileLen - cnt, in);
+        if (b == 0)
+            break;
 
-        cnt++;
+        cnt += b;
     }
     fclose(in);
 
@@ -910,6 +1201,20 @@ Graph<T>* GraphExecutioner<T>::importFromFlatBuffers(const char *filename) {
     return restoredGraph;
 }
 
+template <typename T>
+Graph<T>* GraphExecutioner<T>::importFromMappedFlatBuffers(const char *filename) {
+    std::shared_ptr<MappedFile> storage(new MappedFile(filename));
+
+    flatbuffers::Verifier verifier(storage->data(), storage->length());
+    if (!VerifyFlatGraphBuffer(verifier)) {
+        nd4j_printf("File [%s] doesn't contain valid FlatGraph\n", filename);
+        throw std::runtime_error("Bad FlatGraph file");
+    }
+
+    // variables that were restored as views keep storage alive, everything else is copied as usual
+    return new Graph<T>(GetFlatGraph(storage->data()), nullptr, storage);
+}
+
     template <typename T>
     Graph<T> *GraphExecutioner<T>::importFromFlatPointer(Nd4jPointer ptr) {
         auto fg = GetFlatGraph(reinterpret_cast<uint8_t *>(ptr));
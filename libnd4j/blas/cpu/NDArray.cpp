@@ -38,6 +38,7 @@
 #include <helpers/ArrayUtils.h>
 #include <MmulHelper.h>
 #include <helpers/threshold.h>
+#include <helpers/TadCache.h>
 
 namespace nd4j {
 
@@ -1112,13 +1113,11 @@ template <typename T>
         if(rankOf() == copy.size() || copy.empty())
             result->_buffer[0] = functions::reduce::ReduceFunction<T>::template execScalar<OpName>(_buffer, _shapeInfo, nullptr);
         else {
-            shape::TAD tad(_shapeInfo, copy.data(), copy.size());
-            tad.createTadOnlyShapeInfo();
-            tad.createOffsets();
+            auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
 
             functions::reduce::ReduceFunction<T>::template exec<OpName>(_buffer, _shapeInfo, nullptr, result->_buffer,
                                                                         result->_shapeInfo, copy.data(), copy.size(),
-                                                                        tad.tadOnlyShapeInfo, tad.tadOffsets);
+                                                                        tad->tadShapeInfo(), tad->tadOffsets());
         }
 
         return result;
@@ -1139,13 +1138,11 @@ template <typename T>
         if(rankOf() == copy.size() || copy.empty())
             result._buffer[0] = functions::reduce::ReduceFunction<T>::template execScalar<OpName>(_buffer, _shapeInfo, nullptr);
         else {
-            shape::TAD tad(_shapeInfo, copy.data(), copy.size());
-            tad.createTadOnlyShapeInfo();
-            tad.createOffsets();
+            auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
 
             functions::reduce::ReduceFunction<T>::template exec<OpName>(_buffer, _shapeInfo, nullptr, result._buffer,
                                                                         result._shapeInfo, copy.data(), copy.size(),
-                                                                        tad.tadOnlyShapeInfo, tad.tadOffsets);
+                                                                        tad->tadShapeInfo(), tad->tadOffsets());
         }
 
         return result;
@@ -1169,13 +1166,11 @@ template <typename T>
         if(rankOf() == copy.size() || copy.empty())
             target->_buffer[0] = functions::reduce::ReduceFunction<T>::template execScalar<OpName>(_buffer, _shapeInfo, extras);
         else {
-            shape::TAD tad(_shapeInfo, copy.data(), copy.size());
-            tad.createTadOnlyShapeInfo();
-            tad.createOffsets();
+            auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
 
             functions::reduce::ReduceFunction<T>::template exec<OpName>(_buffer, _shapeInfo, extras, target->_buffer,
                                                                         target->_shapeInfo, copy.data(), copy.size(),
-                                                                        tad.tadOnlyShapeInfo, tad.tadOffsets);
+                                                                        tad->tadShapeInfo(), tad->tadOffsets());
         }
     }
 
@@ -1358,21 +1353,19 @@ template <typename T>
         if (index >= numTads)
             throw std::runtime_error("Can't get index higher than total number of TADs");
 
-        shape::TAD tad(this->_shapeInfo, copy.data(), copy.size());
-        tad.createTadOnlyShapeInfo();
-        tad.createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(this->_shapeInfo, copy.data(), copy.size());
 
         // shape::printShapeInfoLinear(tad.tadOnlyShapeInfo);
 
-        T* buffer = this->_buffer + tad.tadOffsets[index];
+        T* buffer = this->_buffer + tad->tadOffsets()[index];
 
         Nd4jLong* shapeInfo;
         if (_workspace == nullptr) {
-            shapeInfo = new Nd4jLong[shape::shapeInfoLength(tad.tadOnlyShapeInfo)];
+            shapeInfo = new Nd4jLong[shape::shapeInfoLength(tad->tadShapeInfo())];
         } else {
-            shapeInfo = reinterpret_cast<Nd4jLong *>(_workspace->allocateBytes(shape::shapeInfoByteLength(tad.tadOnlyShapeInfo)));
+            shapeInfo = reinterpret_cast<Nd4jLong *>(_workspace->allocateBytes(shape::shapeInfoByteLength(tad->tadShapeInfo())));
         }
-        std::memcpy(shapeInfo, tad.tadOnlyShapeInfo, shape::shapeInfoByteLength(tad.tadOnlyShapeInfo));
+        std::memcpy(shapeInfo, tad->tadShapeInfo(), shape::shapeInfoByteLength(tad->tadShapeInfo()));
 
         auto array = new NDArray<T>(buffer, shapeInfo, _workspace);
         array->_isBuffAlloc = false;
@@ -1565,13 +1558,11 @@ template<typename T>
 
         int dimension[1] = {1};
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, dimension, 1));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, dimension, 1);
 
         NativeOpExcutioner<T>::execBroadcast(0, _buffer, _shapeInfo, row->_buffer, row->_shapeInfo, target->getBuffer(), target->getShapeInfo(),
-                                             dimension, 1, tad->tadOnlyShapeInfo, tad->tadOffsets,
-                                             tad->tadOnlyShapeInfo, tad->tadOffsets);
+                                             dimension, 1, tad->tadShapeInfo(), tad->tadOffsets(),
+                                             tad->tadShapeInfo(), tad->tadOffsets());
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1582,13 +1573,11 @@ template<typename T>
 
         int dimension[1] = {1};
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, dimension, 1));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, dimension, 1);
 
         NativeOpExcutioner<T>::execBroadcast(1, _buffer, _shapeInfo, row->_buffer, row->_shapeInfo, target->getBuffer(), target->getShapeInfo(),
-                                             dimension, 1, tad->tadOnlyShapeInfo, tad->tadOffsets,
-                                             tad->tadOnlyShapeInfo, tad->tadOffsets);
+                                             dimension, 1, tad->tadShapeInfo(), tad->tadOffsets(),
+                                             tad->tadShapeInfo(), tad->tadOffsets());
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1599,13 +1588,11 @@ template<typename T>
 
         int dimension[1] = {1};
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, dimension, 1));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, dimension, 1);
 
         NativeOpExcutioner<T>::execBroadcast(2, _buffer, _shapeInfo, row->_buffer, row->_shapeInfo, target->getBuffer(), target->getShapeInfo(),
-                                             dimension, 1, tad->tadOnlyShapeInfo, tad->tadOffsets,
-                                             tad->tadOnlyShapeInfo, tad->tadOffsets);
+                                             dimension, 1, tad->tadShapeInfo(), tad->tadOffsets(),
+                                             tad->tadShapeInfo(), tad->tadOffsets());
 
     }
 
@@ -1617,13 +1604,11 @@ template<typename T>
 
         int dimension[1] = {1};
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, dimension, 1));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, dimension, 1);
 
         NativeOpExcutioner<T>::execBroadcast(3, _buffer, _shapeInfo, row->_buffer, row->_shapeInfo, target->getBuffer(), target->getShapeInfo(),
-                                             dimension, 1, tad->tadOnlyShapeInfo, tad->tadOffsets,
-                                             tad->tadOnlyShapeInfo, tad->tadOffsets);
+                                             dimension, 1, tad->tadShapeInfo(), tad->tadOffsets(),
+                                             tad->tadShapeInfo(), tad->tadOffsets());
 
     }
 
@@ -1636,13 +1621,11 @@ template<typename T>
 
         int dimension[1] = {1};
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, dimension, 1));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, dimension, 1);
 
         NativeOpExcutioner<T>::execBroadcast(0, _buffer, _shapeInfo, row->_buffer, row->_shapeInfo, _buffer, _shapeInfo,
-                                             dimension, 1, tad->tadOnlyShapeInfo, tad->tadOffsets,
-                                             tad->tadOnlyShapeInfo, tad->tadOffsets);
+                                             dimension, 1, tad->tadShapeInfo(), tad->tadOffsets(),
+                                             tad->tadShapeInfo(), tad->tadOffsets());
     }
 
 
@@ -1654,13 +1637,11 @@ template<typename T>
 
         int dimension[1] = {0};
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, dimension, 1));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, dimension, 1);
 
         NativeOpExcutioner<T>::execBroadcast(0, _buffer, _shapeInfo, column->_buffer, column->_shapeInfo, target->getBuffer(), target->getShapeInfo(),
-                                             dimension, 1, tad->tadOnlyShapeInfo, tad->tadOffsets,
-                                             tad->tadOnlyShapeInfo, tad->tadOffsets);
+                                             dimension, 1, tad->tadShapeInfo(), tad->tadOffsets(),
+                                             tad->tadShapeInfo(), tad->tadOffsets());
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1672,13 +1653,11 @@ template<typename T>
 
         int dimension[1] = {0};
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, dimension, 1));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, dimension, 1);
 
         NativeOpExcutioner<T>::execBroadcast(0, _buffer, _shapeInfo, column->_buffer, column->_shapeInfo, _buffer, _shapeInfo,
-                                             dimension, 1, tad->tadOnlyShapeInfo, tad->tadOffsets,
-                                             tad->tadOnlyShapeInfo, tad->tadOffsets);
+                                             dimension, 1, tad->tadShapeInfo(), tad->tadOffsets(),
+                                             tad->tadShapeInfo(), tad->tadOffsets());
     }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1690,13 +1669,11 @@ template<typename T>
 
         int dimension[1] = {0};
 
-        std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, dimension, 1));
-        tad->createTadOnlyShapeInfo();
-        tad->createOffsets();
+        auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, dimension, 1);
 
         NativeOpExcutioner<T>::execBroadcast(2, _buffer, _shapeInfo, column->_buffer, column->_shapeInfo, _buffer, _shapeInfo,
-                                             dimension, 1, tad->tadOnlyShapeInfo, tad->tadOffsets,
-                                             tad->tadOnlyShapeInfo, tad->tadOffsets);
+                                             dimension, 1, tad->tadShapeInfo(), tad->tadOffsets(),
+                                             tad->tadShapeInfo(), tad->tadOffsets());
     }
 
 
@@ -2359,14 +2336,12 @@ void NDArray<T>::applyBroadcast(std::vector<int>& dimensions, const NDArray<T>*
     if (tadLength != tadArray->lengthOf())
        throw std::runtime_error("Tad length mismatch");
 
-    shape::TAD tad(this->_shapeInfo, copy.data(), copy.size());
-    tad.createTadOnlyShapeInfo();
-    tad.createOffsets();
+    auto tad = nd4j::TadCache::getInstance()->tadForDimensions(this->_shapeInfo, copy.data(), copy.size());
 
     NDArray<T>* result = target == nullptr ? this : target;
 
     // TODO: eventually we want separate tads here
-    functions::broadcast::Broadcast<T>::template exec<OpName>(this->_buffer, this->_shapeInfo, tadArray->_buffer, tadArray->_shapeInfo, result->_buffer, result->_shapeInfo, copy.data(), (int)copy.size(), tad.tadOnlyShapeInfo, tad.tadOffsets, tad.tadOnlyShapeInfo, tad.tadOffsets);
+    functions::broadcast::Broadcast<T>::template exec<OpName>(this->_buffer, this->_shapeInfo, tadArray->_buffer, tadArray->_shapeInfo, result->_buffer, result->_shapeInfo, copy.data(), (int)copy.size(), tad->tadShapeInfo(), tad->tadOffsets(), tad->tadShapeInfo(), tad->tadOffsets());
 }
 
 
@@ -2784,13 +2759,11 @@ bool NDArray<T>::isUnitary() {
             if (dimensions.size() > 1)
                 std::sort(copy.begin(), copy.end());
 
-            shape::TAD tad(_shapeInfo, copy.data(), copy.size());
-            tad.createTadOnlyShapeInfo();
-            tad.createOffsets();
+            auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
 
             functions::indexreduce::IndexReduce<T>::template exec<OpName>(_buffer, _shapeInfo, const_cast<T*>(extraParams), target->_buffer,
                                                                           target->_shapeInfo, copy.data(), copy.size(),
-                                                                          tad.tadOnlyShapeInfo, tad.tadOffsets);
+                                                                          tad->tadShapeInfo(), tad->tadOffsets());
         }
     }
     ////////////////////////////////////////////////////////////////////////
@@ -2810,13 +2783,11 @@ bool NDArray<T>::isUnitary() {
         if(rankOf() == copy.size())
             result->_buffer[0] = functions::indexreduce::IndexReduce<T>::template execScalar<OpName>(_buffer, _shapeInfo, const_cast<T*>(extraParams));
         else {
-            shape::TAD tad(_shapeInfo, copy.data(), copy.size());
-            tad.createTadOnlyShapeInfo();
-            tad.createOffsets();
+            auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
         
             functions::indexreduce::IndexReduce<T>::template exec<OpName>(_buffer, _shapeInfo, const_cast<T*>(extraParams), result->_buffer,
                                                                     result->_shapeInfo, copy.data(), copy.size(),
-                                                                    tad.tadOnlyShapeInfo, tad.tadOffsets);
+                                                                    tad->tadShapeInfo(), tad->tadOffsets());
         }
         
         return result;
@@ -2864,15 +2835,11 @@ bool NDArray<T>::isUnitary() {
         shape::checkDimensions(rankOf(), copy);
         shape::checkDimensions(other->rankOf(), copy);               
         // create tads
-        shape::TAD tadX(_shapeInfo, copy.data(), copy.size());
-        tadX.createTadOnlyShapeInfo();
-        tadX.createOffsets();
+        auto tadX = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
 
-        shape::TAD tadY(other->_shapeInfo, copy.data(), copy.size());
-        tadY.createTadOnlyShapeInfo();
-        tadY.createOffsets();        
+        auto tadY = nd4j::TadCache::getInstance()->tadForDimensions(other->_shapeInfo, copy.data(), copy.size());
         // check tads shapes
-        if(!shape::equalsSoft(tadX.tadOnlyShapeInfo, tadY.tadOnlyShapeInfo)) 
+        if(!shape::equalsSoft(tadX->tadShapeInfo(), tadY->tadShapeInfo())) 
             throw std::runtime_error("NDArray::applyAllReduce3 method: the shapes of array tads are different !");
         // evaluate numbers of tads
         Nd4jLong tadLengthX = shape::tadLength(_shapeInfo, copy.data(), copy.size());
@@ -2899,7 +2866,7 @@ bool NDArray<T>::isUnitary() {
         // perform calculations
         functions::reduce3::Reduce3<T>::template execAll<OpName>(_buffer, _shapeInfo, const_cast<T*>(extraParams),
                                                                  other->_buffer, other->_shapeInfo, result->_buffer,result->_shapeInfo,
-                                                                 copy.data(), copy.size(), tadX.tadOnlyShapeInfo, tadX.tadOffsets, tadY.tadOnlyShapeInfo, tadY.tadOffsets);
+                                                                 copy.data(), copy.size(), tadX->tadShapeInfo(), tadX->tadOffsets(), tadY->tadShapeInfo(), tadY->tadOffsets());
         delete []extraParamsVals;
         return result;
     }
@@ -2927,17 +2894,13 @@ bool NDArray<T>::isUnitary() {
         if(rankOf() == copy.size() && other->rankOf() == copy.size())
             result->_buffer[0] = functions::reduce3::Reduce3<T>::template execScalar<OpName>(_buffer, _shapeInfo, const_cast<T*>(extraParams), other->_buffer, other->_shapeInfo);
         else {
-            shape::TAD tadX(_shapeInfo, copy.data(), copy.size());
-            tadX.createTadOnlyShapeInfo();
-            tadX.createOffsets();
+            auto tadX = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
 
-            shape::TAD tadY(other->_shapeInfo, copy.data(), copy.size());
-            tadY.createTadOnlyShapeInfo();
-            tadY.createOffsets();        
+            auto tadY = nd4j::TadCache::getInstance()->tadForDimensions(other->_shapeInfo, copy.data(), copy.size());
         
             functions::reduce3::Reduce3<T>::template exec<OpName>(_buffer, _shapeInfo, const_cast<T*>(extraParams),
                                                                  other->_buffer, other->_shapeInfo, result->_buffer,result->_shapeInfo,
-                                                                 copy.data(), copy.size(), tadX.tadOnlyShapeInfo, tadX.tadOffsets);
+                                                                 copy.data(), copy.size(), tadX->tadShapeInfo(), tadX->tadOffsets(), tadY->tadShapeInfo(), tadY->tadOffsets());
         }
         
         delete []extraParamsVals;
@@ -3715,13 +3678,11 @@ ResultSet<T>* NDArray<T>::multipleTensorsAlongDimension(const std::vector<int> &
     Nd4jLong tadLength = shape::tadLength(_shapeInfo, copy.data(), copy.size());
     Nd4jLong numTads = _length / tadLength;
 
-    std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, copy.data(), copy.size()));
-    tad->createTadOnlyShapeInfo();
-    tad->createOffsets();
+    auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
 
     // FIXME: why we're not using workspaces here?
-    Nd4jLong* shapeInfo = new Nd4jLong[shape::shapeInfoLength(tad->tadOnlyShapeInfo[0])];
-    std::memcpy(shapeInfo, tad->tadOnlyShapeInfo, shape::shapeInfoByteLength(tad->tadOnlyShapeInfo));
+    Nd4jLong* shapeInfo = new Nd4jLong[shape::shapeInfoLength(tad->tadShapeInfo()[0])];
+    std::memcpy(shapeInfo, tad->tadShapeInfo(), shape::shapeInfoByteLength(tad->tadShapeInfo()));
 
     for (auto idx: indices) {
         if (idx >= numTads) {
@@ -3729,7 +3690,7 @@ ResultSet<T>* NDArray<T>::multipleTensorsAlongDimension(const std::vector<int> &
             throw std::runtime_error("Bad index");
         }
 
-        T* buffer = _buffer + tad->tadOffsets[idx];
+        T* buffer = _buffer + tad->tadOffsets()[idx];
         NDArray<T>* array = new NDArray<T>(buffer, shapeInfo);
         result->push_back(array);
     }
@@ -3764,15 +3725,13 @@ ResultSet<T>* NDArray<T>::allTensorsAlongDimension(const std::vector<int> &dimen
     Nd4jLong tadLength = shape::tadLength(_shapeInfo, copy.data(), copy.size());
     Nd4jLong numTads = _length / tadLength;
 
-    std::unique_ptr<shape::TAD> tad(new shape::TAD(_shapeInfo, copy.data(), copy.size()));
-    tad->createTadOnlyShapeInfo();
-    tad->createOffsets();
+    auto tad = nd4j::TadCache::getInstance()->tadForDimensions(_shapeInfo, copy.data(), copy.size());
 
-    auto shapeInfo = new Nd4jLong[shape::shapeInfoLength(tad->tadOnlyShapeInfo[0])];
-    std::memcpy(shapeInfo, tad->tadOnlyShapeInfo, shape::shapeInfoByteLength(tad->tadOnlyShapeInfo));
+    auto shapeInfo = new Nd4jLong[shape::shapeInfoLength(tad->tadShapeInfo()[0])];
+    std::memcpy(shapeInfo, tad->tadShapeInfo(), shape::shapeInfoByteLength(tad->tadShapeInfo()));
 
     for (int idx = 0; idx < numTads; idx++ ) {
-        T* buffer = _buffer + tad->tadOffsets[idx];
+        T* buffer = _buffer + tad->tadOffsets()[idx];
         NDArray<T>* array = new NDArray<T>(buffer, shapeInfo);
         result->push_back(array);
     }
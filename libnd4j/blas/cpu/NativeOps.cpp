@@ -80,6 +80,11 @@ void NativeOps::setTADThreshold(int num) {
         nd4j::Environment::getInstance()->setTadThreshold(num);
 }
 
+void NativeOps::setConvolutionMemoryLimit(Nd4jLong bytes) {
+    if (bytes > 0)
+        nd4j::Environment::getInstance()->setConvolutionMemoryLimit(bytes);
+}
+
 /**
  *
  * @param opNum
@@ -2640,9 +2645,6 @@ void NativeOps::execAggregateBatchFloat(Nd4jPointer *extraPointers,
 
     //nd4j_printf("numAggregates: [%i]; opNum: [%i]; maxArgs: [%i]; maxShapes: [%i]; maxIntArrays: [%i]; maxIntArraySize: [%i]; maxIdx: [%i]; maxReals: [%i];\n", numAggregates, opNum, maxArgs, maxShapes, maxIntArrays, maxIntArraySize, maxIdx, maxReals);
 
-    // probably, we don't want too much threads as usually
-    int _threads = nd4j::math::nd4j_min<int>(numAggregates, omp_get_max_threads());
-
     nd4j::PointersHelper<float> helper(ptrToArguments,
                                        numAggregates,
                                        maxArgs,
@@ -2652,35 +2654,7 @@ void NativeOps::execAggregateBatchFloat(Nd4jPointer *extraPointers,
                                        maxIdx,
                                        maxReals);
 
-    // special case here, we prefer spread arrangement here, all threads are detached from each other
-#pragma omp parallel for num_threads(_threads) schedule(guided) proc_bind(close) default(shared)
-    for (int i = 0; i < numAggregates; i++) {
-        auto intArrays = new int *[maxIntArrays];
-
-        auto arguments = helper.getArguments(i);
-        auto shapes = helper.getShapeArguments(i);
-        auto idxArg = helper.getIndexArguments(i);
-        auto realArg = helper.getRealArguments(i);
-
-        for (int e = 0; e < maxIntArrays; e++) {
-            intArrays[e] = helper.getIntArrayArguments(i, e);
-        }
-
-        execAggregateFloat(extraPointers,
-                           opNum,
-                           arguments,
-                           helper.getNumArguments(i),
-                           shapes,
-                           helper.getNumShapeArguments(i),
-                           idxArg,
-                           helper.getNumIndexArguments(i),
-                           reinterpret_cast<int **>(intArrays),
-                           helper.getNumIntArrayArguments(i),
-                           realArg,
-                           helper.getNumRealArguments(i));
-
-        delete [] intArrays;
-    }
+    functions::aggregate::AggregatedFunction<float>::execBatch(opNum, helper, numAggregates, maxIntArrays);
 }
 
 
@@ -2695,9 +2669,6 @@ void NativeOps::execAggregateBatchDouble(Nd4jPointer *extraPointers,
                                          int maxReals,
                                          void *ptrToArguments) {
 
-    // probably, we don't want too much threads as usually
-    int _threads = nd4j::math::nd4j_min<int>(numAggregates, omp_get_max_threads());
-
     nd4j::PointersHelper<double> helper(ptrToArguments,
                                         numAggregates,
                                         maxArgs,
@@ -2707,35 +2678,7 @@ void NativeOps::execAggregateBatchDouble(Nd4jPointer *extraPointers,
                                         maxIdx,
                                         maxReals);
 
-    // special case here, we prefer spread arrangement here, all threads are detached from each other
-#pragma omp parallel for num_threads(_threads) schedule(guided) proc_bind(spread) default(shared)
-    for (int i = 0; i < numAggregates; i++) {
-        auto intArrays = new int *[maxIntArrays];
-
-        auto arguments = helper.getArguments(i);
-        auto shapes = helper.getShapeArguments(i);
-        auto idxArg = helper.getIndexArguments(i);
-        auto realArg = helper.getRealArguments(i);
-
-        for (int e = 0; e < maxIntArrays; e++) {
-            intArrays[e] = helper.getIntArrayArguments(i, e);
-        }
-
-        execAggregateDouble(extraPointers,
-                            opNum,
-                            arguments,
-                            helper.getNumArguments(i),
-                            shapes,
-                            helper.getNumShapeArguments(i),
-                            idxArg,
-                            helper.getNumIndexArguments(i),
-                            intArrays,
-                            helper.getNumIntArrayArguments(i),
-                            realArg,
-                            helper.getNumRealArguments(i));
-
-        delete [] intArrays;
-    }
+    functions::aggregate::AggregatedFunction<double>::execBatch(opNum, helper, numAggregates, maxIntArrays);
 
 
 }
@@ -3353,6 +3296,30 @@ int NativeOps::registerGraphHalf(Nd4jPointer *extraPointers, Nd4jLong graphId, N
     return ND4J_STATUS_OK;
 }
 
+int NativeOps::registerGraphFromFileFloat(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName) {
+    auto graph = nd4j::graph::GraphExecutioner<float>::importFromMappedFlatBuffers(fileName);
+
+    nd4j::graph::GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+    return ND4J_STATUS_OK;
+}
+
+int NativeOps::registerGraphFromFileDouble(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName) {
+    auto graph = nd4j::graph::GraphExecutioner<double>::importFromMappedFlatBuffers(fileName);
+
+    nd4j::graph::GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+    return ND4J_STATUS_OK;
+}
+
+int NativeOps::registerGraphFromFileHalf(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName) {
+    auto graph = nd4j::graph::GraphExecutioner<float16>::importFromMappedFlatBuffers(fileName);
+
+    nd4j::graph::GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+    return ND4J_STATUS_OK;
+}
+
 template <typename T>
 static VariablesSet<T>* executeStoredGraphT(Nd4jPointer *extraPointers, Nd4jLong graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
     auto graph = nd4j::graph::GraphHolder::getInstance()->pullGraph<T>(graphId);
@@ -3662,6 +3629,8 @@ void NativeOps::convertTypes(Nd4jPointer *extras, int srcType, Nd4jPointer x, Nd
             nd4j::TypeCast::convertGeneric<float16, double>(nullptr, dx, N, dz);
         } else if (dstType == ND4J_THRESHOLD) {
             nd4j::TypeCast::convertToThreshold<float16>(nullptr, dx, N, dz);
+        } else if (dstType == ND4J_THRESHOLD_V2) {
+            nd4j::TypeCast::convertToThresholdV2<float16>(nullptr, dx, N, dz);
         } else {
             nd4j_printf("Unsupported types conversion: [%i] -> [%i]\n", srcType, dstType);
         }
@@ -3708,6 +3677,8 @@ void NativeOps::convertTypes(Nd4jPointer *extras, int srcType, Nd4jPointer x, Nd
             nd4j::TypeCast::convertGeneric<float, double>(nullptr, dx, N, dz);
         } else if (dstType == ND4J_THRESHOLD) {
             nd4j::TypeCast::convertToThreshold<float>(nullptr, dx, N, dz);
+        } else if (dstType == ND4J_THRESHOLD_V2) {
+            nd4j::TypeCast::convertToThresholdV2<float>(nullptr, dx, N, dz);
         } else {
             nd4j_printf("Unsupported types conversion: [%i] -> [%i]\n", srcType, dstType);
         }
@@ -3732,6 +3703,8 @@ void NativeOps::convertTypes(Nd4jPointer *extras, int srcType, Nd4jPointer x, Nd
             //
         } else if (dstType == ND4J_THRESHOLD) {
             nd4j::TypeCast::convertToThreshold<double>(nullptr, dx, N, dz);
+        } else if (dstType == ND4J_THRESHOLD_V2) {
+            nd4j::TypeCast::convertToThresholdV2<double>(nullptr, dx, N, dz);
         } else {
             nd4j_printf("Unsupported types conversion: [%i] -> [%i]\n", srcType, dstType);
         }
@@ -3745,6 +3718,16 @@ void NativeOps::convertTypes(Nd4jPointer *extras, int srcType, Nd4jPointer x, Nd
         } else {
             nd4j_printf("Unsupported types conversion: [%i] -> [%i]\n", srcType, dstType);
         }
+    } else if (srcType == ND4J_THRESHOLD_V2) {
+        if (dstType == ND4J_FLOAT16) {
+            nd4j::TypeCast::convertFromThresholdV2<float16>(nullptr, dx, N, dz);
+        } else if (dstType == ND4J_FLOAT32) {
+            nd4j::TypeCast::convertFromThresholdV2<float>(nullptr, dx, N, dz);
+        } else if (dstType == ND4J_DOUBLE) {
+            nd4j::TypeCast::convertFromThresholdV2<double>(nullptr, dx, N, dz);
+        } else {
+            nd4j_printf("Unsupported types conversion: [%i] -> [%i]\n", srcType, dstType);
+        }
     } else {
         nd4j_printf("Unsupported types conversion: [%i] -> [%i]\n", srcType, dstType);
     }
@@ -5142,6 +5142,10 @@ void NativeOps::setTADThreshold(int num) {
     // this is no-op for CUDA
 }
 
+void NativeOps::setConvolutionMemoryLimit(Nd4jLong bytes) {
+    // this is no-op for CUDA
+}
+
 void NativeOps::execScalarFloat(Nd4jPointer *extraPointers,int opNum,
 					 float *x,
 					 Nd4jLong *xShapeInfo,
@@ -6437,6 +6441,30 @@ int NativeOps::registerGraphHalf(Nd4jPointer *extraPointers, Nd4jLong graphId, N
 	return ND4J_STATUS_OK;
 }
 
+int NativeOps::registerGraphFromFileFloat(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName) {
+	auto graph = nd4j::graph::GraphExecutioner<float>::importFromMappedFlatBuffers(fileName);
+
+	nd4j::graph::GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+	return ND4J_STATUS_OK;
+}
+
+int NativeOps::registerGraphFromFileDouble(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName) {
+	auto graph = nd4j::graph::GraphExecutioner<double>::importFromMappedFlatBuffers(fileName);
+
+	nd4j::graph::GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+	return ND4J_STATUS_OK;
+}
+
+int NativeOps::registerGraphFromFileHalf(Nd4jPointer *extraPointers, Nd4jLong graphId, const char *fileName) {
+	auto graph = nd4j::graph::GraphExecutioner<float16>::importFromMappedFlatBuffers(fileName);
+
+	nd4j::graph::GraphHolder::getInstance()->registerGraph(graphId, graph);
+
+	return ND4J_STATUS_OK;
+}
+
 template <typename T>
 static VariablesSet<T>* executeStoredGraphT(Nd4jPointer *extraPointers, Nd4jLong graphId, Nd4jPointer *inputBuffers, Nd4jPointer *inputShapes, int* inputIndices, int numInputs) {
 	auto graph = nd4j::graph::GraphHolder::getInstance()->pullGraph<T>(graphId);
@@ -51,6 +51,7 @@ OPERATIONS=
 CLEAN="false"
 MINIFIER="false"
 TESTS="false"
+BENCHMARKS="false"
 NAME=
 while [[ $# > 0 ]]
 do
@@ -119,6 +120,9 @@ case $key in
     -t|--tests)
     TESTS="true"
     ;;
+    --benchmarks)
+    BENCHMARKS="true"
+    ;;
     --default)
     DEFAULT=YES
     ;;
@@ -417,6 +421,7 @@ fi
 EXPERIMENTAL_ARG="no";
 MINIFIER_ARG="-DLIBND4J_BUILD_MINIFIER=false"
 TESTS_ARG="-DBUILD_TESTS=OFF"
+BENCHMARKS_ARG="-DBUILD_BENCHMARKS=OFF"
 NAME_ARG="-DLIBND4J_NAME=$NAME"
 
 if [ "$EXPERIMENTAL" == "yes" ]; then
@@ -432,6 +437,10 @@ if [ "$TESTS" == "true" ]; then
     TESTS_ARG="-DBUILD_TESTS=ON"
 fi
 
+if [ "$BENCHMARKS" == "true" ]; then
+    BENCHMARKS_ARG="-DBUILD_BENCHMARKS=ON"
+fi
+
 ARCH_ARG="-DARCH=$ARCH -DEXTENSION=$CHIP_EXTENSION"
 
 CUDA_COMPUTE="-DCOMPUTE=$COMPUTE"
@@ -507,12 +516,13 @@ echo LIBRARY TYPE    = "${LIBTYPE}"
 echo OPERATIONS = "${OPERATIONS_ARG}"
 echo MINIFIER = "${MINIFIER_ARG}"
 echo TESTS = "${TESTS_ARG}"
+echo BENCHMARKS = "${BENCHMARKS_ARG}"
 echo NAME = "${NAME_ARG}"
 echo MKLDNN_PATH = "$MKLDNN_PATH"
 echo OPENBLAS_PATH = "$OPENBLAS_PATH"
 mkbuilddir
 pwd
-eval $CMAKE_COMMAND  "$BLAS_ARG" "$ARCH_ARG" "$NAME_ARG" "$SHARED_LIBS_ARG" "$MINIFIER_ARG" "$OPERATIONS_ARG" "$BUILD_TYPE" "$PACKAGING_ARG" "$EXPERIMENTAL_ARG" "$TESTS_ARG" "$CUDA_COMPUTE" -DMKLDNN_PATH="$MKLDNN_PATH" -DOPENBLAS_PATH="$OPENBLAS_PATH" -DDEV=FALSE -DCMAKE_NEED_RESPONSE=YES -DMKL_MULTI_THREADED=TRUE ../..
+eval $CMAKE_COMMAND  "$BLAS_ARG" "$ARCH_ARG" "$NAME_ARG" "$SHARED_LIBS_ARG" "$MINIFIER_ARG" "$OPERATIONS_ARG" "$BUILD_TYPE" "$PACKAGING_ARG" "$EXPERIMENTAL_ARG" "$TESTS_ARG" "$BENCHMARKS_ARG" "$CUDA_COMPUTE" -DMKLDNN_PATH="$MKLDNN_PATH" -DOPENBLAS_PATH="$OPENBLAS_PATH" -DDEV=FALSE -DCMAKE_NEED_RESPONSE=YES -DMKL_MULTI_THREADED=TRUE ../..
 if [ "$PARALLEL" == "true" ]; then
         eval $MAKE_COMMAND -j $MAKEJ && cd ../../..
     else
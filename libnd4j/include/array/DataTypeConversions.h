@@ -32,6 +32,20 @@
 namespace nd4j {
     template <typename T>
     class DataTypeConversions {
+    private:
+        // integer buffers are converted to T here, exact integer values are preserved separately by IndexArray
+        template <typename S>
+        static FORCEINLINE void convertIntegers(T* buffer, void* src, bool canKeep, Nd4jLong length) {
+            auto tmp = new S[length];
+            memcpy(tmp, src, length * sizeof(S));
+
+#pragma omp parallel for schedule(static)
+            for (Nd4jLong e = 0; e < length; e++)
+                buffer[e] = static_cast<T>(static_cast<double>(canKeep ? tmp[e] : BitwiseUtils::swap_bytes<S>(tmp[e])));
+
+            delete[] tmp;
+        }
+
     public:
         static FORCEINLINE void convertType(T* buffer, void* src, DataType dataType, ByteOrder order, Nd4jLong length) {
             bool isBe = BitwiseUtils::isBE();
@@ -109,6 +123,30 @@ namespace nd4j {
                         }
                     }
                     break;
+                case DataType_INT8:
+                        convertIntegers<int8_t>(buffer, src, canKeep, length);
+                    break;
+                case DataType_INT16:
+                        convertIntegers<int16_t>(buffer, src, canKeep, length);
+                    break;
+                case DataType_INT32:
+                        convertIntegers<int32_t>(buffer, src, canKeep, length);
+                    break;
+                case DataType_INT64:
+                        convertIntegers<int64_t>(buffer, src, canKeep, length);
+                    break;
+                case DataType_UINT8:
+                        convertIntegers<uint8_t>(buffer, src, canKeep, length);
+                    break;
+                case DataType_UINT16:
+                        convertIntegers<uint16_t>(buffer, src, canKeep, length);
+                    break;
+                case DataType_UINT32:
+                        convertIntegers<uint32_t>(buffer, src, canKeep, length);
+                    break;
+                case DataType_UINT64:
+                        convertIntegers<uint64_t>(buffer, src, canKeep, length);
+                    break;
                 default: {
                     nd4j_printf("Unsupported DataType requested: [%i]\n", static_cast<int>(dataType));
                     throw std::runtime_error("Unsupported DataType");
@@ -0,0 +1,84 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// This class holds integer indices (gather/scatter/embedding ids) as exact 64-bit values.
+//
+// NDArray<T> stores everything as T, so ids above 2^24 (float) or 2^11 (float16) can't be represented there.
+// Variables that arrive as INT32/INT64 FlatArrays keep an IndexArray next to their converted NDArray,
+// and index-consuming ops read it via Context::getIndexArray() instead of casting T back to int.
+//
+
+#ifndef LIBND4J_INDEXARRAY_H
+#define LIBND4J_INDEXARRAY_H
+
+#include <vector>
+#include <pointercast.h>
+#include <dll.h>
+#include <op_boilerplate.h>
+#include <array/DataType.h>
+#include <graph/generated/array_generated.h>
+
+namespace nd4j {
+
+    template<typename T> class NDArray; // forward declaration of template class NDArray
+
+    class ND4J_EXPORT IndexArray {
+    private:
+        // c-ordered shapeInfo, same shape as the NDArray this index array describes
+        std::vector<Nd4jLong> _shapeInfo;
+        std::vector<Nd4jLong> _values;
+
+    public:
+        IndexArray(const std::vector<Nd4jLong>& shape, const std::vector<Nd4jLong>& values);
+        ~IndexArray() = default;
+
+        /**
+         * This method converts given NDArray into IndexArray, with a single pass over its buffer
+         */
+        template <typename T>
+        static IndexArray* fromNDArray(NDArray<T>* array);
+
+        /**
+         * This method restores IndexArray from FlatArray, if its dtype is integer. Returns nullptr otherwise.
+         */
+        static IndexArray* fromFlatArray(const nd4j::graph::FlatArray* flatArray);
+
+        static bool isIntegerType(DataType dtype);
+
+        Nd4jLong lengthOf() const;
+        int rankOf() const;
+        Nd4jLong sizeAt(int dim) const;
+        std::vector<Nd4jLong> getShapeAsVector() const;
+        Nd4jLong* getShapeInfo() const;
+
+        bool isScalar() const;
+        bool isVector() const;
+
+        /**
+         * This method returns true if all indices fit into [lower, upper) range
+         */
+        bool isInRange(Nd4jLong lower, Nd4jLong upper) const;
+
+        const Nd4jLong* buffer() const;
+
+        FORCEINLINE Nd4jLong operator()(Nd4jLong i) const {
+            return _values[i];
+        }
+    };
+}
+
+#endif //LIBND4J_INDEXARRAY_H
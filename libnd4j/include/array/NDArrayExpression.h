@@ -0,0 +1,386 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Lazy expressions over NDArrays.
+//
+// Regular NDArray operators allocate a result for every step, so a+b*c costs two temporaries and three passes.
+// Expressions built here are just trees of references, evaluated in one pass straight into destination array:
+//
+//     h->assign(expr::lazy(u) * (*h0) + ((T) 1.f - expr::lazy(u)) * n);
+//
+// Any operand wrapped with expr::lazy() (or expr::transform()) turns the whole chain lazy, plain NDArray
+// operators stay eager. Operands are broadcast numpy-style against destination shape.
+//
+// PLEASE NOTE: expressions keep pointers to their operands, so they must be evaluated within the same full-expression
+// if operands are temporaries. Destination may be used as operand only if it's not broadcast and has the same strides.
+//
+
+#ifndef LIBND4J_NDARRAYEXPRESSION_H
+#define LIBND4J_NDARRAYEXPRESSION_H
+
+#include <NDArray.h>
+#include <ops/ops.h>
+#include <vector>
+#include <stdexcept>
+
+namespace nd4j {
+namespace expr {
+
+    template <typename X>
+    struct Identity {
+        typedef X type;
+    };
+
+    // merges given shape into accumulated broadcast shape, numpy rules
+    static FORCEINLINE void mergeShape(std::vector<Nd4jLong>& acc, const Nd4jLong* shape, int rank) {
+        if (static_cast<int>(acc.size()) < rank)
+            acc.insert(acc.begin(), rank - acc.size(), 1);
+
+        int shift = static_cast<int>(acc.size()) - rank;
+        for (int d = 0; d < rank; d++) {
+            auto& a = acc[shift + d];
+            if (a == shape[d] || shape[d] == 1)
+                continue;
+
+            if (a != 1)
+                throw std::runtime_error("NDArray expression: operand shapes can't be broadcast");
+
+            a = shape[d];
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Derived>
+    class Expression {
+    public:
+        FORCEINLINE const Derived& self() const {
+            return static_cast<const Derived&>(*this);
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // leaf: NDArray operand, read along destination rows with broadcast (zero) strides where needed
+    template <typename T>
+    class ArrayOperand : public Expression<T, ArrayOperand<T>> {
+    private:
+        const NDArray<T>* _array;
+
+    public:
+        struct Cursor {
+            const T* p;
+            Nd4jLong s;
+
+            FORCEINLINE T operator()(Nd4jLong j) const {
+                return p[j * s];
+            }
+        };
+
+        explicit ArrayOperand(const NDArray<T>& array) : _array(&array) { }
+
+        void mergeShapeInto(std::vector<Nd4jLong>& shape) const {
+            mergeShape(shape, _array->shapeOf(), _array->rankOf());
+        }
+
+        bool isFlat(const NDArray<T>& z) const {
+            return _array->ordering() == 'c' && _array->ews() == 1 && _array->isSameShape(&z);
+        }
+
+        /**
+         * This method returns cursor over destination row given by coords of its first rank-1 dimensions.
+         * For flat evaluation coords are ignored, and whole buffer is one row
+         */
+        Cursor row(const NDArray<T>& z, const Nd4jLong* coords, bool flat) const {
+            Cursor c;
+            c.p = _array->getBuffer();
+            c.s = 1;
+            if (flat)
+                return c;
+
+            const int zRank = z.rankOf();
+            const int rank = _array->rankOf();
+            const int shift = zRank - rank;
+            const Nd4jLong* shape = _array->shapeOf();
+            const Nd4jLong* strides = _array->stridesOf();
+
+            Nd4jLong offset = 0;
+            c.s = 0;
+            for (int d = shift < 0 ? -shift : 0; d < rank; d++) {
+                if (shape[d] == 1)
+                    continue;
+
+                if (d + shift == zRank - 1)
+                    c.s = strides[d];
+                else
+                    offset += coords[d + shift] * strides[d];
+            }
+
+            c.p += offset;
+            return c;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class ScalarOperand : public Expression<T, ScalarOperand<T>> {
+    private:
+        T _value;
+
+    public:
+        struct Cursor {
+            T v;
+
+            FORCEINLINE T operator()(Nd4jLong j) const {
+                return v;
+            }
+        };
+
+        explicit ScalarOperand(const T value) : _value(value) { }
+
+        void mergeShapeInto(std::vector<Nd4jLong>& shape) const { }
+
+        bool isFlat(const NDArray<T>& z) const {
+            return true;
+        }
+
+        Cursor row(const NDArray<T>& z, const Nd4jLong* coords, bool flat) const {
+            Cursor c;
+            c.v = _value;
+            return c;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // pairwise node, OpClass is any simdOps class with op(T, T, T*)
+    template <typename T, typename OpClass, typename L, typename R>
+    class Binary : public Expression<T, Binary<T, OpClass, L, R>> {
+    private:
+        L _left;
+        R _right;
+
+    public:
+        struct Cursor {
+            typename L::Cursor l;
+            typename R::Cursor r;
+
+            FORCEINLINE T operator()(Nd4jLong j) const {
+                return OpClass::op(l(j), r(j), nullptr);
+            }
+        };
+
+        Binary(const L& left, const R& right) : _left(left), _right(right) { }
+
+        void mergeShapeInto(std::vector<Nd4jLong>& shape) const {
+            _left.mergeShapeInto(shape);
+            _right.mergeShapeInto(shape);
+        }
+
+        bool isFlat(const NDArray<T>& z) const {
+            return _left.isFlat(z) && _right.isFlat(z);
+        }
+
+        Cursor row(const NDArray<T>& z, const Nd4jLong* coords, bool flat) const {
+            Cursor c;
+            c.l = _left.row(z, coords, flat);
+            c.r = _right.row(z, coords, flat);
+            return c;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // transform node, OpClass is any simdOps class with op(T, T*)
+    template <typename T, typename OpClass, typename E>
+    class Unary : public Expression<T, Unary<T, OpClass, E>> {
+    private:
+        E _operand;
+
+    public:
+        struct Cursor {
+            typename E::Cursor e;
+
+            FORCEINLINE T operator()(Nd4jLong j) const {
+                return OpClass::op(e(j), nullptr);
+            }
+        };
+
+        explicit Unary(const E& operand) : _operand(operand) { }
+
+        void mergeShapeInto(std::vector<Nd4jLong>& shape) const {
+            _operand.mergeShapeInto(shape);
+        }
+
+        bool isFlat(const NDArray<T>& z) const {
+            return _operand.isFlat(z);
+        }
+
+        Cursor row(const NDArray<T>& z, const Nd4jLong* coords, bool flat) const {
+            Cursor c;
+            c.e = _operand.row(z, coords, flat);
+            return c;
+        }
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    /**
+     * This function wraps NDArray, so operators applied to it build expression instead of computing temporary arrays
+     */
+    template <typename T>
+    FORCEINLINE ArrayOperand<T> lazy(const NDArray<T>& array) {
+        return ArrayOperand<T>(array);
+    }
+
+    template <typename OpClass, typename T, typename E>
+    FORCEINLINE Unary<T, OpClass, E> transform(const Expression<T, E>& operand) {
+        return Unary<T, OpClass, E>(operand.self());
+    }
+
+    template <typename OpClass, typename T>
+    FORCEINLINE Unary<T, OpClass, ArrayOperand<T>> transform(const NDArray<T>& operand) {
+        return Unary<T, OpClass, ArrayOperand<T>>(ArrayOperand<T>(operand));
+    }
+
+    // activations used by recurrent cells
+    template <typename T, typename E>
+    FORCEINLINE Unary<T, simdOps::Sigmoid<T>, E> sigmoid(const Expression<T, E>& operand) {
+        return Unary<T, simdOps::Sigmoid<T>, E>(operand.self());
+    }
+
+    template <typename T, typename E>
+    FORCEINLINE Unary<T, simdOps::Tanh<T>, E> tanh(const Expression<T, E>& operand) {
+        return Unary<T, simdOps::Tanh<T>, E>(operand.self());
+    }
+
+    template <typename T, typename E>
+    FORCEINLINE Unary<T, simdOps::Neg<T>, E> operator-(const Expression<T, E>& operand) {
+        return Unary<T, simdOps::Neg<T>, E>(operand.self());
+    }
+
+#define ND4J_EXPRESSION_OPERATOR(OPERATOR, OP_CLASS) \
+    template <typename T, typename L, typename R> \
+    FORCEINLINE Binary<T, OP_CLASS<T>, L, R> operator OPERATOR(const Expression<T, L>& left, const Expression<T, R>& right) { \
+        return Binary<T, OP_CLASS<T>, L, R>(left.self(), right.self()); \
+    } \
+    template <typename T, typename L> \
+    FORCEINLINE Binary<T, OP_CLASS<T>, L, ArrayOperand<T>> operator OPERATOR(const Expression<T, L>& left, const NDArray<T>& right) { \
+        return Binary<T, OP_CLASS<T>, L, ArrayOperand<T>>(left.self(), ArrayOperand<T>(right)); \
+    } \
+    template <typename T, typename R> \
+    FORCEINLINE Binary<T, OP_CLASS<T>, ArrayOperand<T>, R> operator OPERATOR(const NDArray<T>& left, const Expression<T, R>& right) { \
+        return Binary<T, OP_CLASS<T>, ArrayOperand<T>, R>(ArrayOperand<T>(left), right.self()); \
+    } \
+    template <typename T, typename L> \
+    FORCEINLINE Binary<T, OP_CLASS<T>, L, ScalarOperand<T>> operator OPERATOR(const Expression<T, L>& left, const typename Identity<T>::type right) { \
+        return Binary<T, OP_CLASS<T>, L, ScalarOperand<T>>(left.self(), ScalarOperand<T>(right)); \
+    } \
+    template <typename T, typename R> \
+    FORCEINLINE Binary<T, OP_CLASS<T>, ScalarOperand<T>, R> operator OPERATOR(const typename Identity<T>::type left, const Expression<T, R>& right) { \
+        return Binary<T, OP_CLASS<T>, ScalarOperand<T>, R>(ScalarOperand<T>(left), right.self()); \
+    }
+
+    ND4J_EXPRESSION_OPERATOR(+, simdOps::Add)
+    ND4J_EXPRESSION_OPERATOR(-, simdOps::Subtract)
+    ND4J_EXPRESSION_OPERATOR(*, simdOps::Multiply)
+    ND4J_EXPRESSION_OPERATOR(/, simdOps::Divide)
+
+#undef ND4J_EXPRESSION_OPERATOR
+
+    //////////////////////////////////////////////////////////////////////////
+    /**
+     * This function evaluates expression into z, in a single pass over z, without temporary arrays
+     */
+    template <typename T, typename E>
+    void evaluate(const Expression<T, E>& expression, NDArray<T>& z) {
+        const E& e = expression.self();
+
+        std::vector<Nd4jLong> shape = z.getShapeAsVector();
+        e.mergeShapeInto(shape);
+        if (!z.isSameShape(shape))
+            throw std::runtime_error("NDArray expression: result shape doesn't match destination array");
+
+        const Nd4jLong length = z.lengthOf();
+        if (length == 0)
+            return;
+
+        T* zBuffer = z.getBuffer();
+        const bool parallel = length > Environment::getInstance()->elementwiseThreshold();
+
+        // everything is contiguous and of the same shape: one flat loop
+        if (z.ordering() == 'c' && z.ews() == 1 && e.isFlat(z)) {
+            auto c = e.row(z, nullptr, true);
+
+#pragma omp parallel for simd schedule(static) if (parallel)
+            for (Nd4jLong j = 0; j < length; j++)
+                zBuffer[j] = c(j);
+
+            return;
+        }
+
+        // otherwise we go row by row along the last dimension, with broadcast operands having zero strides
+        const int rank = z.rankOf();
+        const Nd4jLong cols = z.sizeAt(-1);
+        const Nd4jLong rows = length / cols;
+        const Nd4jLong* zShape = z.shapeOf();
+        const Nd4jLong* zStrides = z.stridesOf();
+        const Nd4jLong zs = zStrides[rank - 1];
+
+#pragma omp parallel for schedule(static) if (parallel)
+        for (Nd4jLong r = 0; r < rows; r++) {
+            Nd4jLong coords[MAX_RANK];
+            Nd4jLong zOffset = 0;
+            if (rank > 1) {
+                shape::ind2subC(rank - 1, const_cast<Nd4jLong *>(zShape), r, coords);
+                for (int d = 0; d < rank - 1; d++)
+                    zOffset += coords[d] * zStrides[d];
+            }
+
+            auto c = e.row(z, coords, false);
+            T* zRow = zBuffer + zOffset;
+
+#pragma omp simd
+            for (Nd4jLong j = 0; j < cols; j++)
+                zRow[j * zs] = c(j);
+        }
+    }
+
+    /**
+     * This function evaluates expression into new array of broadcast shape
+     */
+    template <typename T, typename E>
+    NDArray<T> evaluate(const Expression<T, E>& expression, const char order = 'c', nd4j::memory::Workspace* workspace = nullptr) {
+        std::vector<Nd4jLong> shape;
+        expression.self().mergeShapeInto(shape);
+        if (shape.empty())
+            throw std::runtime_error("NDArray expression: can't evaluate expression without array operands");
+
+        if (shape.size() == 1)
+            shape.insert(shape.begin(), 1);
+
+        NDArray<T> result(order, shape, workspace);
+        evaluate(expression, result);
+
+        return result;
+    }
+}
+
+    //////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    template <typename E>
+    void NDArray<T>::assign(const nd4j::expr::Expression<T, E>& expression) {
+        nd4j::expr::evaluate(expression, *this);
+    }
+}
+
+#endif //LIBND4J_NDARRAYEXPRESSION_H
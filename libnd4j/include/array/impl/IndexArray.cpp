@@ -0,0 +1,175 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#include <array/IndexArray.h>
+#include <array/DataTypeUtils.h>
+#include <array/ByteOrderUtils.h>
+#include <helpers/BitwiseUtils.h>
+#include <helpers/shape.h>
+#include <NDArray.h>
+#include <cstring>
+
+namespace nd4j {
+
+    template <typename S>
+    static void readIntegers(Nd4jLong *values, const void *src, bool canKeep, Nd4jLong length) {
+        // flatbuffers don't guarantee alignment for vector payloads, so we copy first
+        std::vector<S> tmp(length);
+        memcpy(tmp.data(), src, length * sizeof(S));
+
+#pragma omp parallel for schedule(static) if (length > Environment::getInstance()->elementwiseThreshold())
+        for (Nd4jLong e = 0; e < length; e++)
+            values[e] = static_cast<Nd4jLong>(canKeep ? tmp[e] : BitwiseUtils::swap_bytes<S>(tmp[e]));
+    }
+
+    IndexArray::IndexArray(const std::vector<Nd4jLong>& shape, const std::vector<Nd4jLong>& values) {
+        _shapeInfo.resize(shape::shapeInfoLength(static_cast<int>(shape.size())));
+        shape::shapeBuffer(static_cast<int>(shape.size()), const_cast<Nd4jLong *>(shape.data()), _shapeInfo.data());
+        _values = values;
+
+        if (static_cast<Nd4jLong>(_values.size()) != shape::length(_shapeInfo.data()))
+            throw std::runtime_error("IndexArray: number of values doesn't match shape");
+    }
+
+    template <typename T>
+    IndexArray* IndexArray::fromNDArray(NDArray<T>* array) {
+        auto length = array->lengthOf();
+        std::vector<Nd4jLong> values(length);
+
+        auto buffer = array->getBuffer();
+        auto ews = array->ews();
+        if (array->ordering() == 'c' && ews >= 1) {
+#pragma omp parallel for schedule(static) if (length > Environment::getInstance()->elementwiseThreshold())
+            for (Nd4jLong e = 0; e < length; e++)
+                values[e] = static_cast<Nd4jLong>(buffer[e * ews]);
+        } else {
+#pragma omp parallel for schedule(static) if (length > Environment::getInstance()->elementwiseThreshold())
+            for (Nd4jLong e = 0; e < length; e++)
+                values[e] = static_cast<Nd4jLong>((*array)(e));
+        }
+
+        return new IndexArray(array->getShapeAsVector(), values);
+    }
+
+    bool IndexArray::isIntegerType(DataType dtype) {
+        switch (dtype) {
+            case DataType_INT8:
+            case DataType_INT16:
+            case DataType_INT32:
+            case DataType_INT64:
+            case DataType_UINT8:
+            case DataType_UINT16:
+            case DataType_UINT32:
+            case DataType_UINT64:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    IndexArray* IndexArray::fromFlatArray(const nd4j::graph::FlatArray* flatArray) {
+        auto dtype = DataTypeUtils::fromFlatDataType(flatArray->dtype());
+        if (!isIntegerType(dtype) || flatArray->buffer() == nullptr)
+            return nullptr;
+
+        std::vector<Nd4jLong> shapeInfoVec(flatArray->shape()->size());
+        memcpy(shapeInfoVec.data(), flatArray->shape()->data(), shapeInfoVec.size() * sizeof(Nd4jLong));
+        auto shapeInfo = shapeInfoVec.data();
+        if (shape::isEmpty(shapeInfo))
+            return nullptr;
+
+        auto rank = shape::rank(shapeInfo);
+        auto length = shape::length(shapeInfo);
+
+        auto order = ByteOrderUtils::fromFlatByteOrder(flatArray->byteOrder());
+        bool isBe = BitwiseUtils::isBE();
+        bool canKeep = (isBe && order == ByteOrder::BE) || (!isBe && order == ByteOrder::LE);
+
+        std::vector<Nd4jLong> raw(length);
+        auto src = flatArray->buffer()->data();
+        switch (dtype) {
+            case DataType_INT8: readIntegers<int8_t>(raw.data(), src, canKeep, length); break;
+            case DataType_INT16: readIntegers<int16_t>(raw.data(), src, canKeep, length); break;
+            case DataType_INT32: readIntegers<int32_t>(raw.data(), src, canKeep, length); break;
+            case DataType_INT64: readIntegers<int64_t>(raw.data(), src, canKeep, length); break;
+            case DataType_UINT8: readIntegers<uint8_t>(raw.data(), src, canKeep, length); break;
+            case DataType_UINT16: readIntegers<uint16_t>(raw.data(), src, canKeep, length); break;
+            case DataType_UINT32: readIntegers<uint32_t>(raw.data(), src, canKeep, length); break;
+            default: readIntegers<uint64_t>(raw.data(), src, canKeep, length); break;
+        }
+
+        std::vector<Nd4jLong> shape(shape::shapeOf(shapeInfo), shape::shapeOf(shapeInfo) + rank);
+        if (rank <= 1 || shape::order(shapeInfo) == 'c')
+            return new IndexArray(shape, raw);
+
+        // we keep indices in c order, so 'f' buffers are reordered once here
+        std::vector<Nd4jLong> values(length);
+        Nd4jLong idx[MAX_RANK];
+        for (Nd4jLong e = 0; e < length; e++) {
+            shape::ind2subC(rank, shape::shapeOf(shapeInfo), e, idx);
+            values[e] = raw[shape::getOffset(0, shape::shapeOf(shapeInfo), shape::stride(shapeInfo), idx, rank)];
+        }
+
+        return new IndexArray(shape, values);
+    }
+
+    Nd4jLong IndexArray::lengthOf() const {
+        return static_cast<Nd4jLong>(_values.size());
+    }
+
+    int IndexArray::rankOf() const {
+        return static_cast<int>(_shapeInfo[0]);
+    }
+
+    Nd4jLong IndexArray::sizeAt(int dim) const {
+        if (dim < 0)
+            dim += rankOf();
+
+        return _shapeInfo[dim + 1];
+    }
+
+    std::vector<Nd4jLong> IndexArray::getShapeAsVector() const {
+        return std::vector<Nd4jLong>(_shapeInfo.begin() + 1, _shapeInfo.begin() + 1 + rankOf());
+    }
+
+    Nd4jLong* IndexArray::getShapeInfo() const {
+        return const_cast<Nd4jLong *>(_shapeInfo.data());
+    }
+
+    bool IndexArray::isScalar() const {
+        return shape::isScalar(getShapeInfo());
+    }
+
+    bool IndexArray::isVector() const {
+        return !isScalar() && shape::isVector(getShapeInfo());
+    }
+
+    bool IndexArray::isInRange(Nd4jLong lower, Nd4jLong upper) const {
+        for (auto v: _values)
+            if (v < lower || v >= upper)
+                return false;
+
+        return true;
+    }
+
+    const Nd4jLong* IndexArray::buffer() const {
+        return _values.data();
+    }
+
+    template IndexArray* IndexArray::fromNDArray<float>(NDArray<float>* array);
+    template IndexArray* IndexArray::fromNDArray<float16>(NDArray<float16>* array);
+    template IndexArray* IndexArray::fromNDArray<double>(NDArray<double>* array);
+}
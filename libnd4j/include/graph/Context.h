@@ -137,6 +137,17 @@ namespace nd4j {
             Variable<T>* getVariable(int idx);
             Variable<T>* variable(int idx);
 
+            /**
+             * This method returns variable for a given input index, without debug output. Dense slot is used if available
+             */
+            Variable<T>* inputVariable(int idx);
+
+            /**
+             * This method returns exact integer values of given input. If input variable was restored
+             * from INT/LONG FlatArray, original values are used, otherwise NDArray is converted once
+             */
+            std::shared_ptr<IndexArray> getIndexArray(int idx);
+
 
             /**
              * This method fetches variable from Workspace DIRECTLY
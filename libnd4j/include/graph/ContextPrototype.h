@@ -31,6 +31,10 @@ namespace nd4j {
         protected:
             // int ids of the input nodes
             std::vector<std::pair<int, int>> _inputs;
+
+            // dense VariableSpace slots for inputs, assigned by Graph::buildGraph(). empty if graph wasn't built
+            std::vector<int> _inputSlots;
+
             int _nodeId;
             std::vector<T> _tArgs;
             std::vector<int> _iArgs;            
@@ -62,6 +66,9 @@ namespace nd4j {
             void fillInputs(std::vector<int>& inputs);
             std::vector<std::pair<int, int>>* inputs();
 
+            void setInputSlots(std::vector<int>& slots);
+            std::vector<int>* inputSlots();
+
             std::vector<T>* getTArguments();
             std::vector<int>* getIArguments();
 
@@ -37,6 +37,15 @@ namespace nd4j {
 
             template <typename T>
             static NDArray<T>* fromFlatArray(const nd4j::graph::FlatArray* flatArray);
+
+            /**
+             * This method creates NDArray view over FlatArray payload, without any copies.
+             * Returns nullptr if that's impossible: dtype or byte order don't match T, payload isn't aligned, or array is empty.
+             *
+             * PLEASE NOTE: FlatBuffer must outlive returned array
+             */
+            template <typename T>
+            static NDArray<T>* viewFromFlatArray(const nd4j::graph::FlatArray* flatArray);
         };
     }
 }
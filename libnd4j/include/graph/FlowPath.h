@@ -39,10 +39,18 @@ namespace nd4j {
             void ensureFrame(int nodeId);
 
             GraphProfile _profile;
+
+            bool _parallel = false;
         public:
             FlowPath() = default;
             ~FlowPath() = default;
 
+            // creates NodeState in advance, so concurrent executors won't modify _states
+            void registerNode(int nodeId);
+
+            // brings states of all known nodes back to defaults, without releasing them. frames are forgotten
+            void reset();
+
             void setInnerTime(int nodeId, Nd4jLong time);
             void setOuterTime(int nodeId, Nd4jLong time);
 
@@ -58,6 +66,10 @@ namespace nd4j {
             int branch(int nodeId);
             void markBranch(int nodeId, int index);
 
+            // true if last execution went through dependency-driven parallel scheduler
+            bool wasParallel();
+            void markParallel(bool wasParallel);
+
             // Frame-related methods
 
             void registerFrame(Nd4jLong frameId);
@@ -66,6 +66,28 @@ namespace nd4j {
             std::map<int, Scope<T> *> _mappedScopes;
             std::vector<Scope<T> *> _scopes;
 
+            // static memory plan: intermediate arrays are views into single arena
+            std::vector<int8_t> _arena;
+            std::vector<std::pair<int, int>> _plannedArrays;
+            std::vector<std::pair<int, int>> _plannedAliases;
+            std::vector<int> _plannedInplace;
+            // shapes of external inputs current plan was built for
+            std::vector<std::vector<Nd4jLong>> _planSignature;
+            bool _memoryPlanned = false;
+            // output shapes seen during last execution, and shapes of external inputs they were seen for
+            std::map<std::pair<int, int>, std::vector<Nd4jLong>> _recordedShapes;
+            std::vector<std::vector<Nd4jLong>> _recordedSignature;
+
+            // frozen graph can't be modified anymore, and its nodes might be shared between execution contexts
+            bool _frozen = false;
+            bool _shareable = false;
+
+            // if true, nodes, onion and maps belong to other (frozen) Graph instance
+            bool _shared = false;
+
+            // FlowPath reused by execution context between requests
+            FlowPath* _flowPath = nullptr;
+
 ////////////////////////////////////////
             Nd4jStatus validateNode(nd4j::graph::Node<T> *node);
 
@@ -78,8 +100,17 @@ namespace nd4j {
             void printOutNode(Node<T>* node);
 
             void prepareOutputs();
+
+            // this method assigns dense VariableSpace slots to inputs of all nodes
+            void assignSlots();
+
+            // this method collects nodes in execution order, and shapes of external inputs. returns false if graph can't be planned
+            bool plannableOrder(std::vector<Node<T>*> &order, std::vector<std::vector<Nd4jLong>> &signature);
         public:
-            Graph(const FlatGraph *flatGraph = nullptr, VariableSpace<T> *variableSpace = nullptr);
+            /**
+             * @param storage - if set, flatGraph lives in this file, and variables are created as views over it where possible
+             */
+            Graph(const FlatGraph *flatGraph = nullptr, VariableSpace<T> *variableSpace = nullptr, std::shared_ptr<MappedFile> storage = nullptr);
 
             ~Graph();
 
@@ -218,8 +249,68 @@ namespace nd4j {
              */
             void tagInplaceNodes();
 
+            /**
+             * This method rewrites single-consumer chains of legacy Transform/Scalar/PairwiseTransform nodes into single fused nodes.
+             * Fused node keeps id of the last node in chain, intermediate nodes are removed from graph.
+             *
+             * @return number of nodes removed
+             */
+            int fuseElementwiseChains();
+
+            /**
+             * This method builds static memory plan for OPTIMIZED forward-only execution:
+             * lifetimes of node outputs are derived from onion order, and outputs with non-overlapping lifetimes share memory within one arena.
+             * Nodes are switched to in-place execution if their op allows it and their input has no other consumers.
+             *
+             * Output shapes come from recordOutputShapes() if it was called for the same input shapes,
+             * or from calculateOutputShape() where it depends on input shapes only.
+             *
+             * @return true if graph has memory plan matching current inputs
+             */
+            bool planMemory();
+
+            /**
+             * This method remembers output shapes produced by last execution, so next planMemory() call with the same inputs
+             * can plan ops whose shapes can't be inferred upfront. Arrays in VariableSpace are left intact.
+             */
+            void recordOutputShapes();
+
+            /**
+             * This method drops memory plan, and detaches planned arrays from VariableSpace
+             */
+            void releaseMemoryPlan();
+
+            /**
+             * This method returns size of memory arena in bytes, or 0 if there's no memory plan
+             */
+            Nd4jLong plannedMemory();
+
             void replaceState(VariableSpace<T> *state, ExecutorConfiguration *configuration);
 
+            /**
+             * This method builds this graph and makes it immutable: nodes can't be added anymore,
+             * and memory planning won't switch nodes to in-place mode.
+             *
+             * @return true if nodes hold no per-execution state, so graph can be shared via cloneShared()
+             */
+            bool freeze();
+
+            bool isFrozen();
+
+            /**
+             * This method returns lightweight execution context of frozen shareable graph:
+             * nodes, onion and maps are shared with this graph, and only state (isolated VariableProxy, FlowPath, workspace) is owned by context.
+             *
+             * PLEASE NOTE: this graph must outlive all contexts created from it
+             */
+            Graph<T>* cloneShared();
+
+            /**
+             * This method drops inputs and results of previous execution, so this Graph can serve next request.
+             * Workspace and FlowPath are kept, so their memory is reused. Applicable to graphs backed by VariableProxy only.
+             */
+            void resetState();
+
             FORCEINLINE std::vector<int>* nodes() {
                 return _nodes;
             }
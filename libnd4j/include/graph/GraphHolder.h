@@ -24,6 +24,9 @@
 #include <graph/Graph.h>
 #include <helpers/SimpleReadWriteLock.h>
 #include <graph/exceptions/unknown_graph_exception.h>
+#include <graph/GraphSessions.h>
+#include <graph/InferenceBatcher.h>
+#include <mutex>
 
 namespace nd4j {
     namespace graph {
@@ -37,6 +40,37 @@ namespace nd4j {
 
             std::map<Nd4jLong, SimpleReadWriteLock> _locks;
 
+            // pools of execution contexts of registered graphs, created on first request
+            std::map<Nd4jLong, GraphSessions<float>*> _sessionsF;
+            std::map<Nd4jLong, GraphSessions<double>*> _sessionsD;
+            std::map<Nd4jLong, GraphSessions<float16>*> _sessionsH;
+
+            // batching policy per graph: max batch size (rows) and max delay (microseconds)
+            std::map<Nd4jLong, std::pair<int, Nd4jLong>> _batchingPolicy;
+            std::map<Nd4jLong, InferenceBatcher<float>*> _batchersF;
+            std::map<Nd4jLong, InferenceBatcher<double>*> _batchersD;
+            std::map<Nd4jLong, InferenceBatcher<float16>*> _batchersH;
+
+            std::mutex _mutexSessions;
+
+            template <typename T>
+            std::map<Nd4jLong, GraphSessions<T>*>& sessionsMap();
+
+            template <typename T>
+            std::map<Nd4jLong, InferenceBatcher<T>*>& batchersMap();
+
+            template <typename T>
+            GraphSessions<T>* sessionsFor(Nd4jLong graphId);
+
+            template <typename T>
+            InferenceBatcher<T>* batcherFor(Nd4jLong graphId);
+
+            template <typename T>
+            void dropSessions(Nd4jLong graphId);
+
+            template <typename T>
+            flatbuffers::Offset<FlatResult> executeT(Nd4jLong graphId, flatbuffers::FlatBufferBuilder &builder, const FlatInferenceRequest* request);
+
             GraphHolder() = default;
             ~GraphHolder() = default;
         public:
@@ -66,8 +100,36 @@ namespace nd4j {
             bool hasGraphAny(Nd4jLong graphId);
 
 
+            /**
+             * This method executes inference request against graph of any data type.
+             * Each call borrows execution context from the pool of this graph, so concurrent calls are isolated from each other.
+             * If batching is enabled for this graph, concurrent requests might be executed as single batch.
+             */
             flatbuffers::Offset<FlatResult> execute(Nd4jLong graphId, flatbuffers::FlatBufferBuilder &builder, const FlatInferenceRequest* request);
 
+            /**
+             * This method enables coalescing of concurrent requests along leading dimension for specified graph
+             *
+             * @param maxBatchSize - max number of rows in single batch
+             * @param maxDelayMicros - max time first request in batch waits for other requests
+             */
+            void enableBatching(Nd4jLong graphId, int maxBatchSize, Nd4jLong maxDelayMicros);
+
+            void disableBatching(Nd4jLong graphId);
+
+            bool isBatching(Nd4jLong graphId);
+
+            /**
+             * This method returns number of execution contexts created for given graph, i.e. peak number of concurrent requests
+             */
+            int numberOfSessions(Nd4jLong graphId);
+
+            /**
+             * These methods return number of batches executed for given graph, and number of requests served by them
+             */
+            Nd4jLong numberOfBatches(Nd4jLong graphId);
+            Nd4jLong numberOfBatchedRequests(Nd4jLong graphId);
+
             template <typename T>
             void replaceGraph(Nd4jLong graphId, Graph<T>* graph);
 
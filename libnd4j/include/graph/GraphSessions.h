@@ -0,0 +1,88 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#ifndef LIBND4J_GRAPHSESSIONS_H
+#define LIBND4J_GRAPHSESSIONS_H
+
+#include <vector>
+#include <mutex>
+#include <graph/Graph.h>
+
+namespace nd4j {
+    namespace graph {
+        /**
+         * This class holds pool of execution contexts for a single registered Graph.
+         * Registered graph gets frozen, and if its nodes are stateless, every context shares them,
+         * owning only isolated VariableProxy, FlowPath and workspace. Otherwise context is a full clone of the graph.
+         *
+         * Contexts are reset and returned to the pool after each request, so nothing is rebuilt per request,
+         * and number of contexts is bounded by number of concurrent requests.
+         */
+        template <typename T>
+        class GraphSessions {
+        protected:
+            Graph<T>* _origin;
+            bool _shareable;
+
+            // all contexts created so far, and the ones not used by any request right now
+            std::vector<Graph<T>*> _contexts;
+            std::vector<Graph<T>*> _idle;
+
+            std::mutex _mutex;
+        public:
+            explicit GraphSessions(Graph<T>* origin);
+            ~GraphSessions();
+
+            /**
+             * This method returns execution context not used by any other request, creating it if pool is empty.
+             * Context must be given back via release() once results are consumed.
+             */
+            Graph<T>* acquire();
+
+            /**
+             * This method drops request state of given context and puts it back into pool
+             */
+            void release(Graph<T>* context);
+
+            /**
+             * This method returns true if contexts share nodes of registered graph
+             */
+            bool isShared();
+
+            int numberOfSessions();
+        };
+
+        /**
+         * This class holds single context acquired from GraphSessions, and gives it back once out of scope
+         */
+        template <typename T>
+        class SessionLease {
+        protected:
+            GraphSessions<T>* _sessions;
+            Graph<T>* _context;
+        public:
+            explicit SessionLease(GraphSessions<T>* sessions) : _sessions(sessions), _context(sessions->acquire()) { }
+            ~SessionLease() { _sessions->release(_context); }
+
+            SessionLease(const SessionLease&) = delete;
+            SessionLease& operator=(const SessionLease&) = delete;
+
+            Graph<T>* graph() { return _context; }
+        };
+    }
+}
+
+#endif //LIBND4J_GRAPHSESSIONS_H
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#ifndef LIBND4J_INFERENCEBATCHER_H
+#define LIBND4J_INFERENCEBATCHER_H
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <graph/Variable.h>
+#include <graph/GraphSessions.h>
+#include <graph/generated/request_generated.h>
+#include <graph/generated/result_generated.h>
+
+namespace nd4j {
+    namespace graph {
+        /**
+         * This class coalesces concurrent inference requests for the same graph along leading dimension.
+         *
+         * First request in queue becomes batch leader: it waits until either maxBatchSize rows are queued,
+         * or maxDelay microseconds pass, then executes the whole batch once, and splits results back.
+         * Requests are merged only if they provide the same inputs with the same trailing shapes.
+         * Outputs whose leading dimension doesn't match batch size are returned to every request as is.
+         *
+         * PLEASE NOTE: batching is only valid for graphs that treat rows independently
+         */
+        template <typename T>
+        class InferenceBatcher {
+        protected:
+            struct PendingRequest {
+                std::vector<Variable<T>*> inputs;
+                std::vector<Variable<T>*> outputs;
+
+                // shared leading dimension of all inputs, or -1 if request can't be merged with others
+                Nd4jLong rows = -1;
+
+                Nd4jStatus status = ND4J_STATUS_OK;
+                bool done = false;
+            };
+
+            GraphSessions<T>* _sessions;
+
+            int _maxBatchSize;
+            Nd4jLong _maxDelay;
+
+            std::deque<PendingRequest*> _queue;
+            bool _collecting = false;
+
+            std::mutex _mutex;
+            std::condition_variable _condition;
+
+            std::atomic<Nd4jLong> _batches;
+            std::atomic<Nd4jLong> _requests;
+
+            static bool compatible(PendingRequest* first, PendingRequest* second);
+
+            Nd4jLong queuedRows();
+            std::vector<PendingRequest*> takeBatch();
+            Nd4jStatus executeBatch(std::vector<PendingRequest*>& batch);
+        public:
+            InferenceBatcher(GraphSessions<T>* sessions, int maxBatchSize, Nd4jLong maxDelayMicros);
+            ~InferenceBatcher() = default;
+
+            /**
+             * This method blocks until request is executed as part of some batch, and writes its results to builder
+             */
+            flatbuffers::Offset<FlatResult> execute(flatbuffers::FlatBufferBuilder &builder, const FlatInferenceRequest* request);
+
+            int maxBatchSize();
+            Nd4jLong maxDelay();
+
+            /**
+             * These methods return number of executed batches, and number of requests served by them
+             */
+            Nd4jLong numberOfBatches();
+            Nd4jLong numberOfRequests();
+        };
+    }
+}
+
+#endif //LIBND4J_INFERENCEBATCHER_H
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// This class holds FlatBuffers file contents for zero-copy graph loading.
+//
+// On POSIX systems file is mmapped privately: pages are shared with page cache (and with other processes mapping
+// the same file) until somebody writes to them. On other platforms file is read into heap memory instead.
+//
+
+#ifndef LIBND4J_MAPPEDFILE_H
+#define LIBND4J_MAPPEDFILE_H
+
+#include <pointercast.h>
+#include <dll.h>
+#include <cstdint>
+#include <cstddef>
+
+namespace nd4j {
+    namespace graph {
+        class ND4J_EXPORT MappedFile {
+        private:
+            uint8_t* _data = nullptr;
+            size_t _length = 0;
+            bool _mapped = false;
+
+        public:
+            /**
+             * This constructor maps given file, and throws std::runtime_error if that's impossible
+             */
+            explicit MappedFile(const char *filename);
+            ~MappedFile();
+
+            MappedFile(const MappedFile& other) = delete;
+            MappedFile& operator=(const MappedFile& other) = delete;
+
+            uint8_t* data() const;
+            size_t length() const;
+
+            /**
+             * This method returns true if file contents are backed by page cache, and false if they were copied to heap
+             */
+            bool isMapped() const;
+        };
+    }
+}
+
+#endif //LIBND4J_MAPPEDFILE_H
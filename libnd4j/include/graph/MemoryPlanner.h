@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// This class assigns offsets within single arena to buffers with known sizes and lifetimes.
+//
+// Lifetime is the inclusive range of execution steps, buffer is written at first step and read up to last one.
+// Buffers with non-overlapping lifetimes may share memory. Placement is greedy: largest buffers go first,
+// each one takes the smallest gap left between already placed buffers it overlaps with in time.
+//
+
+#ifndef LIBND4J_MEMORYPLANNER_H
+#define LIBND4J_MEMORYPLANNER_H
+
+#include <pointercast.h>
+#include <dll.h>
+#include <vector>
+
+namespace nd4j {
+    namespace graph {
+        class ND4J_EXPORT MemoryPlanner {
+        private:
+            struct PlannedBuffer {
+                Nd4jLong bytes;
+                int firstStep;
+                int lastStep;
+                Nd4jLong offset;
+            };
+
+            std::vector<PlannedBuffer> _buffers;
+            Nd4jLong _arenaSize = 0;
+            Nd4jLong _alignment;
+
+        public:
+            explicit MemoryPlanner(Nd4jLong alignment = 64);
+            ~MemoryPlanner() = default;
+
+            /**
+             * This method registers buffer, alive within [firstStep, lastStep] range
+             * @return id of this buffer
+             */
+            int addBuffer(Nd4jLong bytes, int firstStep, int lastStep);
+
+            /**
+             * This method extends lifetime of given buffer, i.e. when it's reused by in-place op
+             */
+            void extendBuffer(int bufferId, int lastStep);
+
+            /**
+             * This method assigns offsets to all registered buffers
+             * @return arena size in bytes
+             */
+            Nd4jLong plan();
+
+            Nd4jLong offset(int bufferId) const;
+            Nd4jLong arenaSize() const;
+
+            /**
+             * This method returns sum of all buffer sizes, i.e. memory required without any reuse
+             */
+            Nd4jLong totalSize() const;
+
+            int numberOfBuffers() const;
+        };
+    }
+}
+
+#endif //LIBND4J_MEMORYPLANNER_H
@@ -22,8 +22,11 @@
 #define LIBND4J_VARIABLE_H
 
 #include <string>
+#include <memory>
 #include <NDArray.h>
 #include <array/NDArrayList.h>
+#include <array/IndexArray.h>
+#include <graph/MappedFile.h>
 #include <graph/VariableType.h>
 #include <graph/generated/array_generated.h>
 #include <graph/generated/node_generated.h>
@@ -44,6 +47,9 @@ namespace nd4j {
             bool _placeholder = false;
             bool _removable = true;
 
+            // true if NDArray is a view into Graph memory arena, assigned by memory planner
+            bool _planned = false;
+
             // for now we're setting default to numeric
             // in future we'll be fetching it right from the array, 
             //InputType _variableType = InputType_UNDEFINED;
@@ -51,6 +57,12 @@ namespace nd4j {
 
             nd4j::NDArrayList<T>* _list = nullptr;
 
+            // exact integer values, if this variable was restored from INT/LONG FlatArray
+            std::shared_ptr<nd4j::IndexArray> _indices;
+
+            // mapped file our NDArray points into, if it was restored without copy
+            std::shared_ptr<nd4j::graph::MappedFile> _storage;
+
             VariableType _variableType = VariableType::NDARRAY;
             
         public:
@@ -58,6 +70,12 @@ namespace nd4j {
             Variable(nd4j::NDArray<T> *arrayw, const char *name, int id, int idx = 0);
             Variable(nd4j::NDArray<T> *array = nullptr, const char *name = nullptr);
             Variable(const nd4j::graph::FlatVariable *flatVariable);
+
+            /**
+             * This constructor creates NDArray as a view over FlatVariable payload if possible, and keeps storage alive while view exists.
+             * Falls back to regular copy if payload has to be converted
+             */
+            Variable(const nd4j::graph::FlatVariable *flatVariable, std::shared_ptr<nd4j::graph::MappedFile> storage);
             ~Variable();
 
             Variable<T>* clone();
@@ -73,10 +91,20 @@ namespace nd4j {
             nd4j::NDArrayList<T>* getNDArrayList();
             void setNDArrayList(nd4j::NDArrayList<T>* list);
 
+            bool hasIndexArray();
+            std::shared_ptr<nd4j::IndexArray> getIndexArray();
+            void setIndexArray(std::shared_ptr<nd4j::IndexArray> indices);
+
+            /**
+             * This method returns mapped file this variable is a view of, or nullptr if NDArray owns its buffer
+             */
+            std::shared_ptr<nd4j::graph::MappedFile> getStorage();
+
             bool isExternal();
             bool isReadOnly();
             bool isEmpty();
             bool isRemovable();
+            bool isPlanned();
 
             bool isPlaceholder();
 
@@ -93,6 +121,7 @@ namespace nd4j {
             void markExternal(bool reallyExternal);
             void markReadOnly(bool reallyReadOnly);
             void markRemovable(bool reallyRemovable);
+            void markPlanned(bool reallyPlanned);
 
             int id();
             int index();
@@ -27,10 +27,21 @@ namespace nd4j {
         protected:
             VariableSpace<T>* _backed = nullptr;
             VariableSpace<T>* _current = nullptr;
+
+            // isolated proxy exposes only inputs and external variables of backing VariableSpace, so results of concurrent proxies never meet
+            bool _isolated = false;
+
+            bool isVisible(Variable<T>* variable);
         public:
-            explicit VariableProxy(VariableSpace<T>* reference);
+            explicit VariableProxy(VariableSpace<T>* reference, bool isolated = false);
             ~VariableProxy();
 
+            /**
+             * This method drops all variables stored in this proxy, and recycles workspace memory.
+             * Backing VariableSpace stays intact.
+             */
+            void reset();
+
             virtual VariableSpace<T>& operator=(const VariableSpace<T>& other);
 
             virtual int numberOfPlaceholders();
@@ -56,6 +67,10 @@ namespace nd4j {
 
             virtual std::vector<Variable<T>*> getVariables();
 
+            virtual int registerSlot(std::pair<int,int>& pair);
+            virtual int numberOfSlots();
+            virtual nd4j::graph::Variable<T> *getSlotVariable(int slot, std::pair<int,int>& pair);
+
             virtual void putVariable(std::pair<int,int>& pair, NDArray<T> *array);
             virtual void putVariable(std::pair<int,int>& pair, Variable<T> *variable);
             virtual void putVariable(int id, Variable<T> *variable);
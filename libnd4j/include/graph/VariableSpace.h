@@ -28,6 +28,7 @@
 #include <list>
 #include <map>
 #include <mutex>
+#include <atomic>
 #include <NDArray.h>
 #include <array/NDArrayList.h>
 #include <graph/Variable.h>
@@ -63,7 +64,8 @@ namespace nd4j {
 
             int _auto_counter = -1;
 
-            std::mutex _varmap;
+            // recursive, since put/has/get methods call each other
+            std::recursive_mutex _varmap;
 
             std::map<int, nd4j::graph::Variable<T> *> _temporary;
 
@@ -71,6 +73,13 @@ namespace nd4j {
 
             FlowPath* _flow = nullptr;
 
+            // dense slots: (nodeId, outputIdx) -> slot index, assigned once graph is built
+            std::map<std::pair<int, int>, int> _slotIds;
+            std::vector<std::pair<int, int>> _slotPairs;
+            std::vector<std::atomic<Variable<T> *>> _slots;
+
+            void invalidateSlot(std::pair<int,int>& pair);
+
         public:
             VariableSpace();
             virtual ~VariableSpace();
@@ -101,6 +110,18 @@ namespace nd4j {
 
             virtual std::vector<Variable<T>*> getVariables();
 
+            /**
+             * This method assigns dense slot to the given variable address, and returns slot index.
+             * Returns -1 if address can't be slotted
+             */
+            virtual int registerSlot(std::pair<int,int>& pair);
+            virtual int numberOfSlots();
+
+            /**
+             * This method returns variable stored at given slot, or nullptr if slot doesn't match pair or variable doesn't exist
+             */
+            virtual nd4j::graph::Variable<T> *getSlotVariable(int slot, std::pair<int,int>& pair);
+
             virtual void putVariable(std::pair<int,int>& pair, NDArray<T> *array);
             virtual void putVariable(std::pair<int,int>& pair, Variable<T> *variable);
             virtual void putVariable(int id, Variable<T> *variable);
@@ -33,6 +33,8 @@ namespace nd4j {
                     this->_inputs.push_back(v);
                 }
 
+                this->_inputSlots = *(prototype->inputSlots());
+
                 for (const auto &v: *(prototype->getTArguments())) {
                     this->_tArgs.push_back(v);
                 }
@@ -206,9 +208,7 @@ namespace nd4j {
                 throw std::runtime_error("Bad index");
             }
 
-            auto p = this->_inputs[idx];
-
-            auto v = variable(p);
+            auto v = inputVariable(idx);
 
             if (Environment::getInstance()->isDebugAndVerbose() && v != nullptr &&  v->getNDArray() != nullptr) {
                 auto array = v->getNDArray();
@@ -226,6 +226,29 @@ namespace nd4j {
             return v;
         }
 
+        template <typename T>
+        std::shared_ptr<IndexArray> Context<T>::getIndexArray(int idx) {
+            auto v = getVariable(idx);
+            if (v->hasIndexArray())
+                return v->getIndexArray();
+
+            return std::shared_ptr<IndexArray>(IndexArray::fromNDArray<T>(v->getNDArray()));
+        }
+
+        template <typename T>
+        Variable<T>* Context<T>::inputVariable(int idx) {
+            auto &p = this->_inputs[idx];
+
+            // built graph provides dense slots, so we can skip map lookups
+            if (idx < this->_inputSlots.size()) {
+                auto v = _variableSpace->getSlotVariable(this->_inputSlots[idx], p);
+                if (v != nullptr)
+                    return v;
+            }
+
+            return variable(p);
+        }
+
         template <typename T>
         Variable<T>* Context<T>::variable(int idx) {
             return getVariable(idx);
@@ -58,6 +58,16 @@ namespace nd4j {
             return &_inputs;
         }
 
+        template <typename T>
+        void ContextPrototype<T>::setInputSlots(std::vector<int>& slots) {
+            _inputSlots = slots;
+        }
+
+        template <typename T>
+        std::vector<int>* ContextPrototype<T>::inputSlots() {
+            return &_inputSlots;
+        }
+
         template <typename T>
         void ContextPrototype<T>::fillInputs(std::vector<int>& inputs) {
             for (int e = 0; e < inputs.size(); e++) {
@@ -154,6 +164,8 @@ namespace nd4j {
             for (auto v: _inputs)
                 clone->_inputs.emplace_back(v);
 
+            clone->_inputSlots = _inputSlots;
+
             for (auto v: _tArgs)
                 clone->_tArgs.emplace_back(v);
 
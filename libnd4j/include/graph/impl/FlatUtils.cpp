@@ -58,9 +58,42 @@ namespace nd4j {
             return array;
         }
 
+        template<typename T>
+        NDArray<T> *FlatUtils::viewFromFlatArray(const nd4j::graph::FlatArray *flatArray) {
+            if (flatArray->buffer() == nullptr || DataTypeUtils::fromFlatDataType(flatArray->dtype()) != DataTypeUtils::fromT<T>())
+                return nullptr;
+
+            auto order = ByteOrderUtils::fromFlatByteOrder(flatArray->byteOrder());
+            if (order != BitwiseUtils::asByteOrder())
+                return nullptr;
+
+            auto buffer = reinterpret_cast<T *>(const_cast<int8_t *>(flatArray->buffer()->data()));
+            if (reinterpret_cast<uintptr_t>(buffer) % sizeof(T) != 0)
+                return nullptr;
+
+            auto rank = static_cast<int>(flatArray->shape()->Get(0));
+            auto newShape = new Nd4jLong[shape::shapeInfoLength(rank)];
+            memcpy(newShape, flatArray->shape()->data(), shape::shapeInfoByteLength(rank));
+
+            if (shape::isEmpty(newShape) || flatArray->buffer()->size() < shape::length(newShape) * sizeof(T)) {
+                delete[] newShape;
+                return nullptr;
+            }
+
+            // buffer belongs to FlatBuffer, only shape is ours
+            auto array = new NDArray<T>(buffer, newShape);
+            array->triggerAllocationFlag(false, true);
+
+            return array;
+        }
+
 
         template NDArray<float> *FlatUtils::fromFlatArray<float>(const nd4j::graph::FlatArray *flatArray);
         template NDArray<float16> *FlatUtils::fromFlatArray<float16>(const nd4j::graph::FlatArray *flatArray);
         template NDArray<double> *FlatUtils::fromFlatArray<double>(const nd4j::graph::FlatArray *flatArray);
+
+        template NDArray<float> *FlatUtils::viewFromFlatArray<float>(const nd4j::graph::FlatArray *flatArray);
+        template NDArray<float16> *FlatUtils::viewFromFlatArray<float16>(const nd4j::graph::FlatArray *flatArray);
+        template NDArray<double> *FlatUtils::viewFromFlatArray<double>(const nd4j::graph::FlatArray *flatArray);
     }
 }
\ No newline at end of file
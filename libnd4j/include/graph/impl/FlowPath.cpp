@@ -37,6 +37,18 @@ namespace nd4j {
             }
         }
 
+        void FlowPath::registerNode(int nodeId) {
+            ensureNode(nodeId);
+        }
+
+        void FlowPath::reset() {
+            for (auto &v: _states)
+                v.second = NodeState(v.first);
+
+            _frames.clear();
+            _parallel = false;
+        }
+
         void FlowPath::setInnerTime(int nodeId, Nd4jLong time) {
             ensureNode(nodeId);
 
@@ -144,6 +156,14 @@ namespace nd4j {
             _states[nodeId].markExecuted(wasExecuted);
         }
 
+        bool FlowPath::wasParallel() {
+            return _parallel;
+        }
+
+        void FlowPath::markParallel(bool wasParallel) {
+            _parallel = wasParallel;
+        }
+
         GraphProfile* FlowPath::profile() {
             return &_profile;
         }
@@ -26,6 +26,9 @@
 #include <helpers/ShapeUtils.h>
 #include <ops/declarable/OpRegistrator.h>
 #include <graph/VariableProxy.h>
+#include <ops/declarable/LegacyFusedOp.h>
+#include <ops/declarable/DeclarableListOp.h>
+#include <graph/MemoryPlanner.h>
 
 namespace nd4j {
     namespace graph {
@@ -288,24 +291,30 @@ namespace nd4j {
 
         template <typename T>
         Graph<T>::~Graph() {
-            for (auto &v: *_mapped)
-                delete v.second;
+            // arena views have to leave VariableSpace before it's gone
+            releaseMemoryPlan();
 
-            for (auto &v: _unmapped)
-                delete v.second;
+            if (!_shared) {
+                for (auto &v: *_mapped)
+                    delete v.second;
 
-            for (auto &v: *_onion)
-                delete v.second;
+                for (auto &v: *_onion)
+                    delete v.second;
 
+                delete _mapped;
+                delete _nodes;
+                delete _onion;
+            }
+
+            for (auto &v: _unmapped)
+                delete v.second;
 
             for (auto v: _scopes)
                 delete v;
 
-            delete _mapped;
-            delete _nodes;
             delete _variableSpace;
-            delete _onion;
             delete _configuration;
+            delete _flowPath;
 
 
             // delete _onion content here
@@ -313,6 +322,9 @@ namespace nd4j {
 
         template <typename T>
         void Graph<T>::addNode(Node<T> *node) {
+            if (_frozen)
+                throw std::runtime_error("Nodes can't be added to frozen Graph");
+
             _built.store(false);
 
             if (node->opType() == OpType_LOGIC) {
@@ -722,14 +734,36 @@ namespace nd4j {
                 }
             }
 
-            if (_unmapped.size() == 0)
+            if (_unmapped.size() == 0) {
+                // same requirements as for in-place execution: nobody is going to look at intermediate results
+                if (_configuration->_direction == Direction_FORWARD_ONLY && _configuration->_outputMode == OutputMode_OPTIMIZED)
+                    fuseElementwiseChains();
+
+                assignSlots();
                 _built.store(true);
+            }
 
             prepareOutputs();
 
             return ND4J_STATUS_OK;
         }
 
+        template <typename T>
+        void Graph<T>::assignSlots() {
+            for (auto &v: *_mapped) {
+                auto node = v.second;
+                if (!node->hasBlockAttached())
+                    continue;
+
+                auto block = node->getContextPrototype();
+                std::vector<int> slots(block->width());
+                for (int e = 0; e < block->width(); e++)
+                    slots[e] = _variableSpace->registerSlot(*block->input(e));
+
+                block->setInputSlots(slots);
+            }
+        }
+
         template <typename T>
         void Graph<T>::tagInplaceNodes() {
             // just calling, in case it wasn't built before
@@ -808,6 +842,461 @@ namespace nd4j {
             }
         }
 
+        template <typename T>
+        int Graph<T>::fuseElementwiseChains() {
+            // number of times each node is used as input anywhere in the graph
+            std::map<int, int> consumers;
+            for (auto &v: *_mapped)
+                for (auto &p: *v.second->input())
+                    consumers[p.first]++;
+
+            auto isCandidate = [&] (Node<T>* node) -> bool {
+                if (!node->hasCustomOp() || !node->hasBlockAttached() || node->hasGraphEmbedded() || node->isScoped() || !node->isActive())
+                    return false;
+
+                // fused nodes are never fused again
+                if (dynamic_cast<nd4j::ops::LegacyFusedOp<T>*>(node->getCustomOp()) != nullptr)
+                    return false;
+
+                auto width = node->input()->size();
+                switch (node->opType()) {
+                    case OpType_TRANSFORM:
+                        if (width != 1)
+                            return false;
+                        break;
+                    case OpType_SCALAR:
+                        if (width < 1 || width > 2)
+                            return false;
+                        break;
+                    case OpType_PAIRWISE:
+                        if (width != 2)
+                            return false;
+                        break;
+                    default:
+                        return false;
+                }
+
+                auto proto = node->getContextPrototype();
+                int opNum = proto->opNum() < 0 ? (int) node->opNum() : proto->opNum();
+                return nd4j::ops::LegacyFusedOp<T>::isFusable(node->opType(), opNum);
+            };
+
+            // returns position of the input, which can be absorbed into given node, or -1 if there's none
+            auto absorbable = [&] (Node<T>* node) -> int {
+                // scalar op can only take chain value as its array operand
+                int positions = node->opType() == OpType_PAIRWISE ? 2 : 1;
+                for (int e = 0; e < positions; e++) {
+                    auto &p = node->input()->at(e);
+                    if (p.second != 0 || _mapped->count(p.first) == 0 || consumers[p.first] != 1)
+                        continue;
+
+                    // results requested by user must survive
+                    if (std::find(_output.begin(), _output.end(), p.first) != _output.end())
+                        continue;
+
+                    auto parent = _mapped->at(p.first);
+                    if (!isCandidate(parent) || parent->hasExternalOutputs())
+                        continue;
+
+                    return e;
+                }
+
+                return -1;
+            };
+
+            // tails are picked first, so each chain is collected in full
+            std::vector<int> order;
+            for (auto &l: *_onion)
+                for (auto node: *l.second)
+                    order.emplace_back(node->id());
+
+            int removed = 0;
+            for (auto it = order.rbegin(); it != order.rend(); ++it) {
+                if (_mapped->count(*it) == 0)
+                    continue;
+
+                auto tail = _mapped->at(*it);
+                if (!isCandidate(tail))
+                    continue;
+
+                // links[e] is position of chain[e + 1] among inputs of chain[e], while we walk from tail to head
+                std::vector<Node<T>*> chain({tail});
+                std::vector<int> links;
+                int pos;
+                auto current = tail;
+                while ((pos = absorbable(current)) >= 0) {
+                    links.emplace_back(pos);
+                    current = _mapped->at(current->input()->at(pos).first);
+                    chain.emplace_back(current);
+                }
+
+                if (chain.size() < 2)
+                    continue;
+
+                std::reverse(chain.begin(), chain.end());
+                std::reverse(links.begin(), links.end());
+
+                std::vector<std::pair<int, int>> inputs;
+                std::vector<nd4j::ops::FusedStage<T>> stages;
+                for (size_t e = 0; e < chain.size(); e++) {
+                    auto node = chain[e];
+                    auto proto = node->getContextPrototype();
+                    auto tArgs = proto->getTArguments();
+
+                    nd4j::ops::FusedStage<T> stage;
+                    stage.opType = node->opType();
+                    stage.opNum = proto->opNum() < 0 ? (int) node->opNum() : proto->opNum();
+                    stage.scalar = node->scalar();
+                    stage.operand = -1;
+                    stage.operandFirst = false;
+                    stage.extraParams = *tArgs;
+
+                    // position of chain value among node inputs. first stage takes fused input 0
+                    int link = e == 0 ? 0 : links[e - 1];
+                    if (e == 0)
+                        inputs.emplace_back(node->input()->at(0));
+
+                    if (node->input()->size() > 1) {
+                        stage.operand = static_cast<int>(inputs.size());
+                        stage.operandFirst = link == 1;
+                        inputs.emplace_back(node->input()->at(1 - link));
+                    } else if (stage.opType == OpType_SCALAR && !tArgs->empty()) {
+                        // same convention as LegacyScalarOp: first TArg is scalar, the rest are extras
+                        stage.scalar = tArgs->at(0);
+                        stage.extraParams.erase(stage.extraParams.begin());
+                    }
+
+                    stages.emplace_back(stage);
+                }
+
+                // tail node becomes fused node, so consumers of the chain don't notice anything
+                auto proto = tail->getContextPrototype();
+                tail->input()->clear();
+                proto->inputs()->clear();
+                for (auto &p: inputs) {
+                    tail->pickInput(p);
+                    proto->inputs()->emplace_back(p);
+                }
+
+                if (!proto->inputSlots()->empty()) {
+                    std::vector<int> slots;
+                    for (auto &p: inputs)
+                        slots.emplace_back(_variableSpace->registerSlot(p));
+
+                    proto->setInputSlots(slots);
+                }
+
+                if (tail->isDeductable())
+                    delete tail->getCustomOp();
+
+                tail->setCustomOp(new nd4j::ops::LegacyFusedOp<T>(stages));
+                tail->setDeductable(true);
+
+                for (size_t e = 0; e < chain.size() - 1; e++) {
+                    auto node = chain[e];
+                    auto layer = _onion->at(node->getLayer());
+                    layer->erase(std::remove(layer->begin(), layer->end(), node), layer->end());
+                    _nodes->erase(std::remove(_nodes->begin(), _nodes->end(), node->id()), _nodes->end());
+                    _handles.erase(std::remove(_handles.begin(), _handles.end(), node), _handles.end());
+                    _mapped->erase(node->id());
+
+                    // nothing produces this variable anymore
+                    _variableSpace->dropVariable(node->id(), 0);
+
+                    delete node;
+                    removed++;
+                }
+
+                nd4j_debug("Node_%i: %i elementwise nodes fused\n", tail->id(), (int) chain.size());
+            }
+
+            return removed;
+        }
+
+        template <typename T>
+        bool Graph<T>::plannableOrder(std::vector<Node<T>*> &order, std::vector<std::vector<Nd4jLong>> &signature) {
+            if (!_built.load())
+                buildGraph();
+
+            if (_configuration->_direction != Direction_FORWARD_ONLY || _configuration->_outputMode != OutputMode_OPTIMIZED)
+                return false;
+
+            // execution contexts recycle memory via own workspace
+            if (_shared)
+                return false;
+
+            // nodes in execution order
+            for (auto &l: *_onion)
+                for (auto node: *l.second) {
+                    // frames, rewinds and embedded graphs don't have linear lifetimes
+                    if (node->opType() == OpType_LOGIC || node->opType() == OpType_BOOLEAN || node->isScoped() || node->hasGraphEmbedded() || !node->hasCustomOp())
+                        return false;
+
+                    // list ops produce NDArrayLists, not arrays
+                    if (dynamic_cast<nd4j::ops::DeclarableListOp<T>*>(node->getCustomOp()) != nullptr)
+                        return false;
+
+                    order.emplace_back(node);
+                }
+
+            // plan stays valid as long as external inputs keep their shapes
+            for (auto node: order)
+                for (auto &p: *node->input()) {
+                    if (_mapped->count(p.first) > 0)
+                        continue;
+
+                    // placeholders weren't fed yet
+                    if (!_variableSpace->hasVariable(p) || !_variableSpace->getVariable(p)->hasNDArray())
+                        return false;
+
+                    auto shapeInfo = _variableSpace->getVariable(p)->getNDArray()->shapeInfo();
+                    signature.emplace_back(std::vector<Nd4jLong>(shapeInfo, shapeInfo + shape::shapeInfoLength(shapeInfo)));
+                }
+
+            return true;
+        }
+
+        template <typename T>
+        void Graph<T>::recordOutputShapes() {
+            std::vector<Node<T>*> order;
+            std::vector<std::vector<Nd4jLong>> signature;
+            if (!plannableOrder(order, signature))
+                return;
+
+            _recordedShapes.clear();
+            _recordedSignature = signature;
+
+            for (auto node: order)
+                for (int k = 0; ; k++) {
+                    std::pair<int, int> pair(node->id(), k);
+                    if (!_variableSpace->hasVariable(pair) || !_variableSpace->getVariable(pair)->hasNDArray())
+                        break;
+
+                    auto shapeInfo = _variableSpace->getVariable(pair)->getNDArray()->shapeInfo();
+                    _recordedShapes[pair] = std::vector<Nd4jLong>(shapeInfo, shapeInfo + shape::shapeInfoLength(shapeInfo));
+                }
+        }
+
+        template <typename T>
+        bool Graph<T>::planMemory() {
+            std::vector<Node<T>*> order;
+            std::vector<std::vector<Nd4jLong>> signature;
+            if (!plannableOrder(order, signature))
+                return false;
+
+            if (_memoryPlanned) {
+                if (signature == _planSignature)
+                    return true;
+
+                releaseMemoryPlan();
+            }
+
+            // shapes seen at previous run are valid only for the same inputs
+            bool recorded = !_recordedShapes.empty() && signature == _recordedSignature;
+
+            // last step each output is read at
+            std::map<std::pair<int, int>, int> lastUse;
+            std::map<std::pair<int, int>, int> consumers;
+            for (int e = 0; e < (int) order.size(); e++)
+                for (auto &p: *order[e]->input()) {
+                    lastUse[p] = e;
+                    consumers[p]++;
+                }
+
+            const int end = static_cast<int>(order.size());
+            std::map<std::pair<int, int>, std::vector<Nd4jLong>> shapes;
+            std::map<std::pair<int, int>, int> buffers;
+            std::vector<std::pair<int, int>> aliases;
+            std::vector<int> inplace;
+            MemoryPlanner planner;
+
+            for (int e = 0; e < end; e++) {
+                auto node = order[e];
+                auto op = node->getCustomOp();
+                std::vector<std::vector<Nd4jLong>> outShapes;
+
+                if (recorded) {
+                    for (int k = 0; _recordedShapes.count(std::pair<int, int>(node->id(), k)) > 0; k++)
+                        outShapes.emplace_back(_recordedShapes[std::pair<int, int>(node->id(), k)]);
+                }
+
+                if (outShapes.empty()) {
+                    // shape functions of custom ops may look into input values, and those don't exist before execution
+                    bool valuesKnown = true;
+                    std::vector<Nd4jLong*> inputShapes;
+                    for (auto &p: *node->input()) {
+                        if (shapes.count(p) > 0) {
+                            inputShapes.emplace_back(shapes[p].data());
+                            valuesKnown = false;
+                        } else if (_mapped->count(p.first) == 0) {
+                            inputShapes.emplace_back(_variableSpace->getVariable(p)->getNDArray()->shapeInfo());
+                        } else
+                            return false;
+                    }
+
+                    if (!valuesKnown && dynamic_cast<nd4j::ops::LegacyOp<T>*>(op) == nullptr)
+                        return false;
+
+                    try {
+                        Context<T> ctx(node->getContextPrototype(), _variableSpace);
+                        ShapeList inSha(inputShapes);
+                        auto outSha = op->calculateOutputShape(&inSha, ctx);
+
+                        for (auto v: *outSha->asVector())
+                            outShapes.emplace_back(std::vector<Nd4jLong>(v, v + shape::shapeInfoLength(v)));
+
+                        outSha->destroy();
+                        delete outSha;
+                    } catch (std::exception &ex) {
+                        nd4j_debug("Node_%i: output shapes can't be inferred before execution\n", node->id());
+                        return false;
+                    }
+                }
+
+                // switching op to in-place, if its input dies here anyway
+                // nodes of frozen graph might be executed by other contexts right now, so they stay as is
+                // Context follows prototype flag, legacy nodes report in-place regardless of it
+                bool isInplace = node->hasBlockAttached() ? node->getContextPrototype()->isInplace() : node->isInplace();
+                if (!isInplace && !_frozen && op->getOpDescriptor()->allowsInplace() && outShapes.size() == 1 && !node->input()->empty()) {
+                    auto &in = node->input()->at(0);
+                    if (buffers.count(in) > 0 && consumers[in] == 1 && std::find(_output.begin(), _output.end(), in.first) == _output.end() && shape::equalsSoft(shapes[in].data(), outShapes[0].data())) {
+                        node->markInplace(true);
+                        inplace.emplace_back(node->id());
+                        isInplace = true;
+                    }
+                }
+
+                for (int k = 0; k < (int) outShapes.size(); k++) {
+                    std::pair<int, int> pair(node->id(), k);
+                    shapes[pair] = outShapes[k];
+
+                    auto shapeInfo = outShapes[k].data();
+                    if (shape::isEmpty(shapeInfo))
+                        continue;
+
+                    // outputs nobody reads are results, and results are kept intact till the end
+                    bool isResult = consumers.count(pair) == 0 || std::find(_output.begin(), _output.end(), node->id()) != _output.end();
+                    int last = isResult ? end : lastUse[pair];
+
+                    if (isInplace) {
+                        // in-place output lives in the buffer of corresponding input
+                        if (k < (int) node->input()->size() && buffers.count(node->input()->at(k)) > 0) {
+                            auto bufferId = buffers[node->input()->at(k)];
+                            planner.extendBuffer(bufferId, last);
+                            buffers[pair] = bufferId;
+                            aliases.emplace_back(pair);
+                        }
+
+                        continue;
+                    }
+
+                    buffers[pair] = planner.addBuffer(shape::length(shapeInfo) * sizeof(T), e, last);
+                }
+            }
+
+            auto arenaSize = planner.plan();
+
+            // extra bytes let us align arena start
+            _arena.resize(arenaSize + 64);
+            auto base = reinterpret_cast<int8_t *>((reinterpret_cast<uintptr_t>(_arena.data()) + 63) & ~static_cast<uintptr_t>(63));
+
+            for (auto &v: buffers) {
+                auto pair = v.first;
+                if (std::find(aliases.begin(), aliases.end(), pair) != aliases.end())
+                    continue;
+
+                auto &shape = shapes[pair];
+                auto newShape = new Nd4jLong[shape.size()];
+                memcpy(newShape, shape.data(), shape.size() * sizeof(Nd4jLong));
+
+                auto array = new NDArray<T>(reinterpret_cast<T *>(base + planner.offset(v.second)), newShape);
+                array->triggerAllocationFlag(false, true);
+
+                Variable<T>* var = nullptr;
+                if (!_variableSpace->hasVariable(pair)) {
+                    var = new Variable<T>(array, nullptr, pair.first, pair.second);
+                    _variableSpace->putVariable(pair, var);
+                } else {
+                    var = _variableSpace->getVariable(pair);
+                    if (var->hasNDArray() && var->isRemovable())
+                        delete var->getNDArray();
+
+                    var->setNDArray(array);
+                }
+
+                var->markRemovable(true);
+                var->markPlanned(true);
+                _plannedArrays.emplace_back(pair);
+            }
+
+            // in-place ops will put input array here on their own
+            for (auto &pair: aliases) {
+                if (!_variableSpace->hasVariable(pair))
+                    continue;
+
+                auto var = _variableSpace->getVariable(pair);
+                if (var->hasNDArray() && var->isRemovable())
+                    delete var->getNDArray();
+
+                var->setNDArray(nullptr);
+            }
+
+            _plannedAliases = aliases;
+            _plannedInplace = inplace;
+            _planSignature = signature;
+            _memoryPlanned = true;
+
+            nd4j_debug("Memory plan: %lld bytes arena for %lld bytes of intermediate arrays\n", (long long) arenaSize, (long long) planner.totalSize());
+
+            return true;
+        }
+
+        template <typename T>
+        void Graph<T>::releaseMemoryPlan() {
+            if (!_memoryPlanned)
+                return;
+
+            if (_variableSpace != nullptr) {
+                for (auto &pair: _plannedArrays) {
+                    if (!_variableSpace->hasVariable(pair))
+                        continue;
+
+                    // array could leave arena already
+                    auto var = _variableSpace->getVariable(pair);
+                    if (!var->isPlanned())
+                        continue;
+
+                    if (var->hasNDArray() && var->isRemovable())
+                        delete var->getNDArray();
+
+                    var->setNDArray(nullptr);
+                }
+
+                // aliases point to the same views, they aren't owners
+                for (auto &pair: _plannedAliases) {
+                    if (_variableSpace->hasVariable(pair))
+                        _variableSpace->getVariable(pair)->setNDArray(nullptr);
+                }
+            }
+
+            for (auto id: _plannedInplace)
+                if (_mapped->count(id) > 0)
+                    _mapped->at(id)->markInplace(false);
+
+            _plannedArrays.clear();
+            _plannedAliases.clear();
+            _plannedInplace.clear();
+            _planSignature.clear();
+            _arena.clear();
+            _arena.shrink_to_fit();
+            _memoryPlanned = false;
+        }
+
+        template <typename T>
+        Nd4jLong Graph<T>::plannedMemory() {
+            return _memoryPlanned ? static_cast<Nd4jLong>(_arena.size()) - 64 : 0L;
+        }
+
         template <typename T>
         void Graph<T>::prepareOutputs() {
             // if we're dumping everything out there - we'll add external variables as well
@@ -893,7 +1382,7 @@ namespace nd4j {
         }
 
         template <typename T>
-        Graph<T>::Graph(const FlatGraph *flatGraph, VariableSpace<T> *variableSpace) {
+        Graph<T>::Graph(const FlatGraph *flatGraph, VariableSpace<T> *variableSpace, std::shared_ptr<MappedFile> storage) {
             this->_onion = new std::map<int, std::vector<Node<T> *> *>();
             this->_mapped = new std::map<int, Node<T> *> ();
             this->_nodes = new std::vector<int>();
@@ -929,7 +1418,7 @@ namespace nd4j {
                 for (unsigned int e = 0; e < flatGraph->variables()->size(); e++) {
                     auto flatVar = flatGraph->variables()->Get(e);
 
-                    auto var = new Variable<T>(flatVar);
+                    auto var = new Variable<T>(flatVar, storage);
                     std::pair<int, int> pair(flatVar->id()->first(), flatVar->id()->second());
                     _variableSpace->putVariable(pair, var);
 
@@ -984,8 +1473,10 @@ namespace nd4j {
              *  1) this is FeedForward pass ONLY
              *  2) OPTIMIZED mode is set, so no intermediate results are going to be used
              */
-            if (_configuration->_direction == Direction_FORWARD_ONLY && _configuration->_outputMode == OutputMode_OPTIMIZED)
+            if (_configuration->_direction == Direction_FORWARD_ONLY && _configuration->_outputMode == OutputMode_OPTIMIZED) {
+                this->fuseElementwiseChains();
                 this->tagInplaceNodes();
+            }
         }
 
 
@@ -1234,11 +1725,14 @@ namespace nd4j {
 
         template <typename T>
         void Graph<T>::forgetVariableSpace() {
+            // arena dies with this graph, so VariableSpace can't keep views into it
+            releaseMemoryPlan();
             _variableSpace = nullptr;
         }
 
         template <typename T>
         void Graph<T>::replaceState(VariableSpace<T> *state, ExecutorConfiguration *configuration) {
+            releaseMemoryPlan();
             delete _variableSpace;
             delete _configuration;
 
@@ -1246,6 +1740,84 @@ namespace nd4j {
             _configuration = configuration;
         }
 
+        template <typename T>
+        bool Graph<T>::freeze() {
+            if (_frozen)
+                return _shareable;
+
+            buildGraph();
+
+            // in-place switches of memory plan are node state too
+            releaseMemoryPlan();
+
+            _shareable = _scopes.empty() && _unmapped.empty();
+            for (auto &v: *_mapped) {
+                auto node = v.second;
+
+                // LOGIC nodes get frame ids during execution, RANDOM ops share RNG state, embedded graphs own their executioner
+                if (node->opType() == OpType_LOGIC || node->opType() == OpType_RANDOM || node->hasGraphEmbedded() || node->isScoped()) {
+                    _shareable = false;
+                    break;
+                }
+            }
+
+            _frozen = true;
+
+            return _shareable;
+        }
+
+        template <typename T>
+        bool Graph<T>::isFrozen() {
+            return _frozen;
+        }
+
+        template <typename T>
+        Graph<T>* Graph<T>::cloneShared() {
+            if (!_frozen || !_shareable)
+                throw std::runtime_error("Only frozen shareable Graph can be shared");
+
+            auto clone = new Graph<T>();
+
+            // structure of graph is borrowed from this instance
+            delete clone->_mapped;
+            delete clone->_nodes;
+            for (auto &v: *clone->_onion)
+                delete v.second;
+            delete clone->_onion;
+
+            clone->_mapped = _mapped;
+            clone->_nodes = _nodes;
+            clone->_onion = _onion;
+            clone->_output = _output;
+            clone->_autos = _autos;
+
+            clone->_shared = true;
+            clone->_frozen = true;
+            clone->_shareable = true;
+            clone->_built.store(true);
+
+            clone->replaceState(new VariableProxy<T>(_variableSpace, true), _configuration->clone());
+
+            return clone;
+        }
+
+        template <typename T>
+        void Graph<T>::resetState() {
+            auto proxy = dynamic_cast<VariableProxy<T>*>(_variableSpace);
+            if (proxy == nullptr)
+                throw std::runtime_error("Only Graph backed by VariableProxy can be reset");
+
+            releaseMemoryPlan();
+            proxy->reset();
+
+            if (_flowPath == nullptr)
+                _flowPath = new FlowPath();
+            else
+                _flowPath->reset();
+
+            proxy->setFlowPath(_flowPath);
+        }
+
         template <typename T>
         template <typename N>
         Graph<N>* Graph<T>::asT() {
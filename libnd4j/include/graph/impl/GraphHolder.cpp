@@ -33,6 +33,36 @@ namespace nd4j {
             return _INSTANCE;
         };
 
+        template <>
+        std::map<Nd4jLong, GraphSessions<float>*>& GraphHolder::sessionsMap() {
+            return _sessionsF;
+        }
+
+        template <>
+        std::map<Nd4jLong, GraphSessions<double>*>& GraphHolder::sessionsMap() {
+            return _sessionsD;
+        }
+
+        template <>
+        std::map<Nd4jLong, GraphSessions<float16>*>& GraphHolder::sessionsMap() {
+            return _sessionsH;
+        }
+
+        template <>
+        std::map<Nd4jLong, InferenceBatcher<float>*>& GraphHolder::batchersMap() {
+            return _batchersF;
+        }
+
+        template <>
+        std::map<Nd4jLong, InferenceBatcher<double>*>& GraphHolder::batchersMap() {
+            return _batchersD;
+        }
+
+        template <>
+        std::map<Nd4jLong, InferenceBatcher<float16>*>& GraphHolder::batchersMap() {
+            return _batchersH;
+        }
+
         template <>
         void GraphHolder::registerGraph(Nd4jLong graphId, Graph<float>* graph) {
             if (hasGraphAny(graphId))
@@ -134,18 +164,21 @@ namespace nd4j {
             if (std::is_same<T, float>::value) {
                 if (this->hasGraph<float>(graphId)) {
                     auto g = _graphF[graphId];
+                    dropSessions<float>(graphId);
                     forgetGraph<float>(graphId);
                     delete g;
                 }
             } else if (std::is_same<T, double>::value) {
                 if (this->hasGraph<double>(graphId)) {
                     auto g = _graphD[graphId];
+                    dropSessions<double>(graphId);
                     forgetGraph<double>(graphId);
                     delete g;
                 }
             } else if (std::is_same<T, float16>::value) {
                 if (this->hasGraph<float16>(graphId)) {
                     auto g = _graphH[graphId];
+                    dropSessions<float16>(graphId);
                     forgetGraph<float16>(graphId);
                     delete g;
                 }
@@ -162,6 +195,10 @@ namespace nd4j {
             this->dropGraph<float16>(graphId);
             this->dropGraph<double>(graphId);
 
+            _mutexSessions.lock();
+            _batchingPolicy.erase(graphId);
+            _mutexSessions.unlock();
+
             this->unlockWrite(graphId);
         }
 
@@ -192,27 +229,205 @@ namespace nd4j {
 
             this->lockWrite(graphId);
 
+            dropSessions<float>(graphId);
             _graphF[graphId] = graph;
 
             this->unlockWrite(graphId);
         }
 
+        template <>
+        void GraphHolder::replaceGraph(Nd4jLong graphId, Graph<double>* graph) {
+            if (!hasGraph<double>(graphId)) {
+                registerGraph<double>(graphId, graph);
+                return;
+            }
+
+            this->lockWrite(graphId);
+
+            dropSessions<double>(graphId);
+            _graphD[graphId] = graph;
+
+            this->unlockWrite(graphId);
+        }
+
+        template <>
+        void GraphHolder::replaceGraph(Nd4jLong graphId, Graph<float16>* graph) {
+            if (!hasGraph<float16>(graphId)) {
+                registerGraph<float16>(graphId, graph);
+                return;
+            }
 
+            this->lockWrite(graphId);
 
+            dropSessions<float16>(graphId);
+            _graphH[graphId] = graph;
 
-        flatbuffers::Offset<FlatResult> GraphHolder::execute(Nd4jLong graphId, flatbuffers::FlatBufferBuilder &builder, const FlatInferenceRequest* request) {
-            if (!hasGraph<float>(graphId))
-                throw unknown_graph_exception(graphId);
+            this->unlockWrite(graphId);
+        }
+
+        template <typename T>
+        GraphSessions<T>* GraphHolder::sessionsFor(Nd4jLong graphId) {
+            std::lock_guard<std::mutex> lock(_mutexSessions);
+
+            auto &sessions = sessionsMap<T>();
+            if (sessions.count(graphId) == 0)
+                sessions[graphId] = new GraphSessions<T>(pullGraph<T>(graphId));
+
+            return sessions[graphId];
+        }
+
+        template <typename T>
+        InferenceBatcher<T>* GraphHolder::batcherFor(Nd4jLong graphId) {
+            // sessions are requested first, since both methods take the same lock
+            auto sessions = sessionsFor<T>(graphId);
+
+            std::lock_guard<std::mutex> lock(_mutexSessions);
 
+            if (_batchingPolicy.count(graphId) == 0)
+                return nullptr;
+
+            auto &batchers = batchersMap<T>();
+            if (batchers.count(graphId) == 0) {
+                auto policy = _batchingPolicy[graphId];
+                batchers[graphId] = new InferenceBatcher<T>(sessions, policy.first, policy.second);
+            }
+
+            return batchers[graphId];
+        }
+
+        template <typename T>
+        void GraphHolder::dropSessions(Nd4jLong graphId) {
+            std::lock_guard<std::mutex> lock(_mutexSessions);
+
+            auto &batchers = batchersMap<T>();
+            if (batchers.count(graphId) > 0) {
+                delete batchers[graphId];
+                batchers.erase(graphId);
+            }
+
+            auto &sessions = sessionsMap<T>();
+            if (sessions.count(graphId) > 0) {
+                delete sessions[graphId];
+                sessions.erase(graphId);
+            }
+        }
+
+        void GraphHolder::enableBatching(Nd4jLong graphId, int maxBatchSize, Nd4jLong maxDelayMicros) {
+            this->lockWrite(graphId);
+
+            // batchers are rebuilt with new policy on next request
+            dropSessions<float>(graphId);
+            dropSessions<double>(graphId);
+            dropSessions<float16>(graphId);
+
+            _mutexSessions.lock();
+            _batchingPolicy[graphId] = std::pair<int, Nd4jLong>(maxBatchSize, maxDelayMicros);
+            _mutexSessions.unlock();
+
+            this->unlockWrite(graphId);
+        }
+
+        void GraphHolder::disableBatching(Nd4jLong graphId) {
+            this->lockWrite(graphId);
+
+            dropSessions<float>(graphId);
+            dropSessions<double>(graphId);
+            dropSessions<float16>(graphId);
+
+            _mutexSessions.lock();
+            _batchingPolicy.erase(graphId);
+            _mutexSessions.unlock();
+
+            this->unlockWrite(graphId);
+        }
+
+        bool GraphHolder::isBatching(Nd4jLong graphId) {
+            std::lock_guard<std::mutex> lock(_mutexSessions);
+            return _batchingPolicy.count(graphId) > 0;
+        }
+
+        int GraphHolder::numberOfSessions(Nd4jLong graphId) {
+            std::lock_guard<std::mutex> lock(_mutexSessions);
+
+            if (_sessionsF.count(graphId) > 0)
+                return _sessionsF[graphId]->numberOfSessions();
+            else if (_sessionsD.count(graphId) > 0)
+                return _sessionsD[graphId]->numberOfSessions();
+            else if (_sessionsH.count(graphId) > 0)
+                return _sessionsH[graphId]->numberOfSessions();
+
+            return 0;
+        }
+
+        Nd4jLong GraphHolder::numberOfBatches(Nd4jLong graphId) {
+            std::lock_guard<std::mutex> lock(_mutexSessions);
+
+            if (_batchersF.count(graphId) > 0)
+                return _batchersF[graphId]->numberOfBatches();
+            else if (_batchersD.count(graphId) > 0)
+                return _batchersD[graphId]->numberOfBatches();
+            else if (_batchersH.count(graphId) > 0)
+                return _batchersH[graphId]->numberOfBatches();
+
+            return 0;
+        }
+
+        Nd4jLong GraphHolder::numberOfBatchedRequests(Nd4jLong graphId) {
+            std::lock_guard<std::mutex> lock(_mutexSessions);
+
+            if (_batchersF.count(graphId) > 0)
+                return _batchersF[graphId]->numberOfRequests();
+            else if (_batchersD.count(graphId) > 0)
+                return _batchersD[graphId]->numberOfRequests();
+            else if (_batchersH.count(graphId) > 0)
+                return _batchersH[graphId]->numberOfRequests();
+
+            return 0;
+        }
+
+        template <typename T>
+        flatbuffers::Offset<FlatResult> GraphHolder::executeT(Nd4jLong graphId, flatbuffers::FlatBufferBuilder &builder, const FlatInferenceRequest* request) {
             lockRead(graphId);
 
-            auto graph = cloneGraph<float>(graphId);
-            auto res = GraphExecutioner<float>::execute(graph, builder, request);
-            delete graph;
+            try {
+                flatbuffers::Offset<FlatResult> res;
+
+                auto batcher = batcherFor<T>(graphId);
+                if (batcher != nullptr)
+                    res = batcher->execute(builder, request);
+                else {
+                    auto sessions = sessionsFor<T>(graphId);
+                    auto context = sessions->acquire();
+
+                    // results are serialized into builder, so context can be recycled right away
+                    try {
+                        res = GraphExecutioner<T>::execute(context, builder, request);
+                    } catch (...) {
+                        sessions->release(context);
+                        throw;
+                    }
+
+                    sessions->release(context);
+                }
 
-            unlockRead(graphId);
+                unlockRead(graphId);
 
-            return res;
+                return res;
+            } catch (...) {
+                unlockRead(graphId);
+                throw;
+            }
+        }
+
+        flatbuffers::Offset<FlatResult> GraphHolder::execute(Nd4jLong graphId, flatbuffers::FlatBufferBuilder &builder, const FlatInferenceRequest* request) {
+            if (hasGraph<float>(graphId))
+                return executeT<float>(graphId, builder, request);
+            else if (hasGraph<double>(graphId))
+                return executeT<double>(graphId, builder, request);
+            else if (hasGraph<float16>(graphId))
+                return executeT<float16>(graphId, builder, request);
+
+            throw unknown_graph_exception(graphId);
         }
 
 
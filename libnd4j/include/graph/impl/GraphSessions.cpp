@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#include <graph/GraphSessions.h>
+#include <graph/VariableProxy.h>
+
+namespace nd4j {
+    namespace graph {
+        template <typename T>
+        GraphSessions<T>::GraphSessions(Graph<T>* origin) {
+            _origin = origin;
+
+            // graph must be built before anything is borrowed from it
+            _shareable = _origin->freeze();
+        }
+
+        template <typename T>
+        GraphSessions<T>::~GraphSessions() {
+            for (auto v: _contexts)
+                delete v;
+        }
+
+        template <typename T>
+        Graph<T>* GraphSessions<T>::acquire() {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            if (!_idle.empty()) {
+                auto context = _idle.back();
+                _idle.pop_back();
+
+                return context;
+            }
+
+            // nodes are either borrowed, or cloned once per context. in both cases results stay local to context
+            Graph<T>* context = nullptr;
+            if (_shareable)
+                context = _origin->cloneShared();
+            else {
+                context = _origin->cloneWithProxy();
+                context->replaceState(new VariableProxy<T>(_origin->getVariableSpace(), true), _origin->getExecutorConfiguration()->clone());
+            }
+
+            context->resetState();
+            _contexts.emplace_back(context);
+
+            return context;
+        }
+
+        template <typename T>
+        void GraphSessions<T>::release(Graph<T>* context) {
+            context->resetState();
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _idle.emplace_back(context);
+        }
+
+        template <typename T>
+        bool GraphSessions<T>::isShared() {
+            return _shareable;
+        }
+
+        template <typename T>
+        int GraphSessions<T>::numberOfSessions() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return static_cast<int>(_contexts.size());
+        }
+
+        template class ND4J_EXPORT GraphSessions<float>;
+        template class ND4J_EXPORT GraphSessions<float16>;
+        template class ND4J_EXPORT GraphSessions<double>;
+    }
+}
@@ -0,0 +1,328 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#include <chrono>
+#include <memory>
+#include <graph/InferenceBatcher.h>
+#include <graph/ExecutionResult.h>
+#include <GraphExecutioner.h>
+#include <graph/exceptions/graph_execution_exception.h>
+#include <graph/exceptions/no_results_exception.h>
+
+namespace nd4j {
+    namespace graph {
+        // results outlive execution context, so they can't stay in its workspace
+        template <typename T>
+        static NDArray<T>* detach(NDArray<T>& array) {
+            auto result = new NDArray<T>(array.ordering(), array.getShapeAsVector());
+            result->assign(&array);
+
+            return result;
+        }
+
+        template <typename T>
+        InferenceBatcher<T>::InferenceBatcher(GraphSessions<T>* sessions, int maxBatchSize, Nd4jLong maxDelayMicros) {
+            _sessions = sessions;
+            _maxBatchSize = maxBatchSize;
+            _maxDelay = maxDelayMicros;
+
+            _batches.store(0);
+            _requests.store(0);
+        }
+
+        template <typename T>
+        bool InferenceBatcher<T>::compatible(PendingRequest* first, PendingRequest* second) {
+            if (first->rows < 0 || second->rows < 0 || first->inputs.size() != second->inputs.size())
+                return false;
+
+            for (int e = 0; e < first->inputs.size(); e++) {
+                auto a = first->inputs[e];
+                auto b = second->inputs[e];
+
+                if (a->id() != b->id() || a->index() != b->index() || *a->getName() != *b->getName())
+                    return false;
+
+                auto arrA = a->getNDArray();
+                auto arrB = b->getNDArray();
+
+                if (arrA->rankOf() != arrB->rankOf())
+                    return false;
+
+                for (int d = 1; d < arrA->rankOf(); d++)
+                    if (arrA->sizeAt(d) != arrB->sizeAt(d))
+                        return false;
+            }
+
+            return true;
+        }
+
+        template <typename T>
+        Nd4jLong InferenceBatcher<T>::queuedRows() {
+            auto front = _queue.front();
+            if (front->rows < 0)
+                return _maxBatchSize;
+
+            Nd4jLong rows = 0;
+            for (auto r: _queue)
+                if (r == front || compatible(front, r))
+                    rows += r->rows;
+
+            return rows;
+        }
+
+        template <typename T>
+        std::vector<typename InferenceBatcher<T>::PendingRequest*> InferenceBatcher<T>::takeBatch() {
+            std::vector<PendingRequest*> batch;
+
+            auto front = _queue.front();
+            _queue.pop_front();
+            batch.emplace_back(front);
+
+            if (front->rows < 0)
+                return batch;
+
+            Nd4jLong rows = front->rows;
+            for (auto it = _queue.begin(); it != _queue.end() && rows < _maxBatchSize; ) {
+                auto r = *it;
+                if (compatible(front, r) && rows + r->rows <= _maxBatchSize) {
+                    rows += r->rows;
+                    batch.emplace_back(r);
+                    it = _queue.erase(it);
+                } else
+                    ++it;
+            }
+
+            return batch;
+        }
+
+        template <typename T>
+        Nd4jStatus InferenceBatcher<T>::executeBatch(std::vector<PendingRequest*>& batch) {
+            // context goes back to the pool on every path out of here
+            SessionLease<T> lease(_sessions);
+            auto graph = lease.graph();
+            auto varSpace = graph->getVariableSpace();
+            auto first = batch.at(0);
+
+            Nd4jLong totalRows = 0;
+            for (auto r: batch)
+                totalRows += r->rows;
+
+            if (batch.size() == 1) {
+                // nothing to merge, VariableSpace takes ownership of request inputs
+                for (auto &v: first->inputs) {
+                    varSpace->replaceVariable(v);
+                    v = nullptr;
+                }
+
+                first->inputs.clear();
+            } else {
+                for (int e = 0; e < first->inputs.size(); e++) {
+                    auto var = first->inputs[e];
+                    auto proto = var->getNDArray();
+
+                    std::vector<Nd4jLong> shape(proto->getShapeInfo() + 1, proto->getShapeInfo() + 1 + proto->rankOf());
+                    shape[0] = totalRows;
+
+                    auto merged = new NDArray<T>('c', shape);
+                    std::vector<Nd4jLong> interval(2 * proto->rankOf(), 0);
+
+                    Nd4jLong offset = 0;
+                    for (auto r: batch) {
+                        interval[0] = offset;
+                        interval[1] = offset + r->rows;
+
+                        auto rows = (*merged)(interval, true);
+                        rows.assign(r->inputs[e]->getNDArray());
+
+                        offset += r->rows;
+                    }
+
+                    auto name = var->getName()->empty() ? nullptr : var->getName()->c_str();
+                    auto mergedVar = new Variable<T>(merged, name, var->id(), var->index());
+
+                    // exact integer ids must survive merging too, otherwise they collapse to T in the merged batch
+                    bool hasIndices = false;
+                    for (auto r: batch)
+                        hasIndices |= r->inputs[e]->hasIndexArray();
+
+                    if (hasIndices) {
+                        std::vector<Nd4jLong> values;
+                        values.reserve(merged->lengthOf());
+
+                        for (auto r: batch) {
+                            auto indices = r->inputs[e]->getIndexArray();
+                            if (indices == nullptr)
+                                indices.reset(IndexArray::fromNDArray<T>(r->inputs[e]->getNDArray()));
+
+                            values.insert(values.end(), indices->buffer(), indices->buffer() + indices->lengthOf());
+                        }
+
+                        mergedVar->setIndexArray(std::make_shared<IndexArray>(shape, values));
+                    }
+
+                    varSpace->replaceVariable(mergedVar);
+                }
+            }
+
+            auto status = GraphExecutioner<T>::execute(graph);
+            if (status != ND4J_STATUS_OK)
+                return status;
+
+            std::unique_ptr<std::vector<Variable<T>*>> outputs(graph->fetchOutputs());
+            for (auto v: *outputs) {
+                auto array = v->getNDArray();
+                auto name = v->getName()->empty() ? nullptr : v->getName()->c_str();
+                bool split = batch.size() > 1 && array->rankOf() > 0 && array->sizeAt(0) == totalRows;
+
+                std::vector<Nd4jLong> interval(2 * array->rankOf(), 0);
+
+                Nd4jLong offset = 0;
+                for (auto r: batch) {
+                    NDArray<T>* result = nullptr;
+                    if (split) {
+                        interval[0] = offset;
+                        interval[1] = offset + r->rows;
+
+                        auto rows = (*array)(interval, true);
+                        result = detach(rows);
+                    } else
+                        result = detach(*array);
+
+                    r->outputs.emplace_back(new Variable<T>(result, name, v->id(), v->index()));
+                    offset += r->rows;
+                }
+            }
+
+            _batches++;
+            _requests += batch.size();
+
+            return ND4J_STATUS_OK;
+        }
+
+        template <typename T>
+        flatbuffers::Offset<FlatResult> InferenceBatcher<T>::execute(flatbuffers::FlatBufferBuilder &builder, const FlatInferenceRequest* request) {
+            PendingRequest pending;
+
+            if (request != nullptr && request->variables() != nullptr) {
+                auto vars = request->variables();
+                for (int e = 0; e < vars->size(); e++)
+                    pending.inputs.emplace_back(new Variable<T>(vars->Get(e)));
+            }
+
+            // request can be merged only if all of its inputs share the same leading dimension
+            for (auto v: pending.inputs) {
+                auto array = v->getNDArray();
+                if (array == nullptr || array->rankOf() < 1 || (pending.rows >= 0 && pending.rows != array->sizeAt(0))) {
+                    pending.rows = -1;
+                    break;
+                }
+
+                pending.rows = array->sizeAt(0);
+            }
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queue.push_back(&pending);
+            _condition.notify_all();
+
+            while (!pending.done) {
+                if (!_collecting && !_queue.empty() && _queue.front() == &pending) {
+                    _collecting = true;
+
+                    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(_maxDelay);
+                    _condition.wait_until(lock, deadline, [&] { return queuedRows() >= _maxBatchSize; });
+
+                    auto batch = takeBatch();
+
+                    // next leader can start collecting while this batch is executed
+                    _collecting = false;
+                    _condition.notify_all();
+                    lock.unlock();
+
+                    // whatever happens, every request of this batch has to be woken up
+                    Nd4jStatus status = ND4J_STATUS_KERNEL_FAILURE;
+                    try {
+                        status = executeBatch(batch);
+                    } catch (std::exception &e) {
+                        nd4j_printf("Batched inference failed: [%s]\n", e.what());
+                    } catch (...) {
+                        nd4j_printf("Batched inference failed\n", "");
+                    }
+
+                    lock.lock();
+                    for (auto r: batch) {
+                        r->status = status;
+                        r->done = true;
+                    }
+
+                    _condition.notify_all();
+                } else
+                    _condition.wait(lock);
+            }
+
+            lock.unlock();
+
+            for (auto v: pending.inputs)
+                delete v;
+
+            auto id = request != nullptr ? request->id() : 0L;
+            if (pending.status != ND4J_STATUS_OK) {
+                // batch might have failed halfway through splitting results
+                for (auto v: pending.outputs)
+                    delete v;
+
+                throw graph_execution_exception(id);
+            }
+
+            if (pending.outputs.empty())
+                throw no_results_exception(id);
+
+            ExecutionResult<T> result;
+            for (auto v: pending.outputs)
+                result.emplace_back(v);
+
+            auto offset = result.asFlatResult(builder);
+
+            for (auto v: pending.outputs)
+                delete v;
+
+            return offset;
+        }
+
+        template <typename T>
+        int InferenceBatcher<T>::maxBatchSize() {
+            return _maxBatchSize;
+        }
+
+        template <typename T>
+        Nd4jLong InferenceBatcher<T>::maxDelay() {
+            return _maxDelay;
+        }
+
+        template <typename T>
+        Nd4jLong InferenceBatcher<T>::numberOfBatches() {
+            return _batches.load();
+        }
+
+        template <typename T>
+        Nd4jLong InferenceBatcher<T>::numberOfRequests() {
+            return _requests.load();
+        }
+
+        template class ND4J_EXPORT InferenceBatcher<float>;
+        template class ND4J_EXPORT InferenceBatcher<float16>;
+        template class ND4J_EXPORT InferenceBatcher<double>;
+    }
+}
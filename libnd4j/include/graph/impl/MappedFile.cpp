@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#include <graph/MappedFile.h>
+#include <helpers/logger.h>
+#include <stdexcept>
+#include <cstdio>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
+namespace nd4j {
+    namespace graph {
+        MappedFile::MappedFile(const char *filename) {
+            struct stat stat_buf;
+            if (stat(filename, &stat_buf) != 0 || stat_buf.st_size <= 0) {
+                nd4j_printf("File [%s] wasn't found. Please check path and permissions\n", filename);
+                throw std::runtime_error("File not found");
+            }
+
+            _length = static_cast<size_t>(stat_buf.st_size);
+
+#ifndef _WIN32
+            int fd = open(filename, O_RDONLY);
+            if (fd < 0) {
+                nd4j_printf("Can't open file [%s] for mapping\n", filename);
+                throw std::runtime_error("Failed to open file for MMAP");
+            }
+
+            // private mapping: pages stay shared until written, in-place updates of weights never reach the file
+            void *ptr = mmap(nullptr, _length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+            // mapping keeps its own reference to the file
+            close(fd);
+
+            if (ptr != MAP_FAILED) {
+                _data = reinterpret_cast<uint8_t *>(ptr);
+                _mapped = true;
+                return;
+            }
+
+            nd4j_debug("mmap failed for file [%s], falling back to read\n", filename);
+#endif
+            FILE *in = fopen(filename, "rb");
+            if (in == nullptr)
+                throw std::runtime_error("File not found");
+
+            _data = new uint8_t[_length];
+            auto cnt = fread(_data, 1, _length, in);
+            fclose(in);
+
+            if (cnt != _length) {
+                delete[] _data;
+                throw std::runtime_error("Failed to read file");
+            }
+        }
+
+        MappedFile::~MappedFile() {
+#ifndef _WIN32
+            if (_mapped) {
+                munmap(_data, _length);
+                return;
+            }
+#endif
+            delete[] _data;
+        }
+
+        uint8_t* MappedFile::data() const {
+            return _data;
+        }
+
+        size_t MappedFile::length() const {
+            return _length;
+        }
+
+        bool MappedFile::isMapped() const {
+            return _mapped;
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+
+#include <graph/MemoryPlanner.h>
+#include <algorithm>
+#include <stdexcept>
+
+namespace nd4j {
+    namespace graph {
+        MemoryPlanner::MemoryPlanner(Nd4jLong alignment) {
+            _alignment = alignment;
+        }
+
+        int MemoryPlanner::addBuffer(Nd4jLong bytes, int firstStep, int lastStep) {
+            if (lastStep < firstStep)
+                throw std::runtime_error("MemoryPlanner: buffer can't die before it's born");
+
+            PlannedBuffer buffer;
+            buffer.bytes = ((bytes + _alignment - 1) / _alignment) * _alignment;
+            buffer.firstStep = firstStep;
+            buffer.lastStep = lastStep;
+            buffer.offset = -1;
+
+            _buffers.emplace_back(buffer);
+            return static_cast<int>(_buffers.size()) - 1;
+        }
+
+        void MemoryPlanner::extendBuffer(int bufferId, int lastStep) {
+            auto &buffer = _buffers.at(bufferId);
+            buffer.lastStep = std::max(buffer.lastStep, lastStep);
+        }
+
+        Nd4jLong MemoryPlanner::plan() {
+            std::vector<int> order(_buffers.size());
+            for (int e = 0; e < (int) order.size(); e++)
+                order[e] = e;
+
+            // largest first, earlier birth breaks ties so plan doesn't depend on sort implementation
+            std::sort(order.begin(), order.end(), [&] (int a, int b) {
+                if (_buffers[a].bytes != _buffers[b].bytes)
+                    return _buffers[a].bytes > _buffers[b].bytes;
+
+                return a < b;
+            });
+
+            std::vector<int> placed;
+            _arenaSize = 0;
+
+            for (auto id: order) {
+                auto &buffer = _buffers[id];
+
+                // buffers we can't share memory with, sorted by offset
+                std::vector<int> conflicts;
+                for (auto p: placed) {
+                    auto &other = _buffers[p];
+                    if (other.firstStep <= buffer.lastStep && buffer.firstStep <= other.lastStep)
+                        conflicts.emplace_back(p);
+                }
+
+                std::sort(conflicts.begin(), conflicts.end(), [&] (int a, int b) {
+                    return _buffers[a].offset < _buffers[b].offset;
+                });
+
+                Nd4jLong bestOffset = -1;
+                Nd4jLong bestGap = -1;
+                Nd4jLong cursor = 0;
+                for (auto c: conflicts) {
+                    auto &other = _buffers[c];
+                    auto gap = other.offset - cursor;
+                    if (gap >= buffer.bytes && (bestGap < 0 || gap < bestGap)) {
+                        bestGap = gap;
+                        bestOffset = cursor;
+                    }
+
+                    cursor = std::max(cursor, other.offset + other.bytes);
+                }
+
+                buffer.offset = bestOffset >= 0 ? bestOffset : cursor;
+                _arenaSize = std::max(_arenaSize, buffer.offset + buffer.bytes);
+
+                placed.emplace_back(id);
+            }
+
+            return _arenaSize;
+        }
+
+        Nd4jLong MemoryPlanner::offset(int bufferId) const {
+            return _buffers.at(bufferId).offset;
+        }
+
+        Nd4jLong MemoryPlanner::arenaSize() const {
+            return _arenaSize;
+        }
+
+        Nd4jLong MemoryPlanner::totalSize() const {
+            Nd4jLong result = 0;
+            for (auto &b: _buffers)
+                result += b.bytes;
+
+            return result;
+        }
+
+        int MemoryPlanner::numberOfBuffers() const {
+            return static_cast<int>(_buffers.size());
+        }
+    }
+}
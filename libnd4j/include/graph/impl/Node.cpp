@@ -28,6 +28,7 @@
 #include <ops/declarable/LegacyBroadcastOp.h>
 #include <ops/declarable/LegacyReduce3Op.h>
 #include <ops/declarable/LegacyPairwiseTransformOp.h>
+#include <ops/declarable/LegacyFusedOp.h>
 #include <ops/declarable/LegacyRandomOp.h>
 #include <ops/declarable/LegacyOp.h>
 
@@ -692,7 +693,10 @@ namespace nd4j {
 
             if (!_isDeductable && this->_customOp != nullptr)
                 clone->setCustomOp(OpRegistrator::getInstance()->getOperationT<N>(this->_customOp->getOpHash()));
-            else if (_customOp != nullptr) {
+            else if (dynamic_cast<nd4j::ops::LegacyFusedOp<T>*>(_customOp) != nullptr) {
+                // fused chain can't be rebuilt from opType/opNum, stages are converted instead
+                clone->setCustomOp(dynamic_cast<nd4j::ops::LegacyFusedOp<T>*>(_customOp)->template asT<N>());
+            } else if (_customOp != nullptr) {
                 // this->setCustomOp(Node<T>::buildOpByType(opType, (int) input.size(), (int) block->getIArguments()->size(), (int) block->getTArguments()->size(), opNum, scalar));
                 auto op = clone->buildOpByType(_opType, clone->input()->size(), clone->getContextPrototype()->getIArguments()->size(), clone->getContextPrototype()->getTArguments()->size(), _opNum, clone->scalar());
                 clone->setCustomOp(op);
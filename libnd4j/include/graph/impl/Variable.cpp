@@ -42,6 +42,8 @@ namespace nd4j {
             if (this->_ndarray != nullptr)
                 result->setNDArray(this->_ndarray->template asT<N>());
 
+            result->setIndexArray(this->_indices);
+
             // FIXME: add support for ArrayList
             if (this->_list != nullptr) {
                 nd4j_printf("ArrayList not supported yet\n", "");
@@ -60,12 +62,16 @@ namespace nd4j {
             result->_name = this->_name;
             result->_index = this->_index;
 
+            // arrays restored from mapped file are duplicated too: MAP_PRIVATE pages are shared by every clone within process
             if (this->_ndarray != nullptr)
                 result->_ndarray = this->_ndarray->dup(this->_ndarray->ordering());
 
             if (this->_list != nullptr)
                 result->_list = this->_list->clone();
 
+            // IndexArray is immutable, so it's safe to share it between clones
+            result->_indices = this->_indices;
+
             return result;
         }
 
@@ -151,6 +157,16 @@ namespace nd4j {
             this->_removable = reallyRemovable;
         }
 
+        template <typename T>
+        void nd4j::graph::Variable<T>::markPlanned(bool reallyPlanned) {
+            this->_planned = reallyPlanned;
+        }
+
+        template <typename T>
+        bool nd4j::graph::Variable<T>::isPlanned() {
+            return this->_planned;
+        }
+
         template <typename T>
         void nd4j::graph::Variable<T>::markReadOnly(bool reallyReadOnly) {
             this->_readOnly = reallyReadOnly;
@@ -188,6 +204,32 @@ namespace nd4j {
         void nd4j::graph::Variable<T>::setNDArray(nd4j::NDArray<T> * array) {
             this->_variableType = VariableType::NDARRAY;
             this->_ndarray = array;
+
+            // exact indices describe previous array only
+            this->_indices.reset();
+
+            // same for arena placement
+            this->_planned = false;
+        }
+
+        template <typename T>
+        bool nd4j::graph::Variable<T>::hasIndexArray() {
+            return _indices.get() != nullptr;
+        }
+
+        template <typename T>
+        std::shared_ptr<nd4j::IndexArray> nd4j::graph::Variable<T>::getIndexArray() {
+            return _indices;
+        }
+
+        template <typename T>
+        void nd4j::graph::Variable<T>::setIndexArray(std::shared_ptr<nd4j::IndexArray> indices) {
+            _indices = indices;
+        }
+
+        template <typename T>
+        std::shared_ptr<nd4j::graph::MappedFile> nd4j::graph::Variable<T>::getStorage() {
+            return _storage;
         }
 
         template <typename T>
@@ -196,7 +238,12 @@ namespace nd4j {
         }
 
         template <typename T>
-        nd4j::graph::Variable<T>::Variable(const nd4j::graph::FlatVariable *flatVariable) {
+        nd4j::graph::Variable<T>::Variable(const nd4j::graph::FlatVariable *flatVariable) : Variable<T>(flatVariable, nullptr) {
+            //
+        }
+
+        template <typename T>
+        nd4j::graph::Variable<T>::Variable(const nd4j::graph::FlatVariable *flatVariable, std::shared_ptr<nd4j::graph::MappedFile> storage) {
             auto vid = flatVariable->id();
             this->_id = vid->first();
             this->_index = vid->second();
@@ -211,8 +258,18 @@ namespace nd4j {
 
             if (flatVariable->ndarray() != nullptr) {
                  auto ar = flatVariable->ndarray();
-                _ndarray = nd4j::graph::FlatUtils::fromFlatArray<T>(ar);
-                _ndarray->triggerAllocationFlag(true, true);
+                if (storage != nullptr)
+                    _ndarray = nd4j::graph::FlatUtils::viewFromFlatArray<T>(ar);
+
+                if (_ndarray != nullptr) {
+                    _storage = storage;
+                } else {
+                    _ndarray = nd4j::graph::FlatUtils::fromFlatArray<T>(ar);
+                    _ndarray->triggerAllocationFlag(true, true);
+                }
+
+                // integer arrays can't be represented exactly by T, so we keep original values for index-consuming ops
+                _indices.reset(nd4j::IndexArray::fromFlatArray(ar));
             } else if (flatVariable->shape() != nullptr) {
                 int shapeLen = flatVariable->shape()->Length();
                 //int *shape = new int[shapeLen];
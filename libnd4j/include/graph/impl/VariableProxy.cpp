@@ -24,12 +24,13 @@
 namespace nd4j {
     namespace graph {
         template <typename T>
-        VariableProxy<T>::VariableProxy(VariableSpace<T>* ref) {
+        VariableProxy<T>::VariableProxy(VariableSpace<T>* ref, bool isolated) {
             if (ref == nullptr)
                 _backed = new VariableSpace<T>();
 
             _backed = ref;
             _current = new VariableSpace<T>();
+            _isolated = isolated;
         }
 
         template <typename T>
@@ -37,6 +38,20 @@ namespace nd4j {
             delete _current;
         }
 
+        template <typename T>
+        bool VariableProxy<T>::isVisible(Variable<T>* variable) {
+            return !_isolated || variable->id() < 0 || variable->isExternal();
+        }
+
+        template <typename T>
+        void VariableProxy<T>::reset() {
+            // arrays of dropped variables might live in workspace, so it's recycled only after they're gone
+            delete _current;
+            _current = new VariableSpace<T>();
+
+            this->_workspace.scopeOut();
+        }
+
         template <typename T>
         int VariableProxy<T>::numberOfPlaceholders() {
             return _backed->numberOfPlaceholders();
@@ -74,17 +89,17 @@ namespace nd4j {
 
         template <typename T>
         bool VariableProxy<T>::hasVariable(int id) {
-            return _current->hasVariable(id) || _backed->hasVariable(id);
+            return _current->hasVariable(id) || (_backed->hasVariable(id) && isVisible(_backed->getVariable(id)));
         }
         
         template <typename T>
         bool VariableProxy<T>::hasVariable(int id, int idx) {
-            return _current->hasVariable(id, idx) || _backed->hasVariable(id, idx);
+            return _current->hasVariable(id, idx) || (_backed->hasVariable(id, idx) && isVisible(_backed->getVariable(id, idx)));
         }
         
         template <typename T>
         bool VariableProxy<T>::hasVariable(std::pair<int,int>& pair) {
-            return _current->hasVariable(pair) || _backed->hasVariable(pair);
+            return _current->hasVariable(pair) || (_backed->hasVariable(pair) && isVisible(_backed->getVariable(pair)));
         }
 
         template <typename T>
@@ -107,7 +122,8 @@ namespace nd4j {
             auto c = _current->getVariables();
 
             for (auto v: b)
-                result.emplace_back(v);
+                if (isVisible(v))
+                    result.emplace_back(v);
 
             for (auto v: c)
                 result.emplace_back(v);
@@ -117,7 +133,7 @@ namespace nd4j {
 
         template <typename T>
         bool VariableProxy<T>::hasVariable(std::string *symbol) {
-            return _current->hasVariable(symbol) || _backed->hasVariable(symbol);
+            return _current->hasVariable(symbol) || (_backed->hasVariable(symbol) && isVisible(_backed->getVariable(symbol)));
         }
 
         template <typename T>
@@ -125,7 +141,7 @@ namespace nd4j {
             if (_current->hasVariable(id))
                 return _current->getVariable(id);
             
-            if (_backed->hasVariable(id))
+            if (_backed->hasVariable(id) && isVisible(_backed->getVariable(id)))
                 return _backed->getVariable(id);
 
             nd4j_printf("Unable to get Variable to proxy: [%i]\n", id);
@@ -137,7 +153,7 @@ namespace nd4j {
             if (_current->hasVariable(id, idx))
                 return _current->getVariable(id, idx);
             
-            if (_backed->hasVariable(id, idx))
+            if (_backed->hasVariable(id, idx) && isVisible(_backed->getVariable(id, idx)))
                 return _backed->getVariable(id, idx);
 
             nd4j_printf("Unable to get Variable to proxy: [%i:%i]\n", id, idx);
@@ -149,19 +165,35 @@ namespace nd4j {
             if (_current->hasVariable(pair))
                 return _current->getVariable(pair);
             
-            if (_backed->hasVariable(pair))
+            if (_backed->hasVariable(pair) && isVisible(_backed->getVariable(pair)))
                 return _backed->getVariable(pair);
 
             nd4j_printf("Unable to get Variable to proxy: [%i:%i]\n", pair.first, pair.second);
             throw std::runtime_error("Bad arguments");
         }
 
+        template <typename T>
+        int VariableProxy<T>::registerSlot(std::pair<int,int>& pair) {
+            // proxy may shadow backed variables, so it always goes through regular lookups
+            return -1;
+        }
+
+        template <typename T>
+        int VariableProxy<T>::numberOfSlots() {
+            return 0;
+        }
+
+        template <typename T>
+        nd4j::graph::Variable<T> *VariableProxy<T>::getSlotVariable(int slot, std::pair<int,int>& pair) {
+            return nullptr;
+        }
+
         template <typename T>
         nd4j::graph::Variable<T> *VariableProxy<T>::getVariable(std::string *symbol) {
             if (_current->hasVariable(symbol))
                 return _current->getVariable(symbol);
             
-            if (_backed->hasVariable(symbol))
+            if (_backed->hasVariable(symbol) && isVisible(_backed->getVariable(symbol)))
                 return _backed->getVariable(symbol);
 
             nd4j_printf("Unable to get Variable to proxy: [%s]\n", symbol->c_str());
@@ -172,7 +204,7 @@ namespace nd4j {
         void VariableProxy<T>::replaceVariable(Variable<T> *variable) {
             if (variable->getName() != nullptr && !variable->getName()->empty()) {
                 // if variable has name defined - we should resolve it via backing var space
-                if (_backed->hasVariable(variable->getName())) {
+                if (_backed->hasVariable(variable->getName()) && isVisible(_backed->getVariable(variable->getName()))) {
                     auto origVar = _backed->getVariable(variable->getName());
                     variable->setId(origVar->id(), origVar->index());
                     _current->replaceVariable(variable);
@@ -269,7 +301,7 @@ namespace nd4j {
 
         template <typename T>
         nd4j::graph::VariableSpace<T>* VariableProxy<T>::clone() {
-            auto clone = new VariableProxy(_backed);
+            auto clone = new VariableProxy(_backed, _isolated);
 
             delete clone->_current;
             clone->_current = _current->clone();
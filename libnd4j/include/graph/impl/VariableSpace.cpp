@@ -20,6 +20,7 @@
 
 #include <graph/VariableSpace.h>
 #include <NativeOps.h>
+#include <algorithm>
 
 namespace nd4j {
     namespace graph {
@@ -45,6 +46,9 @@ namespace nd4j {
                 result->injectVariable(pair, clonedVar);
             }
 
+            for (auto &p: _slotPairs)
+                result->registerSlot(p);
+
             return result;
         }
 
@@ -66,11 +70,16 @@ namespace nd4j {
                 result->injectVariable(pair, clonedVar);
             }
 
+            for (auto &p: _slotPairs)
+                result->registerSlot(p);
+
             return result;
         }
 
         template <typename T>
         void nd4j::graph::VariableSpace<T>::injectVariable(std::pair<int, int> &pair, Variable<T>* variable) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             if (pair.second == 0) {
                 if (pair.first < 0)
                     this->_variables[pair.first] = variable;
@@ -82,6 +91,7 @@ namespace nd4j {
                 this->_symbolic[*(variable->getName())] = variable;
 
             this->_paired[pair] = variable;
+            invalidateSlot(pair);
 
             this->_handles->push_back(variable);
         }
@@ -98,11 +108,15 @@ namespace nd4j {
 
         template <typename T>
         bool nd4j::graph::VariableSpace<T>::hasVariable(std::string *symbol) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             return _symbolic.count(*symbol) == 1;
         }
 
         template <typename T>
         nd4j::graph::Variable<T> * nd4j::graph::VariableSpace<T>::getVariable(std::string *symbol) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             return _symbolic.at(*symbol);
         }
 
@@ -152,6 +166,8 @@ namespace nd4j {
 
             //nd4j_debug("Requested variable: [%i:%i]\n", pair.first, pair.second);
 
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             if (pair.first < 0)
                 return getVariable(pair.first);
             else if (_paired.count(pair) > 0)
@@ -168,11 +184,15 @@ namespace nd4j {
 
         template <typename T>
         bool nd4j::graph::VariableSpace<T>::hasVariable(int id) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             return _variables.count(id) == 1 || _temporary.count(id) == 1;
         }
 
         template <typename T>
         bool nd4j::graph::VariableSpace<T>::hasVariable(std::pair<int,int>& id) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             return _paired.count(id) > 0;
         }
 
@@ -255,16 +275,17 @@ namespace nd4j {
 
         template <typename T>
         void nd4j::graph::VariableSpace<T>::silentPutVariable(std::pair<int,int>& pair, Variable<T> *variable) {
-            _varmap.lock();
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
 
             //std::pair<std::pair<int, int>, nd4j::graph::Variable<T> *> p(pair, variable);
             _paired[pair] = variable;
-
-            _varmap.unlock();
+            invalidateSlot(pair);
         }
 
         template <typename T>
         void nd4j::graph::VariableSpace<T>::putVariable(std::pair<int,int>& pair, Variable<T> *variable) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             silentPutVariable(pair, variable);
 
             if (variable->isPlaceholder())
@@ -278,21 +299,21 @@ namespace nd4j {
                     _symbolic[*(variable->getName())] = variable;
                 }
 
-                _varmap.lock();
-
                 _handles->push_back(variable);
-
-                _varmap.unlock();
             }
         }
 
         template <typename T>
         void VariableSpace<T>::trackList(nd4j::NDArrayList<T>* list) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             _lists.emplace_back(list);
         }
 
         template <typename T>
         void nd4j::graph::VariableSpace<T>::putVariable(int id, Variable<T> *variable) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
             // we don't want to add variables more then once
             if (_variables.count(id) > 0 || _temporary.count(id) > 0) {
                 // nd4j_verbose("Trying to update variable for node_%i\n", id);
@@ -308,8 +329,6 @@ namespace nd4j {
 
             //nd4j_debug("Adding Variable to Space: id: %i; Array is null: %i;\n", id, variable->getNDArray() == nullptr);
 
-            _varmap.lock();
-
             _handles->emplace_back(variable);
 
             if (_auto_counter >= id)
@@ -329,14 +348,15 @@ namespace nd4j {
                 _external.push_back(variable);
 
                 _variables[id] = variable;
+
+                std::pair<int,int> ext(id, 0);
+                invalidateSlot(ext);
             } else {
                 _internal.push_back(variable);
 
                 _temporary[id] = variable;
             }
 
-            _varmap.unlock();
-
             std::pair<int,int> pair(id, 0);
             if (!hasVariable(pair)) {
                 this->silentPutVariable(pair, variable);
@@ -354,21 +374,84 @@ namespace nd4j {
 
         template <typename T>
         nd4j::graph::Variable<T> * nd4j::graph::VariableSpace<T>::getVariable(int id) {
-//            _varmap.lock();
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
 
             if (id < 0) {
                 auto  v = _variables.at(id);
-   //             _varmap.unlock();
 
                 return v;
             } else {
                 auto v = _temporary.at(id);
-    //            _varmap.unlock();
 
                 return v;
             }
         }
 
+        template <typename T>
+        int VariableSpace<T>::registerSlot(std::pair<int,int>& pair) {
+            // negative ids with non-zero index are resolved via id only, so we don't slot them
+            if (pair.first < 0 && pair.second != 0)
+                return -1;
+
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
+            auto it = _slotIds.find(pair);
+            if (it != _slotIds.end())
+                return it->second;
+
+            int slot = (int) _slotPairs.size();
+            _slotIds[pair] = slot;
+            _slotPairs.emplace_back(pair);
+
+            // atomics aren't movable, so we grow slots table by rebuilding it
+            if (_slots.size() <= slot) {
+                std::vector<std::atomic<Variable<T> *>> slots(nd4j::math::nd4j_max<int>(16, slot * 2));
+                for (int e = 0; e < slots.size(); e++)
+                    slots[e].store(e < _slots.size() ? _slots[e].load() : nullptr);
+
+                _slots.swap(slots);
+            }
+
+            return slot;
+        }
+
+        template <typename T>
+        int VariableSpace<T>::numberOfSlots() {
+            return (int) _slotPairs.size();
+        }
+
+        template <typename T>
+        void VariableSpace<T>::invalidateSlot(std::pair<int,int>& pair) {
+            if (_slotIds.empty())
+                return;
+
+            auto it = _slotIds.find(pair);
+            if (it != _slotIds.end())
+                _slots[it->second].store(nullptr);
+        }
+
+        template <typename T>
+        nd4j::graph::Variable<T> * VariableSpace<T>::getSlotVariable(int slot, std::pair<int,int>& pair) {
+            // slots are assigned before execution, so table itself doesn't change here
+            if (slot < 0 || slot >= _slotPairs.size() || _slotPairs[slot] != pair)
+                return nullptr;
+
+            auto v = _slots[slot].load();
+            if (v != nullptr)
+                return v;
+
+            // first access after variable was (re)placed, resolving via maps
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
+            if (!hasVariable(pair))
+                return nullptr;
+
+            v = getVariable(pair);
+            _slots[slot].store(v);
+
+            return v;
+        }
+
         template <typename T>
         nd4j::memory::Workspace * nd4j::graph::VariableSpace<T>::workspace() {
             return &_workspace;
@@ -428,6 +511,7 @@ namespace nd4j {
                     this->_symbolic[*(clonedVar->getName())] = clonedVar;
 
                 this->_paired[pair] = clonedVar;
+                invalidateSlot(pair);
 
                 this->_handles->push_back(clonedVar);
             }
@@ -444,8 +528,12 @@ namespace nd4j {
                 if (hasVariable(variable->getName())) {
                     nd4j_printf("Replacing by name: [%s]\n", variable->getName()->c_str());
                     auto vs = getVariable(variable->getName());
-                    dropVariable(vs->id(), vs->index());
-                    putVariable(vs->id(), vs->index(), variable);
+                    int id = vs->id();
+                    int idx = vs->index();
+                    if (vs != variable)
+                        dropVariable(id, idx);
+
+                    putVariable(id, idx, variable);
                     //delete vs;
                     replaced = true;
                 }
@@ -454,8 +542,10 @@ namespace nd4j {
                 if (hasVariable(variable->id(), variable->index())) {
                     nd4j_printf("Replacing by id: [%i:%i]\n", variable->id(), variable->index());
                     auto vs = getVariable(variable->id(), variable->index());
-                    dropVariable(variable->id(), variable->index());
-                    putVariable(vs->id(), vs->index(), variable);
+                    if (vs != variable)
+                        dropVariable(variable->id(), variable->index());
+
+                    putVariable(variable->id(), variable->index(), variable);
                     //delete vs;
                     replaced = true;
                 }
@@ -474,7 +564,31 @@ namespace nd4j {
 
         template <typename T>
         void VariableSpace<T>::dropVariable(int id, int idx) {
+            std::lock_guard<std::recursive_mutex> lock(_varmap);
+
+            std::pair<int, int> pair(id, idx);
+            if (_paired.count(pair) == 0)
+                return;
+
+            auto variable = _paired.at(pair);
+            _paired.erase(pair);
+            invalidateSlot(pair);
+
+            // first output is registered by id as well
+            if (idx == 0) {
+                auto &byId = id < 0 ? _variables : _temporary;
+                auto it = byId.find(id);
+                if (it != byId.end() && it->second == variable)
+                    byId.erase(it);
+            }
+
+            if (variable->getName() != nullptr && _symbolic.count(*variable->getName()) > 0 && _symbolic.at(*variable->getName()) == variable)
+                _symbolic.erase(*variable->getName());
+
+            for (auto list: {&_external, &_internal, &_placeholders, _handles})
+                list->erase(std::remove(list->begin(), list->end(), variable), list->end());
 
+            delete variable;
         }
 
         template <typename T>
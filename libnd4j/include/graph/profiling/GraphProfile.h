@@ -22,6 +22,7 @@
 #define ND4J_GRAPH_PROFILE_H
 
 #include "NodeProfile.h"
+#include "TraceRecorder.h"
 #include <pointercast.h>
 #include <dll.h>
 #include <vector>
@@ -60,7 +61,12 @@ namespace nd4j {
 
             std::map<std::string, std::chrono::time_point<std::chrono::system_clock>> _timers;
 
+            // timeline of node executions, filled only while profiling is enabled
+            TraceRecorder _trace;
+
             void updateLast();
+
+            std::string nodeName(int id);
         public:
             GraphProfile();
             ~GraphProfile();
@@ -99,8 +105,18 @@ namespace nd4j {
             NodeProfile* nodeById(int id, const char *name = nullptr);
             bool nodeExists(int id);
 
+            /**
+             * This method stores timed event for given node into trace ring buffer
+             * @param start - nanoseconds since epoch
+             * @param duration - nanoseconds
+             */
+            void traceNode(int id, TracePhase phase, Nd4jLong start, Nd4jLong duration);
+
+            TraceRecorder* trace();
+
             /**
              * This method merges values from other profile report
+             * Trace events of other report are appended to this one, so merging many runs gives a single timeline
              * @param other
              */
             void merge(GraphProfile *other);
@@ -113,6 +129,20 @@ namespace nd4j {
             static Nd4jLong relativeTime(Nd4jLong time);
 
             void printOut();
+
+            /**
+             * This method returns report in Chrome trace-event JSON format (chrome://tracing, Perfetto).
+             * If there are no trace events, timeline is built from per-node averages.
+             */
+            std::string asChromeTrace();
+
+            /**
+             * This method returns per-node times in folded stacks format ("graph;node;phase nanos"), suitable for flamegraph.pl
+             */
+            std::string asFoldedStacks();
+
+            void saveChromeTrace(const char *path);
+            void saveFoldedStacks(const char *path);
         };
     }
 }
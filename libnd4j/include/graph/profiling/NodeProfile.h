@@ -89,6 +89,23 @@ namespace nd4j {
             Nd4jLong getObjectsSize();
             Nd4jLong getTotalSize();
 
+            /**
+             * These methods return times in nanoseconds, summed over all merged reports
+             */
+            Nd4jLong getBuildTime();
+            Nd4jLong getPreparationTime();
+            Nd4jLong getExecutionTime();
+            Nd4jLong getTotalTime();
+            Nd4jLong getShapeFunctionTime();
+            Nd4jLong getArrayTime();
+            Nd4jLong getInputTime();
+
+            /**
+             * This method returns number of executions merged into this report
+             */
+            Nd4jLong merges();
+
+            int id();
             std::string& name();
 
             void merge(NodeProfile *other);
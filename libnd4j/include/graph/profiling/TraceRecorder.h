@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Fixed-size ring buffer of timed events, cheap enough to stay enabled for production inference.
+// Writers reserve a slot with one atomic increment, when buffer is full oldest events are overwritten.
+// Every slot carries sequence number of the event it holds, so readers skip slots that are being written.
+//
+
+#ifndef LIBND4J_TRACE_RECORDER_H
+#define LIBND4J_TRACE_RECORDER_H
+
+#include <pointercast.h>
+#include <dll.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace nd4j {
+    namespace graph {
+        enum TracePhase {
+            TracePhase_TOTAL = 0,
+            TracePhase_PREPARATION = 1,
+            TracePhase_EXECUTION = 2,
+        };
+
+        struct TraceEvent {
+            // nanoseconds since epoch, same clock as GraphProfile::currentTime()
+            Nd4jLong start;
+            Nd4jLong duration;
+            int nodeId;
+            int threadId;
+            int phase;
+        };
+
+        class ND4J_EXPORT TraceRecorder {
+        private:
+            // per-slot seqlock: seq is -2 for empty slot, -1 while slot is written, and position of stored event once it's published
+            struct TraceSlot {
+                std::atomic<Nd4jLong> seq;
+                std::atomic<Nd4jLong> start;
+                std::atomic<Nd4jLong> duration;
+                std::atomic<int> nodeId;
+                std::atomic<int> threadId;
+                std::atomic<int> phase;
+            };
+
+            Nd4jLong _capacity;
+            std::unique_ptr<TraceSlot[]> _events;
+            std::atomic<Nd4jLong> _head;
+
+            void clearSlots();
+
+        public:
+            explicit TraceRecorder(Nd4jLong capacity = 65536);
+            ~TraceRecorder() = default;
+
+            /**
+             * This method allocates ring buffer, if it wasn't allocated yet.
+             * PLEASE NOTE: it's not thread-safe, so it should be called before concurrent recording starts
+             */
+            void prepare();
+
+            /**
+             * This method changes number of events kept, previously recorded events are dropped
+             */
+            void setCapacity(Nd4jLong capacity);
+            Nd4jLong capacity() const;
+
+            /**
+             * This method stores event, recording thread id is taken automatically.
+             * Does nothing if ring buffer wasn't prepared.
+             */
+            void record(int nodeId, TracePhase phase, Nd4jLong start, Nd4jLong duration);
+            void record(const TraceEvent &event);
+
+            /**
+             * This method returns events currently held in buffer, oldest first.
+             * Slots that are being overwritten at the moment of the call are skipped
+             */
+            std::vector<TraceEvent> events() const;
+
+            /**
+             * This method returns number of events held in buffer
+             */
+            Nd4jLong size() const;
+
+            /**
+             * This method returns number of events overwritten since last reset
+             */
+            Nd4jLong dropped() const;
+
+            void reset();
+
+            /**
+             * This method returns id of calling OS thread, stable for thread lifetime
+             */
+            static int currentThreadId();
+        };
+    }
+}
+
+#endif //LIBND4J_TRACE_RECORDER_H
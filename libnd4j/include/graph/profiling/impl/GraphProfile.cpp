@@ -21,6 +21,10 @@
 #include <graph/profiling/GraphProfile.h>
 #include <helpers/logger.h>
 #include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <stdexcept>
 
 namespace nd4j {
     namespace graph {
@@ -137,6 +141,19 @@ namespace nd4j {
 
                 v.second->merge(other->nodeById(v.first));
             }
+
+            // nodes that weren't executed before, i.e. other branch of conditional
+            for (auto v: other->_profilesById) {
+                if (!nodeExists(v.first))
+                    nodeById(v.first, v.second->name().c_str())->assign(v.second);
+            }
+
+            auto events = other->_trace.events();
+            if (!events.empty()) {
+                _trace.prepare();
+                for (auto &e: events)
+                    _trace.record(e);
+            }
         }
 
         void GraphProfile::assign(GraphProfile *other) {
@@ -153,6 +170,14 @@ namespace nd4j {
             for (auto v: other->_profilesById) {
                 nodeById(v.first, v.second->name().c_str())->assign(v.second);
             }
+
+            _trace.reset();
+            auto events = other->_trace.events();
+            if (!events.empty()) {
+                _trace.prepare();
+                for (auto &e: events)
+                    _trace.record(e);
+            }
         }
 
         bool GraphProfile::nodeExists(int id) {
@@ -194,5 +219,185 @@ namespace nd4j {
             for (auto v: _timings)
                 nd4j_printf("%s: %lld ns;\n", v.first.c_str(), v.second);
         }
+
+        void GraphProfile::traceNode(int id, TracePhase phase, Nd4jLong start, Nd4jLong duration) {
+            _trace.record(id, phase, start, duration);
+        }
+
+        TraceRecorder* GraphProfile::trace() {
+            return &_trace;
+        }
+
+        std::string GraphProfile::nodeName(int id) {
+            std::string name;
+            if (nodeExists(id))
+                name = _profilesById[id]->name();
+
+            if (name.empty())
+                name = "Node_" + std::to_string(id);
+
+            return name;
+        }
+
+        static std::string escapeJson(const std::string &value) {
+            std::string result;
+            for (auto c: value) {
+                switch (c) {
+                    case '"': result += "\\\""; break;
+                    case '\\': result += "\\\\"; break;
+                    case '\n': result += "\\n"; break;
+                    case '\t': result += "\\t"; break;
+                    default:
+                        if (static_cast<unsigned char>(c) < 0x20) {
+                            char tmp[8];
+                            snprintf(tmp, sizeof(tmp), "\\u%04x", static_cast<int>(c));
+                            result += tmp;
+                        } else
+                            result += c;
+                }
+            }
+
+            return result;
+        }
+
+        // folded stacks use ';' as frame separator and space before value
+        static std::string escapeFrame(const std::string &value) {
+            std::string result = value;
+            for (auto &c: result)
+                if (c == ';' || c == ' ' || c == '\n')
+                    c = '_';
+
+            return result;
+        }
+
+        static void writeTraceEvent(std::ostringstream &stream, bool &first, const std::string &name, const char *category, Nd4jLong ts, Nd4jLong dur, int tid, int id) {
+            if (!first)
+                stream << ",\n";
+
+            first = false;
+
+            // trace-event timestamps are microseconds, fractional part keeps nanoseconds
+            stream << "{\"name\":\"" << escapeJson(name) << "\",\"cat\":\"" << category << "\",\"ph\":\"X\",\"ts\":" << (ts / 1000) << "." << std::setw(3) << std::setfill('0') << (ts % 1000)
+                   << ",\"dur\":" << (dur / 1000) << "." << std::setw(3) << std::setfill('0') << (dur % 1000)
+                   << ",\"pid\":0,\"tid\":" << tid << ",\"args\":{\"id\":" << id << "}}";
+        }
+
+        std::string GraphProfile::asChromeTrace() {
+            std::ostringstream stream;
+            bool first = true;
+
+            stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+            stream << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"name\":\"Graph\"}}";
+            first = false;
+
+            auto events = _trace.events();
+            if (!events.empty()) {
+                auto origin = events[0].start;
+                for (auto &e: events)
+                    origin = e.start < origin ? e.start : origin;
+
+                for (auto &e: events) {
+                    auto name = nodeName(e.nodeId);
+                    switch (e.phase) {
+                        case TracePhase_PREPARATION:
+                            writeTraceEvent(stream, first, name + ":prepare", "preparation", e.start - origin, e.duration, e.threadId, e.nodeId);
+                            break;
+                        case TracePhase_EXECUTION:
+                            writeTraceEvent(stream, first, name + ":execute", "execution", e.start - origin, e.duration, e.threadId, e.nodeId);
+                            break;
+                        default:
+                            writeTraceEvent(stream, first, name, "node", e.start - origin, e.duration, e.threadId, e.nodeId);
+                    }
+                }
+            } else {
+                // no timeline recorded, so nodes are laid out one after another with their average times
+                Nd4jLong ts = 0;
+                for (auto v: _profiles) {
+                    auto merges = v->merges() > 0 ? v->merges() : 1L;
+                    auto prep = v->getPreparationTime() / merges;
+                    auto exec = v->getExecutionTime() / merges;
+                    auto total = v->getTotalTime() / merges;
+                    if (total < prep + exec)
+                        total = prep + exec;
+
+                    auto name = nodeName(v->id());
+                    writeTraceEvent(stream, first, name, "node", ts, total, 0, v->id());
+                    if (prep > 0)
+                        writeTraceEvent(stream, first, name + ":prepare", "preparation", ts, prep, 0, v->id());
+
+                    if (exec > 0)
+                        writeTraceEvent(stream, first, name + ":execute", "execution", ts + prep, exec, 0, v->id());
+
+                    ts += total;
+                }
+            }
+
+            Nd4jLong tmp = 0L;
+            Nd4jLong obj = 0L;
+            Nd4jLong act = 0L;
+            Nd4jLong ttl = 0L;
+            for (auto v: _profiles) {
+                tmp += v->getTemporarySize();
+                obj += v->getObjectsSize();
+                act += v->getActivationsSize();
+                ttl += v->getTotalSize();
+            }
+
+            stream << ",\n{\"name\":\"memory\",\"ph\":\"C\",\"ts\":0,\"pid\":0,\"args\":{\"activations\":" << act / _merges << ",\"temporary\":" << tmp / _merges
+                   << ",\"objects\":" << obj / _merges << ",\"total\":" << ttl / _merges << "}}";
+
+            stream << "\n],\"otherData\":{\"executions\":" << _merges << ",\"buildTime\":" << _buildTime / _merges << ",\"executionTime\":" << _executionTime / _merges
+                   << ",\"droppedEvents\":" << _trace.dropped() << "}}\n";
+
+            return stream.str();
+        }
+
+        std::string GraphProfile::asFoldedStacks() {
+            std::ostringstream stream;
+
+            auto line = [&](const std::string &frames, Nd4jLong value) {
+                if (value > 0)
+                    stream << frames << " " << value << "\n";
+            };
+
+            for (auto v: _profiles) {
+                auto frame = "graph;" + escapeFrame(nodeName(v->id())) + "#" + std::to_string(v->id());
+
+                auto input = v->getInputTime();
+                auto shape = v->getShapeFunctionTime();
+                auto array = v->getArrayTime();
+                auto prep = v->getPreparationTime();
+                auto exec = v->getExecutionTime();
+
+                line(frame + ";preparation;input", input);
+                line(frame + ";preparation;shape", shape);
+                line(frame + ";preparation;array", array);
+                line(frame + ";preparation", prep - input - shape - array);
+                line(frame + ";execution", exec);
+
+                // whatever executor spent around op itself
+                line(frame, v->getTotalTime() - prep - exec);
+            }
+
+            return stream.str();
+        }
+
+        static void saveString(const char *path, const std::string &content) {
+            std::ofstream file(path, std::ios::out | std::ios::trunc);
+            if (!file.is_open()) {
+                nd4j_printf("Can't open file for writing: [%s]\n", path);
+                throw std::runtime_error("Unable to save profile");
+            }
+
+            file << content;
+        }
+
+        void GraphProfile::saveChromeTrace(const char *path) {
+            saveString(path, asChromeTrace());
+        }
+
+        void GraphProfile::saveFoldedStacks(const char *path) {
+            saveString(path, asFoldedStacks());
+        }
     }
-}
\ No newline at end of file
+}
@@ -112,6 +112,42 @@ namespace nd4j {
             _inputTime += other->_inputTime;
         }
 
+        Nd4jLong NodeProfile::getBuildTime() {
+            return _buildTime;
+        }
+
+        Nd4jLong NodeProfile::getPreparationTime() {
+            return _preparationTime;
+        }
+
+        Nd4jLong NodeProfile::getExecutionTime() {
+            return _executionTime;
+        }
+
+        Nd4jLong NodeProfile::getTotalTime() {
+            return _totalTime;
+        }
+
+        Nd4jLong NodeProfile::getShapeFunctionTime() {
+            return _shapeTime;
+        }
+
+        Nd4jLong NodeProfile::getArrayTime() {
+            return _arrayTime;
+        }
+
+        Nd4jLong NodeProfile::getInputTime() {
+            return _inputTime;
+        }
+
+        Nd4jLong NodeProfile::merges() {
+            return _merges;
+        }
+
+        int NodeProfile::id() {
+            return _id;
+        }
+
         std::string& NodeProfile::name() {
             return _name;
         }
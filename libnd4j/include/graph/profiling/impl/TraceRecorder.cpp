@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+
+#include <graph/profiling/TraceRecorder.h>
+#include <thread>
+#include <functional>
+
+namespace nd4j {
+    namespace graph {
+        TraceRecorder::TraceRecorder(Nd4jLong capacity) {
+            _capacity = capacity;
+            _head.store(0);
+        }
+
+        void TraceRecorder::prepare() {
+            if (_events == nullptr && _capacity > 0) {
+                _events.reset(new TraceSlot[_capacity]);
+                clearSlots();
+            }
+        }
+
+        void TraceRecorder::clearSlots() {
+            for (Nd4jLong e = 0; e < _capacity; e++)
+                _events[e].seq.store(-2L, std::memory_order_relaxed);
+        }
+
+        void TraceRecorder::setCapacity(Nd4jLong capacity) {
+            bool prepared = _events != nullptr;
+
+            _events.reset();
+            _capacity = capacity;
+            _head.store(0);
+
+            if (prepared)
+                prepare();
+        }
+
+        Nd4jLong TraceRecorder::capacity() const {
+            return _capacity;
+        }
+
+        void TraceRecorder::record(int nodeId, TracePhase phase, Nd4jLong start, Nd4jLong duration) {
+            TraceEvent event;
+            event.start = start;
+            event.duration = duration;
+            event.nodeId = nodeId;
+            event.threadId = currentThreadId();
+            event.phase = static_cast<int>(phase);
+
+            record(event);
+        }
+
+        void TraceRecorder::record(const TraceEvent &event) {
+            if (_events == nullptr)
+                return;
+
+            auto position = _head.fetch_add(1, std::memory_order_relaxed);
+            auto &slot = _events[position % _capacity];
+
+            // writer that lapped the ring meets slow one here: only one of them may write fields, the other event is lost
+            auto seq = slot.seq.load(std::memory_order_relaxed);
+            if (seq == -1L || seq > position || !slot.seq.compare_exchange_strong(seq, -1L, std::memory_order_relaxed))
+                return;
+
+            // readers that see any of new fields will see slot as busy
+            std::atomic_thread_fence(std::memory_order_release);
+
+            slot.start.store(event.start, std::memory_order_relaxed);
+            slot.duration.store(event.duration, std::memory_order_relaxed);
+            slot.nodeId.store(event.nodeId, std::memory_order_relaxed);
+            slot.threadId.store(event.threadId, std::memory_order_relaxed);
+            slot.phase.store(event.phase, std::memory_order_relaxed);
+
+            slot.seq.store(position, std::memory_order_release);
+        }
+
+        std::vector<TraceEvent> TraceRecorder::events() const {
+            std::vector<TraceEvent> result;
+            if (_events == nullptr)
+                return result;
+
+            auto head = _head.load();
+            auto first = head > _capacity ? head - _capacity : 0L;
+            result.reserve(head - first);
+            for (Nd4jLong e = first; e < head; e++) {
+                auto &slot = _events[e % _capacity];
+                if (slot.seq.load(std::memory_order_acquire) != e)
+                    continue;
+
+                TraceEvent event;
+                event.start = slot.start.load(std::memory_order_relaxed);
+                event.duration = slot.duration.load(std::memory_order_relaxed);
+                event.nodeId = slot.nodeId.load(std::memory_order_relaxed);
+                event.threadId = slot.threadId.load(std::memory_order_relaxed);
+                event.phase = slot.phase.load(std::memory_order_relaxed);
+
+                // slot was overwritten while we were reading it
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.seq.load(std::memory_order_relaxed) != e)
+                    continue;
+
+                result.emplace_back(event);
+            }
+
+            return result;
+        }
+
+        Nd4jLong TraceRecorder::size() const {
+            if (_events == nullptr)
+                return 0L;
+
+            auto head = _head.load();
+            return head > _capacity ? _capacity : head;
+        }
+
+        Nd4jLong TraceRecorder::dropped() const {
+            auto head = _head.load();
+            return head > _capacity ? head - _capacity : 0L;
+        }
+
+        void TraceRecorder::reset() {
+            _head.store(0);
+
+            // positions start over, so stale slots must not pass as published
+            if (_events != nullptr)
+                clearSlots();
+        }
+
+        int TraceRecorder::currentThreadId() {
+            // omp_get_thread_num() is 0 for every thread outside of parallel region, i.e. for all GraphServer workers
+            static thread_local int threadId = (int) (std::hash<std::thread::id>()(std::this_thread::get_id()) & 0x7FFFFFFF);
+            return threadId;
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+//
+// Odometer-like iterator over offsets of strided array.
+//
+// Elements are visited in the same order shape::ind2subC (or shape::ind2sub for 'f' order) enumerates them,
+// but offset is advanced incrementally: one addition per element, plus carry into outer dimensions once per row.
+// Unit dimensions are dropped, and neighbouring dimensions that are contiguous relative to each other are merged,
+// so permuted and sliced views usually end up with rank 1 or 2 here.
+//
+// Typical use:
+//      StridedIterator it(rank, shape, stride, baseOffset, start);
+//      for (Nd4jLong i = start; i < end; i++, it.next())
+//          z[i] = x[it.offset()];
+//
+
+#ifndef LIBND4J_STRIDEDITERATOR_H
+#define LIBND4J_STRIDEDITERATOR_H
+
+#include <pointercast.h>
+#include <op_boilerplate.h>
+#include <helpers/shape.h>
+
+namespace nd4j {
+    class StridedIterator {
+    private:
+        int _rank;
+        Nd4jLong _shape[MAX_RANK];
+        Nd4jLong _stride[MAX_RANK];
+        Nd4jLong _coord[MAX_RANK];
+        Nd4jLong _offset;
+
+    public:
+        /**
+         * @param rank, shape, stride - array (or TAD) description
+         * @param baseOffset - offset of first element of the array
+         * @param start - linear index iteration starts from
+         * @param order - 'c' visits elements like ind2subC does, 'f' like ind2sub
+         */
+        FORCEINLINE _CUDA_HD StridedIterator(const int rank, const Nd4jLong *shape, const Nd4jLong *stride, const Nd4jLong baseOffset = 0, const Nd4jLong start = 0, const char order = 'c') {
+            _rank = 0;
+
+            // dimensions are stored from slowest to fastest
+            for (int e = 0; e < rank; e++) {
+                int d = order == 'f' ? rank - 1 - e : e;
+                if (shape[d] == 1)
+                    continue;
+
+                // previous dimension continues current one, so they're merged into single dimension
+                if (_rank > 0 && _stride[_rank - 1] == shape[d] * stride[d]) {
+                    _shape[_rank - 1] *= shape[d];
+                    _stride[_rank - 1] = stride[d];
+                    continue;
+                }
+
+                _shape[_rank] = shape[d];
+                _stride[_rank] = stride[d];
+                _rank++;
+            }
+
+            // scalar-like arrays
+            if (_rank == 0) {
+                _shape[0] = 1;
+                _stride[0] = 1;
+                _rank = 1;
+            }
+
+            // starting point is the only place where div/mod chain is used
+            _offset = baseOffset;
+            Nd4jLong index = start;
+            for (int d = _rank - 1; d >= 0; d--) {
+                _coord[d] = index % _shape[d];
+                index /= _shape[d];
+                _offset += _coord[d] * _stride[d];
+            }
+        }
+
+        FORCEINLINE _CUDA_HD Nd4jLong offset() const {
+            return _offset;
+        }
+
+        /**
+         * This method returns rank left after merging of dimensions
+         */
+        FORCEINLINE _CUDA_HD int rank() const {
+            return _rank;
+        }
+
+        FORCEINLINE _CUDA_HD void next() {
+            int d = _rank - 1;
+            _offset += _stride[d];
+            if (++_coord[d] < _shape[d])
+                return;
+
+            // carry into outer dimensions
+            while (d > 0 && _coord[d] >= _shape[d]) {
+                _offset -= _coord[d] * _stride[d];
+                _coord[d] = 0;
+                d--;
+                _offset += _stride[d];
+                _coord[d]++;
+            }
+        }
+    };
+}
+
+#endif //LIBND4J_STRIDEDITERATOR_H
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#ifndef LIBND4J_TADCACHE_H
+#define LIBND4J_TADCACHE_H
+
+#include <map>
+#include <list>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <pointercast.h>
+#include <helpers/TAD.h>
+#include <dll.h>
+
+namespace nd4j {
+
+    /**
+     * This class holds TAD shapeInfo & offsets built for specific shapeInfo/dimensions pair.
+     * Source shapeInfo and dimensions are copied, so TadPack doesn't depend on caller's buffers.
+     */
+    class ND4J_EXPORT TadPack {
+    private:
+        std::vector<Nd4jLong> _shapeInfo;
+        std::vector<int> _dimensions;
+        shape::TAD _tad;
+
+    public:
+        TadPack(Nd4jLong *shapeInfo, int *dimensions, int dimensionLength);
+        TadPack(const TadPack &other) = delete;
+        ~TadPack() = default;
+
+        Nd4jLong* tadShapeInfo();
+        Nd4jLong* tadOffsets();
+        Nd4jLong numberOfTads();
+
+        // dimensionLength after TAD squeezed unit dimensions, < 1 means there's nothing to iterate over
+        int dimensionLength();
+        bool wholeThing();
+
+        // number of bytes held by this pack
+        Nd4jLong memoryFootprint();
+    };
+
+    /**
+     * This class provides process-wide bounded LRU cache of TadPacks, keyed by (shapeInfo, dimensions).
+     * Packs are returned as shared_ptr, so eviction never invalidates arrays that are in use.
+     */
+    class ND4J_EXPORT TadCache {
+    private:
+        static TadCache* _INSTANCE;
+
+        typedef std::vector<Nd4jLong> TadKey;
+        typedef std::pair<std::shared_ptr<TadPack>, std::list<TadKey>::iterator> TadEntry;
+
+        std::mutex _lock;
+        std::map<TadKey, TadEntry> _cache;
+        std::list<TadKey> _lru;
+
+        std::atomic<Nd4jLong> _hits;
+        std::atomic<Nd4jLong> _misses;
+
+        Nd4jLong _bytes = 0L;
+        Nd4jLong _maxEntries = 4096L;
+        Nd4jLong _maxBytes = 128L * 1024L * 1024L;
+
+        TadCache();
+        ~TadCache() = default;
+
+        void evict();
+    public:
+        static TadCache* getInstance();
+
+        /**
+         * This method returns TadPack for given shapeInfo and dimensions, building it on cache miss
+         */
+        std::shared_ptr<TadPack> tadForDimensions(Nd4jLong *shapeInfo, int *dimensions, int dimensionLength);
+        std::shared_ptr<TadPack> tadForDimensions(Nd4jLong *shapeInfo, const std::vector<int> &dimensions);
+
+        /**
+         * This method sets cache limits. Packs larger than maxBytes aren't cached at all
+         */
+        void setLimits(Nd4jLong maxEntries, Nd4jLong maxBytes);
+
+        Nd4jLong hits();
+        Nd4jLong misses();
+        Nd4jLong size();
+        Nd4jLong memoryFootprint();
+
+        // drops all cached entries and resets counters
+        void purge();
+    };
+}
+
+#endif //LIBND4J_TADCACHE_H
@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#include <helpers/TadCache.h>
+#include <helpers/shape.h>
+
+namespace nd4j {
+
+    TadPack::TadPack(Nd4jLong *shapeInfo, int *dimensions, int dimensionLength) : _shapeInfo(shapeInfo, shapeInfo + shape::shapeInfoLength(shape::rank(shapeInfo))), _dimensions(dimensions, dimensions + dimensionLength) {
+        _tad.init(_shapeInfo.data(), _dimensions.data(), dimensionLength);
+        _tad.createTadOnlyShapeInfo();
+        _tad.createOffsets();
+    }
+
+    Nd4jLong* TadPack::tadShapeInfo() {
+        return _tad.tadOnlyShapeInfo;
+    }
+
+    Nd4jLong* TadPack::tadOffsets() {
+        return _tad.tadOffsets;
+    }
+
+    Nd4jLong TadPack::numberOfTads() {
+        return _tad.numTads;
+    }
+
+    int TadPack::dimensionLength() {
+        return _tad.dimensionLength;
+    }
+
+    bool TadPack::wholeThing() {
+        return _tad.wholeThing;
+    }
+
+    Nd4jLong TadPack::memoryFootprint() {
+        return _tad.numTads * sizeof(Nd4jLong) + shape::shapeInfoByteLength(_tad.tadOnlyShapeInfo) + _shapeInfo.size() * sizeof(Nd4jLong);
+    }
+
+
+    TadCache::TadCache() {
+        _hits.store(0);
+        _misses.store(0);
+    }
+
+    TadCache* TadCache::getInstance() {
+        if (_INSTANCE == 0)
+            _INSTANCE = new TadCache();
+
+        return _INSTANCE;
+    }
+
+    std::shared_ptr<TadPack> TadCache::tadForDimensions(Nd4jLong *shapeInfo, const std::vector<int> &dimensions) {
+        return tadForDimensions(shapeInfo, const_cast<int *>(dimensions.data()), (int) dimensions.size());
+    }
+
+    std::shared_ptr<TadPack> TadCache::tadForDimensions(Nd4jLong *shapeInfo, int *dimensions, int dimensionLength) {
+        // key is full shapeInfo (shape, strides, ews, order) followed by dimensions
+        auto shapeLength = shape::shapeInfoLength(shape::rank(shapeInfo));
+        TadKey key(shapeInfo, shapeInfo + shapeLength);
+        key.reserve(shapeLength + dimensionLength + 1);
+        key.emplace_back(dimensionLength);
+        for (int e = 0; e < dimensionLength; e++)
+            key.emplace_back(dimensions[e]);
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            auto it = _cache.find(key);
+            if (it != _cache.end()) {
+                _hits++;
+                _lru.splice(_lru.begin(), _lru, it->second.second);
+                return it->second.first;
+            }
+        }
+
+        _misses++;
+
+        // building TAD without lock, it might take a while for large arrays
+        auto pack = std::make_shared<TadPack>(shapeInfo, dimensions, dimensionLength);
+        auto bytes = pack->memoryFootprint();
+
+        std::lock_guard<std::mutex> lock(_lock);
+        if (bytes > _maxBytes)
+            return pack;
+
+        // other thread could build the same pack meanwhile
+        auto it = _cache.find(key);
+        if (it != _cache.end())
+            return it->second.first;
+
+        _lru.push_front(key);
+        _cache[key] = TadEntry(pack, _lru.begin());
+        _bytes += bytes;
+
+        evict();
+
+        return pack;
+    }
+
+    void TadCache::evict() {
+        while (!_lru.empty() && ((Nd4jLong) _cache.size() > _maxEntries || _bytes > _maxBytes)) {
+            auto it = _cache.find(_lru.back());
+            _bytes -= it->second.first->memoryFootprint();
+            _cache.erase(it);
+            _lru.pop_back();
+        }
+    }
+
+    void TadCache::setLimits(Nd4jLong maxEntries, Nd4jLong maxBytes) {
+        std::lock_guard<std::mutex> lock(_lock);
+        _maxEntries = maxEntries;
+        _maxBytes = maxBytes;
+
+        evict();
+    }
+
+    Nd4jLong TadCache::hits() {
+        return _hits.load();
+    }
+
+    Nd4jLong TadCache::misses() {
+        return _misses.load();
+    }
+
+    Nd4jLong TadCache::size() {
+        std::lock_guard<std::mutex> lock(_lock);
+        return (Nd4jLong) _cache.size();
+    }
+
+    Nd4jLong TadCache::memoryFootprint() {
+        std::lock_guard<std::mutex> lock(_lock);
+        return _bytes;
+    }
+
+    void TadCache::purge() {
+        std::lock_guard<std::mutex> lock(_lock);
+        _cache.clear();
+        _lru.clear();
+        _bytes = 0L;
+
+        _hits.store(0);
+        _misses.store(0);
+    }
+
+    TadCache* TadCache::_INSTANCE = 0;
+}
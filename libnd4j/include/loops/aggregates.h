@@ -48,6 +48,47 @@ namespace functions {
             inline static void exec(int opNum, T **arguments, int numArguments, Nd4jLong **shapeArguments, int numShapeArguments, int *indexArguments, int numIndexArguments, int **intArrays, int numIntArrays, T *realArguments, int numRealArguments) {
                 DISPATCH_BY_OPNUM(exec, PARAMS(arguments, numArguments, shapeArguments, numShapeArguments, indexArguments, numIndexArguments, intArrays, numIntArrays, realArguments, numRealArguments), AGGREGATE_OPS);
             }
+
+#ifndef __CUDACC__
+            /**
+             * This method executes batch of aggregates on CPU.
+             * Threads are detached from each other (hogwild for SkipGram/CBOW), and each thread keeps its own
+             * scratch buffers for the whole batch, so nothing gets allocated per aggregate.
+             */
+            inline static void execBatch(int opNum, nd4j::PointersHelper<T> &helper, int numAggregates, int maxIntArrays) {
+                // probably, we don't want too much threads as usually
+                int _threads = nd4j::math::nd4j_min<int>(numAggregates, omp_get_max_threads());
+
+#pragma omp parallel num_threads(_threads) proc_bind(close) default(shared)
+                {
+                    std::vector<int *> intArrays(nd4j::math::nd4j_max<int>(maxIntArrays, 1));
+                    aggregateOps::Word2VecScratch<T> scratch;
+
+#pragma omp for schedule(guided)
+                    for (int i = 0; i < numAggregates; i++) {
+                        auto arguments = helper.getArguments(i);
+                        auto shapes = helper.getShapeArguments(i);
+                        auto idxArg = helper.getIndexArguments(i);
+                        auto realArg = helper.getRealArguments(i);
+
+                        for (int e = 0; e < maxIntArrays; e++)
+                            intArrays[e] = helper.getIntArrayArguments(i, e);
+
+                        // opNums here match AGGREGATE_OPS
+                        switch (opNum) {
+                            case 3:
+                                aggregateOps::SkipGram<T>::executeAggregate(arguments, helper.getNumArguments(i), shapes, helper.getNumShapeArguments(i), idxArg, helper.getNumIndexArguments(i), intArrays.data(), helper.getNumIntArrayArguments(i), realArg, helper.getNumRealArguments(i), scratch);
+                                break;
+                            case 4:
+                                aggregateOps::CBOW<T>::executeAggregate(arguments, helper.getNumArguments(i), shapes, helper.getNumShapeArguments(i), idxArg, helper.getNumIndexArguments(i), intArrays.data(), helper.getNumIntArrayArguments(i), realArg, helper.getNumRealArguments(i), scratch);
+                                break;
+                            default:
+                                exec(opNum, arguments, helper.getNumArguments(i), shapes, helper.getNumShapeArguments(i), idxArg, helper.getNumIndexArguments(i), intArrays.data(), helper.getNumIntArrayArguments(i), realArg, helper.getNumRealArguments(i));
+                        }
+                    }
+                }
+            }
+#endif
 		};
     }
 }
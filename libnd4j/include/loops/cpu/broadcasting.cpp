@@ -21,6 +21,8 @@
 #include <op_boilerplate.h>
 #include <loops/broadcasting.h>
 #include <loops/legacy_ops.h>
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 
 namespace functions {
     namespace broadcast {
@@ -75,15 +77,13 @@ namespace functions {
                 //permuted version of the x shape info for setting up the tad problem
                 auto tadShapeShapeInfo = tadShapeInfo;
                 auto tadOffsets = tadOffset;
-                shape::TAD *tad = nullptr;
+                std::shared_ptr<nd4j::TadPack> tad;
 
                 if (tadShapeInfo == nullptr || tadOffsets == nullptr) {
-                    tad = new shape::TAD(xShapeInfo, dimension, dimensionLength);
-                    tad->createTadOnlyShapeInfo();
-                    tad->createOffsets();
+                    tad = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
-                    tadShapeShapeInfo = tad->tadOnlyShapeInfo;
-                    tadOffsets = tad->tadOffsets;
+                    tadShapeShapeInfo = tad->tadShapeInfo();
+                    tadOffsets = tad->tadOffsets();
                 }
 
                 //int *resultStride = shape::stride(tadShapeShapeInfo);
@@ -137,38 +137,16 @@ namespace functions {
                         auto yStride = shape::stride(yShapeInfo);
                         int yRank = shape::rank(yShapeInfo);
 
-                        Nd4jLong xCoord[MAX_RANK];
-                        Nd4jLong yCoord[MAX_RANK];
-                        Nd4jLong zCoord[MAX_RANK];
+                        // x and y are visited in x tad order, z in its own order
+                        nd4j::StridedIterator xIter(xRank, xShape, xStride, offset, 0, shape::order(tadShapeShapeInfo));
+                        nd4j::StridedIterator yIter(yRank, yShape, yStride, 0, 0, shape::order(tadShapeShapeInfo));
+                        nd4j::StridedIterator zIter(zRank, zShape, zStride, offsetZ, 0, shape::order(tadShapeInfoZ));
 
-
-                        // TODO: cover this codebranch with tests
                         // all this stuff already happens within thread
-                        for (int f = 0; f < tadLength; f++) {
-                            if (shape::order(tadShapeShapeInfo) == 'c') {
-                                shape::ind2subC(xRank, xShape, f, tadLength, xCoord);
-                                shape::ind2subC(yRank, yShape, f, tadLength, yCoord);
-                            } else {
-                                shape::ind2sub(xRank, xShape, f, tadLength, xCoord);
-                                shape::ind2sub(yRank, yShape, f, tadLength, yCoord);
-                            }
-
-                            if (shape::order(tadShapeInfoZ) == 'c')
-                                shape::ind2subC(zRank, zShape, f, tadLength, zCoord);
-                            else
-                                shape::ind2sub(zRank, zShape, f, tadLength, zCoord);
-
-                            auto xOffset = shape::getOffset(offset, xShape, xStride, xCoord, xRank);
-                            auto zOffset = shape::getOffset(offsetZ, zShape, zStride, zCoord, zRank);
-                            auto yOffset = shape::getOffset(0, yShape, yStride, yCoord, yRank);
-
-                            result[zOffset] = OpType::op(x[xOffset], y[yOffset]);
-                        }
+                        for (int f = 0; f < tadLength; f++, xIter.next(), yIter.next(), zIter.next())
+                            result[zIter.offset()] = OpType::op(x[xIter.offset()], y[yIter.offset()]);
                     }
                 }
-
-                if (tad != nullptr)
-                    delete tad;
         }
 
         template class ND4J_EXPORT Broadcast<float>;
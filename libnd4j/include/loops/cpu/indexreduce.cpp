@@ -22,6 +22,8 @@
 #include <op_boilerplate.h>
 
 #include "../legacy_ops.h"
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 
 namespace functions {
     namespace indexreduce {
@@ -60,14 +62,11 @@ namespace functions {
                 auto xShape = shape::shapeOf(xShapeInfo);
                 auto xStride = shape::stride(xShapeInfo);
                 int tadRank = shape::rank(xShapeInfo);
-                Nd4jLong xCoord[MAX_RANK];
-
-                for (Nd4jLong i = 0; i < length; i++) {
-                    shape::ind2subC(tadRank,xShape, i, length, xCoord);
-                    auto xOffset = shape::getOffset(0, xShape, xStride, xCoord, tadRank);
+                nd4j::StridedIterator xIter(tadRank, xShape, xStride);
 
+                for (Nd4jLong i = 0; i < length; i++, xIter.next()) {
                     IndexValue<T> curr;
-                    curr.value = x[xOffset];
+                    curr.value = x[xIter.offset()];
                     curr.index = i;
 
                     startingIndex = OpType::update(startingIndex, curr, extraParams);
@@ -164,21 +163,18 @@ namespace functions {
 
             auto tadOnlyShapeInfo = tadShapeInfo;
             Nd4jLong *tadOffsets = tadOffset;
-            shape::TAD *tad = nullptr;
+            std::shared_ptr<nd4j::TadPack> tad;
 
             if (tadOnlyShapeInfo == nullptr || tadOffsets == nullptr) {
-                tad = new shape::TAD(xShapeInfo, dimension, dimensionLength);
-                tad->createTadOnlyShapeInfo();
-                tad->createOffsets();
+                tad = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
-                if (tad->dimensionLength < 1) {
-                    delete tad;
+                if (tad->dimensionLength() < 1) {
                     delete[] startingIndex;
                     return;
                 }
 
-                tadOnlyShapeInfo = tad->tadOnlyShapeInfo;
-                tadOffsets = tad->tadOffsets;
+                tadOnlyShapeInfo = tad->tadShapeInfo();
+                tadOffsets = tad->tadOffsets();
             }
 
             int tadLength = shape::tadLength(xShapeInfo, dimension, dimensionLength);
@@ -208,15 +204,12 @@ namespace functions {
 
                     IndexValue<T> indexValue = OpType::startingIndexValue(&x[offset]);
 
-                    Nd4jLong xCoord[MAX_RANK];
-
-                    for(int j = 0; j < tadLength; j++) {
-                        shape::ind2subC(rank,xShape, j, tadLength, xCoord);
-                        auto  xOffset = shape::getOffset(offset, xShape, xStride, xCoord, rank);
+                    nd4j::StridedIterator xIter(rank, xShape, xStride, offset);
 
+                    for(int j = 0; j < tadLength; j++, xIter.next()) {
                         IndexValue<T> comp;
                         comp.index = j;
-                        comp.value = x[xOffset];
+                        comp.value = x[xIter.offset()];
                         indexValue = OpType::update(indexValue,comp,extraParams);
                     }
                     result[i] = indexValue.index;
@@ -21,6 +21,8 @@
 #include <op_boilerplate.h>
 #include <loops/reduce.h>
 #include <loops/legacy_ops.h>
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 
 namespace functions {
     namespace reduce {
@@ -133,20 +135,16 @@ namespace functions {
 
                 auto tadOnlyShapeInfo = tadShapeInfo;
                 auto tadOffsets = tadOffset;
-                shape::TAD *tad = nullptr;
+                std::shared_ptr<nd4j::TadPack> tad;
 
                 if (tadOnlyShapeInfo == nullptr || tadOffsets == nullptr) {
-                    tad = new shape::TAD(xShapeInfo, dimension, dimensionLength);
-                    tad->createTadOnlyShapeInfo();
-                    tad->createOffsets();
+                    tad = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
-                    if (tad->dimensionLength < 1) {
-                        delete tad;
+                    if (tad->dimensionLength() < 1)
                         return;
-                    }
 
-                    tadOnlyShapeInfo = tad->tadOnlyShapeInfo;
-                    tadOffsets = tad->tadOffsets;
+                    tadOnlyShapeInfo = tad->tadShapeInfo();
+                    tadOffsets = tad->tadOffsets();
                 }
 
 
@@ -189,23 +187,16 @@ namespace functions {
 #pragma omp  parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared)
                     for (int i = 0; i < resultLength; i++) {
                         auto offset = tadOffsets[i];
-                        Nd4jLong xCoord[MAX_RANK];
+                        nd4j::StridedIterator xIter(tadRank, tadShape, tadStride, offset);
 
                         T start = OpType::startingValue(x + offset);
 
-                        for (int j = 0; j < tadLength; j++) {
-                            shape::ind2subC(tadRank, tadShape, j, tadLength, xCoord);
-                            auto xOffset = shape::getOffset(offset, tadShape, tadStride, xCoord, tadRank);
-
-                            start = OpType::update(start, OpType::op(x[xOffset], extraParams), extraParams);
-                        }
+                        for (int j = 0; j < tadLength; j++, xIter.next())
+                            start = OpType::update(start, OpType::op(x[xIter.offset()], extraParams), extraParams);
 
                         result[i] = OpType::postProcess(start, tadLength, extraParams);;
                     }
                 }
-
-                if (tad != nullptr)
-                    delete tad;
             }
 
 
@@ -22,6 +22,8 @@
 #include <loops/summarystatsreduce.h>
 #include <helpers/shape.h>
 #include <helpers/TAD.h>
+#include <helpers/TadCache.h>
+#include <helpers/StridedIterator.h>
 
 namespace functions {
     namespace summarystats {
@@ -56,19 +58,15 @@ namespace functions {
                 return finalVal;
             }
             else {
-                Nd4jLong xCoords[MAX_RANK];
-
                 auto xShape = shape::shapeOf(xShapeInfo);
                 auto xStride = shape::stride(xShapeInfo);
                 int xRank = shape::rank(xShapeInfo);
 
+                nd4j::StridedIterator xIter(xRank, xShape, xStride);
 
-                for (Nd4jLong i = 0; i < length; i++) {
-                    shape::ind2subC(xRank, xShape, i, length, xCoords);
-                    auto xOffset = shape::getOffset(0, xShape, xStride, xCoords, xRank);
-
+                for (Nd4jLong i = 0; i < length; i++, xIter.next()) {
                     SummaryStatsData<T> curr;
-                    curr.initWithValue(x[xOffset]);
+                    curr.initWithValue(x[xIter.offset()]);
                     startingIndex = update(startingIndex, curr, extraParams);
                 }
 
@@ -86,26 +84,27 @@ namespace functions {
             }
 
 
-            shape::TAD tad(xShapeInfo, dimension, dimensionLength);
-            tad.createTadOnlyShapeInfo();
-            tad.createOffsets();
+            auto tad = nd4j::TadCache::getInstance()->tadForDimensions(xShapeInfo, dimension, dimensionLength);
 
             //no-op
-            if (tad.dimensionLength < 1)
+            if (tad->dimensionLength() < 1)
                 return;
 
+            auto tadOnlyShapeInfo = tad->tadShapeInfo();
+            auto tadOffsets = tad->tadOffsets();
+
             int resultLength = shape::length(resultShapeInfoBuffer);
             //pre squeezed: this is for keeping the pointer to the original
             //shape information for tad offset
             //the squeezed information doesn't render the right strides for
             //tad offset
-            if (resultLength == 1 || dimensionLength == shape::rank(xShapeInfo) || tad.wholeThing) {
+            if (resultLength == 1 || dimensionLength == shape::rank(xShapeInfo) || tad->wholeThing()) {
                 result[0] = execScalar<OpType>(biasCorrected, x, xShapeInfo, extraParams);
                 return;
             }
 
-            if (!(shape::elementWiseStride(tad.tadOnlyShapeInfo) > 0 && (tad.numTads == 1 || shape::isVector(tad.tadOnlyShapeInfo) ||
-                                                                         shape::isScalar(tad.tadOnlyShapeInfo) || tad.wholeThing)) && !(dimensionLength > 1)) {
+            if (!(shape::elementWiseStride(tadOnlyShapeInfo) > 0 && (tad->numberOfTads() == 1 || shape::isVector(tadOnlyShapeInfo) ||
+                                                                         shape::isScalar(tadOnlyShapeInfo) || tad->wholeThing())) && !(dimensionLength > 1)) {
 
                 /**
                  * The element wise stride belong longs to a reduction index.
@@ -117,14 +116,14 @@ namespace functions {
                  * along long which to iterate.
                  */
 
-                auto tadShapeShapeInfo = tad.tadOnlyShapeInfo;
+                auto tadShapeShapeInfo = tadOnlyShapeInfo;
 
                 auto xShape = shape::shapeOf(tadShapeShapeInfo);
                 auto xStride = shape::stride(tadShapeShapeInfo);
                 int rank = shape::rank(tadShapeShapeInfo);
 #pragma omp parallel for schedule(guided) default(shared)
                 for (int i = 0; i < resultLength; i++) {
-                    auto offset = tad.tadOffsets[i];
+                    auto offset = tadOffsets[i];
                     Nd4jLong shapeIter[MAX_RANK];
                     Nd4jLong coord[MAX_RANK];
                     int dim;
@@ -162,12 +161,12 @@ namespace functions {
             }
             else {
                 if (dimensionLength == 1) {
-                    auto tadElementWiseStride = shape::elementWiseStride(tad.tadOnlyShapeInfo);
-                    auto tadLength = shape::length(tad.tadOnlyShapeInfo);
+                    auto tadElementWiseStride = shape::elementWiseStride(tadOnlyShapeInfo);
+                    auto tadLength = shape::length(tadOnlyShapeInfo);
 
 #pragma omp parallel for schedule(guided) default(shared)
                     for (int i = 0; i < resultLength; i++) {
-                        Nd4jLong baseOffset = tad.tadOffsets[i];
+                        Nd4jLong baseOffset = tadOffsets[i];
                         SummaryStatsData<T> comp;
                         comp.initWithValue(x[baseOffset]);
 // FIXME: reduction to be used here
@@ -180,28 +179,25 @@ namespace functions {
                         result[i] = OpType::getValue(biasCorrected, comp);
                     }
                 } else {
-                    auto tadShapeShapeInfo = tad.tadOnlyShapeInfo;
+                    auto tadShapeShapeInfo = tadOnlyShapeInfo;
 
                     auto tadShape = shape::shapeOf(tadShapeShapeInfo);
                     auto tadStride = shape::stride(tadShapeShapeInfo);
                     auto tadRank = shape::rank(tadShapeShapeInfo);
-                    auto tadLength = shape::length(tad.tadOnlyShapeInfo);
+                    auto tadLength = shape::length(tadOnlyShapeInfo);
 
 #pragma omp parallel for schedule(guided) default(shared)
                     for (int r = 0; r < resultLength; r++) {
-                        Nd4jLong xCoord[MAX_RANK];
-                        auto tadOffsetForBlock = tad.tadOffsets[r];
+                        auto tadOffsetForBlock = tadOffsets[r];
+                        nd4j::StridedIterator xIter(tadRank, tadShape, tadStride, tadOffsetForBlock, 1);
 
                         SummaryStatsData<T> comp;
                         comp.initWithValue(x[tadOffsetForBlock]);
 
 // FIXME: reduction should be fixed
-                        for (int i = 1; i < tadLength; i ++) {
-                            shape::ind2subC(tadRank, tadShape, i, tadLength, xCoord);
-                            auto xOffset = shape::getOffset(tadOffsetForBlock, tadShape, tadStride, xCoord, tadRank);
-
+                        for (int i = 1; i < tadLength; i++, xIter.next()) {
                             SummaryStatsData <T> indexVal2;
-                            indexVal2.initWithValue(x[xOffset]);
+                            indexVal2.initWithValue(x[xIter.offset()]);
 
                             comp = update(comp, OpType::op(indexVal2, extraParams), extraParams);
                         }
@@ -215,5 +211,9 @@ namespace functions {
         template class ND4J_EXPORT SummaryStatsReduce<float>;
         template class ND4J_EXPORT SummaryStatsReduce<float16>;
         template class ND4J_EXPORT SummaryStatsReduce<double>;
+
+        BUILD_CALL_1(template float SummaryStatsReduce<float>::execScalar, float, (const bool, float*, Nd4jLong*, float*), SUMMARY_STATS_OPS)
+        BUILD_CALL_1(template float16 SummaryStatsReduce<float16>::execScalar, float16, (const bool, float16*, Nd4jLong*, float16*), SUMMARY_STATS_OPS)
+        BUILD_CALL_1(template double SummaryStatsReduce<double>::execScalar, double, (const bool, double*, Nd4jLong*, double*), SUMMARY_STATS_OPS)
     }
 }
\ No newline at end of file
@@ -22,6 +22,8 @@
 #include <op_boilerplate.h>
 #include <loops/type_conversions.h>
 #include <OmpLaunchHelper.h>
+#include <vector>
+#include <cstring>
 
 namespace nd4j {
 
@@ -183,6 +185,160 @@ namespace nd4j {
         }
     }
 
+    static FORCEINLINE void writeVarint(std::vector<uint8_t> &stream, uint64_t v) {
+        while (v >= 0x80) {
+            stream.push_back(static_cast<uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        stream.push_back(static_cast<uint8_t>(v));
+    }
+
+    static FORCEINLINE uint64_t readVarint(uint8_t *&ptr) {
+        uint64_t v = 0;
+        int shift = 0;
+        uint8_t b;
+        do {
+            b = *ptr++;
+            v |= static_cast<uint64_t>(b & 0x7F) << shift;
+            shift += 7;
+        } while (b & 0x80);
+
+        return v;
+    }
+
+    Nd4jLong TypeCast::estimateThresholdV2Size(Nd4jLong limit) {
+        // varint of 64-bit value never takes more than 10 bytes
+        return (THRESHOLD_V2_HEADER + 3 * THRESHOLD_V2_MAX_BLOCKS) * sizeof(Nd4jLong) + limit * 10;
+    }
+
+    Nd4jLong TypeCast::thresholdV2Length(void *dx) {
+        auto header = reinterpret_cast<Nd4jLong *>(dx);
+        return (THRESHOLD_V2_HEADER + 3 * header[4]) * sizeof(Nd4jLong) + header[5];
+    }
+
+    template <typename T>
+    void TypeCast::convertToThresholdV2(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz) {
+        FloatBits fb;
+        auto x = reinterpret_cast<T *>(dx);
+        auto header = reinterpret_cast<Nd4jLong *>(dz);
+        Nd4jLong limit = header[0];
+        fb.i_ = reinterpret_cast<int *>(dz)[4];
+        float threshold = fb.f_;
+        header[1] = N;
+
+        int blocks = nd4j::math::nd4j_min<int>(OmpLaunchHelper::betterThreads(N), THRESHOLD_V2_MAX_BLOCKS);
+        Nd4jLong span = OmpLaunchHelper::betterSpan(N, blocks);
+
+        T tt = static_cast<T>(threshold);
+        T mtt = -tt;
+
+        // every block collects its own hits, so there's no shared counter to fight for
+        std::vector<std::vector<Nd4jLong>> hits(blocks);
+#pragma omp parallel for num_threads(blocks) schedule(static, 1)
+        for (int b = 0; b < blocks; b++) {
+            Nd4jLong start = span * b;
+            Nd4jLong stop = nd4j::math::nd4j_min<Nd4jLong>(span * (b + 1), N);
+
+            auto &local = hits[b];
+            for (Nd4jLong e = start; e < stop && static_cast<Nd4jLong>(local.size()) < limit; e++) {
+                T cUpd = x[e];
+                if (cUpd >= tt)
+                    local.push_back(e + 1);
+                else if (cUpd <= mtt)
+                    local.push_back(-e - 1);
+            }
+        }
+
+        // limit is applied in index order: earlier blocks win
+        std::vector<Nd4jLong> accepted(blocks);
+        Nd4jLong total = 0;
+        for (int b = 0; b < blocks; b++) {
+            accepted[b] = nd4j::math::nd4j_max<Nd4jLong>(0, nd4j::math::nd4j_min<Nd4jLong>(static_cast<Nd4jLong>(hits[b].size()), limit - total));
+            total += accepted[b];
+        }
+
+        // now each block encodes its accepted hits and updates source
+        std::vector<std::vector<uint8_t>> streams(blocks);
+#pragma omp parallel for num_threads(blocks) schedule(static, 1)
+        for (int b = 0; b < blocks; b++) {
+            auto &local = hits[b];
+            auto &stream = streams[b];
+            stream.reserve(accepted[b] * 2);
+
+            Nd4jLong prev = span * b - 1;
+            for (Nd4jLong e = 0; e < accepted[b]; e++) {
+                auto v = local[e];
+                bool negative = v < 0;
+                Nd4jLong idx = negative ? -v - 1 : v - 1;
+
+                writeVarint(stream, (static_cast<uint64_t>(idx - prev) << 1) | (negative ? 1 : 0));
+                prev = idx;
+
+                if (negative)
+                    x[idx] += tt;
+                else
+                    x[idx] -= tt;
+            }
+        }
+
+        // prefix sum gives every non-empty block its place in payload
+        auto table = header + THRESHOLD_V2_HEADER;
+        Nd4jLong numBlocks = 0;
+        Nd4jLong payloadLength = 0;
+        std::vector<Nd4jLong> offsets(blocks);
+        for (int b = 0; b < blocks; b++) {
+            if (accepted[b] == 0)
+                continue;
+
+            offsets[b] = payloadLength;
+            table[numBlocks * 3] = payloadLength;
+            table[numBlocks * 3 + 1] = accepted[b];
+            table[numBlocks * 3 + 2] = span * b - 1;
+
+            payloadLength += static_cast<Nd4jLong>(streams[b].size());
+            numBlocks++;
+        }
+
+        header[3] = total;
+        header[4] = numBlocks;
+        header[5] = payloadLength;
+
+        auto payload = reinterpret_cast<uint8_t *>(table + numBlocks * 3);
+#pragma omp parallel for num_threads(blocks) schedule(static, 1)
+        for (int b = 0; b < blocks; b++) {
+            if (accepted[b] > 0)
+                memcpy(payload + offsets[b], streams[b].data(), streams[b].size());
+        }
+    }
+
+    template <typename T>
+    void TypeCast::convertFromThresholdV2(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz) {
+        FloatBits fb;
+        auto z = reinterpret_cast<T *>(dz);
+        auto header = reinterpret_cast<Nd4jLong *>(dx);
+        fb.i_ = reinterpret_cast<int *>(dx)[4];
+        T threshold = static_cast<T>(fb.f_);
+        T mthreshold = -threshold;
+
+        Nd4jLong numBlocks = header[4];
+        auto table = header + THRESHOLD_V2_HEADER;
+        auto payload = reinterpret_cast<uint8_t *>(table + numBlocks * 3);
+
+        // blocks cover disjoint index ranges, so they can be decoded independently
+#pragma omp parallel for schedule(dynamic, 1)
+        for (Nd4jLong b = 0; b < numBlocks; b++) {
+            auto ptr = payload + table[b * 3];
+            Nd4jLong count = table[b * 3 + 1];
+            Nd4jLong idx = table[b * 3 + 2];
+
+            for (Nd4jLong e = 0; e < count; e++) {
+                auto v = readVarint(ptr);
+                idx += static_cast<Nd4jLong>(v >> 1);
+                z[idx] += (v & 1) ? mthreshold : threshold;
+            }
+        }
+    }
+
     /**
      * This is cpu version, so leave it here as inline, to avoid templates instantiation
      *
@@ -229,6 +385,14 @@ namespace nd4j {
     template void TypeCast::convertToThreshold<float16>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
     template void TypeCast::convertToThreshold<double>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
 
+    template void TypeCast::convertFromThresholdV2<float>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
+    template void TypeCast::convertFromThresholdV2<float16>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
+    template void TypeCast::convertFromThresholdV2<double>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
+
+    template void TypeCast::convertToThresholdV2<float>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
+    template void TypeCast::convertToThresholdV2<float16>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
+    template void TypeCast::convertToThresholdV2<double>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
+
     template void TypeCast::convertFromQuantized<float>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
     template void TypeCast::convertFromQuantized<float16>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
     template void TypeCast::convertFromQuantized<double>(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
@@ -35,6 +35,7 @@
 #include <pairwise_util.h>
 #include <dll.h>
 #include <helpers/shape.h>
+#include <helpers/StridedIterator.h>
 #include <ops/ops.h>
 #include <op_boilerplate.h>
 
@@ -903,9 +904,6 @@ template<typename OpType>
 
 
                 else {
-                    Nd4jLong xCoords[MAX_RANK];
-                    Nd4jLong yCoords[MAX_RANK];
-
                     int xRank = shape::rank(xShapeInfo);
                     int yRank = shape::rank(yShapeInfo);
 
@@ -914,15 +912,11 @@ template<typename OpType>
                     Nd4jLong *yShape = shape::shapeOf(yShapeInfo);
                     Nd4jLong *yStride = shape::stride(yShapeInfo);
 
-                    for(unsigned int i = 0 ;i < length; i++) {
-                        shape::ind2subC(xRank, xShape, i, xCoords);
-                        shape::ind2subC(yRank, yShape, i, yCoords);
-
-                        Nd4jLong offset = shape::getOffset(0, xShape, xStride, xCoords, xRank);
-                        Nd4jLong yOffset = shape::getOffset(0, yShape, yStride, yCoords, yRank);
+                    nd4j::StridedIterator xIter(xRank, xShape, xStride);
+                    nd4j::StridedIterator yIter(yRank, yShape, yStride);
 
-                        startingVal = OpType::update(startingVal, OpType::op(x[offset], y[yOffset], extraParamsVals), extraParamsVals);
-                    }
+                    for(unsigned int i = 0 ;i < length; i++, xIter.next(), yIter.next())
+                        startingVal = OpType::update(startingVal, OpType::op(x[xIter.offset()], y[yIter.offset()], extraParamsVals), extraParamsVals);
                 }
 
                 return OpType::postProcess(startingVal, length, extraParamsVals);;
@@ -958,12 +952,9 @@ template<typename OpType>
                 int yRank = shape::rank(yTadShapeInfo);
 
 
-                Nd4jLong xCoord[MAX_RANK];
-                Nd4jLong yCoord[MAX_RANK];
-
                 T startingVal = OpType::startingValue(x);
 
-#pragma  omp parallel for proc_bind(AFFINITY) default(shared) private(xCoord, yCoord)
+#pragma  omp parallel for proc_bind(AFFINITY) default(shared)
                 for (Nd4jLong r = 0; r < xTads; r++) {
                     Nd4jLong xOffset = xOffsets[r];
 
@@ -982,24 +973,11 @@ template<typename OpType>
                             localExtraParams[extraParamsIdx] = startingVal;
                         }
 
-                        for (int f = 0; f < xTadLength; f++) {
-                            if (shape::order(yTadShapeInfo) == 'c') {
-                                shape::ind2subC(yRank, yShape, f, yCoord);
-                            } else {
-                                shape::ind2sub(yRank, yShape, f, yCoord);
-                            }
+                        nd4j::StridedIterator xIter(xRank, xShape, xStride, 0, 0, shape::order(xTadShapeInfo));
+                        nd4j::StridedIterator yIter(yRank, yShape, yStride, 0, 0, shape::order(yTadShapeInfo));
 
-                            if (shape::order(xTadShapeInfo) == 'c') {
-                                shape::ind2subC(xRank, xShape, f, xCoord);
-                            } else {
-                                shape::ind2sub(xRank, xShape, f, xCoord);
-                            }
-
-                            Nd4jLong xO = shape::getOffset(0, xShape, xStride, xCoord, xRank);
-                            Nd4jLong yO = shape::getOffset(0, yShape, yStride, yCoord, yRank);
-
-                            result[ri] = OpType::update(result[ri], OpType::op(lX[xO], lY[yO], localExtraParams), localExtraParams);
-                        }
+                        for (int f = 0; f < xTadLength; f++, xIter.next(), yIter.next())
+                            result[ri] = OpType::update(result[ri], OpType::op(lX[xIter.offset()], lY[yIter.offset()], localExtraParams), localExtraParams);
 
                         result[ri] = OpType::postProcess(result[ri], xTadLength, localExtraParams);
 
@@ -1042,6 +1020,24 @@ template<typename OpType>
                 nd4j_printf("TO[0]: %lld\n", tadOffsets[0]);
                 nd4j_printf("dimLength: %i\n", dimensionLength);
 */
+                exec<OpType>(x, xShapeInfo, extraParams, y, yShapeInfo, result, resultShapeInfoBuffer, dimension, dimensionLength, tadShapeInfo, tadOffsets, yShapeInfo, nullptr);
+            }
+
+            /**
+             * Same as above, but y has x shape and is reduced TAD by TAD against x.
+             * If yTadOffsets is nullptr, whole y is used as single TAD for every x TAD.
+             */
+            template<typename OpType>
+            static void exec(
+                    T *x,
+                    Nd4jLong *xShapeInfo,
+                    T *extraParams,
+                    T *y,
+                    Nd4jLong *yShapeInfo,
+                    T *result,
+                    Nd4jLong *resultShapeInfoBuffer,
+                    int *dimension,
+                    int dimensionLength, Nd4jLong *tadShapeInfo, Nd4jLong *tadOffsets, Nd4jLong *yTadShapeInfo, Nd4jLong *yTadOffsets) {
                 T startingVal = OpType::startingValue(x);
 
                 auto tadLength = shape::tadLength(xShapeInfo, dimension, dimensionLength);
@@ -1051,18 +1047,15 @@ template<typename OpType>
                 auto *xStride = shape::stride(tadShapeInfo);
                 int xRank = shape::rank(tadShapeInfo);
 
-                auto *yShape = shape::shapeOf(yShapeInfo);
-                auto *yStride = shape::stride(yShapeInfo);
-                int yRank = shape::rank(yShapeInfo);
+                auto *yShape = shape::shapeOf(yTadShapeInfo);
+                auto *yStride = shape::stride(yTadShapeInfo);
+                int yRank = shape::rank(yTadShapeInfo);
 
                 //shape::printShapeInfoLinear(xShapeInfo);
                 //shape::printShapeInfoLinear(yShapeInfo);
                 //shape::printShapeInfoLinear(resultShapeInfoBuffer);
                 //shape::printShapeInfoLinear(tadShapeInfo);
 
-                Nd4jLong xCoord[MAX_RANK];
-                Nd4jLong yCoord[MAX_RANK];
-
 //#pragma  omp parallel for proc_bind(AFFINITY) default(shared)
                 for (Nd4jLong r = 0; r < tads; r++) {
                     Nd4jLong offset = tadOffsets[r];
@@ -1074,20 +1067,13 @@ template<typename OpType>
                         localExtraParams[extraParamsIdx] = startingVal;
                     }
 
-                    for (Nd4jLong f = 0; f < tadLength; f++) {
-                        if (shape::order(tadShapeInfo) == 'c') {
-                            shape::ind2subC(xRank, xShape, f, xCoord);
-                            shape::ind2subC(yRank, yShape, f, yCoord);
-                        } else {
-                            shape::ind2sub(xRank, xShape, f, xCoord);
-                            shape::ind2sub(yRank, yShape, f, yCoord);
-                        }
+                    Nd4jLong yOffset = yTadOffsets == nullptr ? 0 : yTadOffsets[r];
 
-                        Nd4jLong xOffset = shape::getOffset(offset, xShape, xStride, xCoord, xRank);
-                        Nd4jLong yOffset = shape::getOffset(0, yShape, yStride, yCoord, yRank);
+                    nd4j::StridedIterator xIter(xRank, xShape, xStride, offset, 0, shape::order(tadShapeInfo));
+                    nd4j::StridedIterator yIter(yRank, yShape, yStride, yOffset, 0, shape::order(tadShapeInfo));
 
-                        result[r] = OpType::update(result[r], OpType::op(x[xOffset], y[yOffset], localExtraParams), localExtraParams);
-                    }
+                    for (Nd4jLong f = 0; f < tadLength; f++, xIter.next(), yIter.next())
+                        result[r] = OpType::update(result[r], OpType::op(x[xIter.offset()], y[yIter.offset()], localExtraParams), localExtraParams);
 
                     result[r] = OpType::postProcess(result[r], tadLength, localExtraParams);
 
@@ -1294,28 +1280,14 @@ template<typename OpType>
                                 auto yStride = !xTadBigger ? yTad.tadStride : shape::stride(yShapeInfo);
                                 int xRank = xTadBigger ? shape::rank(xTad.tadOnlyShapeInfo) : shape::rank(xShapeInfo);
                                 int yRank = !xTadBigger ? shape::rank(yTad.tadOnlyShapeInfo) : shape::rank(yShapeInfo);
-                                Nd4jLong coord[MAX_RANK];
-                                Nd4jLong yCoord[MAX_RANK];
+                                nd4j::StridedIterator xIter(xRank, xShape, xStride, xOffset);
+                                nd4j::StridedIterator yIter(yRank, yShape, yStride, yOffset);
                                 T start = OpType::startingValue(x);
 
                                 for (int j = 0; j < tadLength; j++) {
-                                    if(xTadBigger) {
-                                        shape::ind2subC(shape::rank(xTad.tadOnlyShapeInfo),
-                                                        xTad.tadStride, j, coord);
-                                        shape::ind2subC(shape::rank(yShapeInfo),
-                                                        shape::shapeOf(yShapeInfo), j, yCoord);
-                                    }
-                                    else {
-                                        shape::ind2subC(shape::rank(xShapeInfo), shape::shapeOf(xShapeInfo), j, coord);
-                                        shape::ind2subC(shape::rank(yTad.tadOnlyShapeInfo),
-                                                        yTad.tadShape, j, yCoord);
-                                    }
-
-
-
-                                    int xOffset2 =  shape::getOffset(xOffset,xShape,xStride,coord,xRank);
-                                    int yOffset2 =  shape::getOffset(yOffset,yShape,yStride,yCoord,yRank);
-                                    start = OpType::update(start, OpType::op(x[xOffset2], y[yOffset2],extraParams), extraParamsVals);
+                                    start = OpType::update(start, OpType::op(x[xIter.offset()], y[yIter.offset()],extraParams), extraParamsVals);
+                                    xIter.next();
+                                    yIter.next();
                                 }
 
                                 result[i] = OpType::postProcess(start, shape::length(iterationTadInfo), extraParamsVals);
@@ -1335,21 +1307,20 @@ template<typename OpType>
                         int num_threads = nd4j::math::nd4j_max<int>(1, tadsPerThread);
                         num_threads = nd4j::math::nd4j_min<int>(num_threads, omp_get_max_threads());
 
-                        Nd4jLong coord[MAX_RANK];
-
-//#pragma omp  parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared) private(coord)
+//#pragma omp  parallel for schedule(guided) num_threads(num_threads) if (num_threads > 1) proc_bind(AFFINITY) default(shared)
                         for (int i = 0; i < resultLength; i++) {
                             Nd4jLong xOffset = xTad.tadOffsets[i];
                             Nd4jLong yOffset = yTad.tadOffsets[i];
 
+                            nd4j::StridedIterator xIter(shape::rank(xTad.tadOnlyShapeInfo), shape::shapeOf(xTad.tadOnlyShapeInfo), shape::stride(xTad.tadOnlyShapeInfo), xOffset);
+                            nd4j::StridedIterator yIter(shape::rank(yTad.tadOnlyShapeInfo), shape::shapeOf(yTad.tadOnlyShapeInfo), shape::stride(yTad.tadOnlyShapeInfo), yOffset);
 
                             T start = OpType::startingValue(x + xOffset);
 
                             for (int j = 0; j < tadLength; j++) {
-                                shape::ind2subC(shape::rank(iterationTadInfo), shape::shapeOf(iterationTadInfo), j, coord);
-                                Nd4jLong xOffset2 = shape::getOffset(xOffset,shape::shapeOf(xTad.tadOnlyShapeInfo),shape::stride(xTad.tadOnlyShapeInfo),coord,shape::rank(xTad.tadOnlyShapeInfo));
-                                Nd4jLong yOffset2 = shape::getOffset(yOffset,shape::shapeOf(yTad.tadOnlyShapeInfo),shape::stride(yTad.tadOnlyShapeInfo),coord,shape::rank(yTad.tadOnlyShapeInfo));
-                                start = OpType::update(start, OpType::op(x[xOffset2], y[yOffset2],extraParamsVals), extraParamsVals);
+                                start = OpType::update(start, OpType::op(x[xIter.offset()], y[yIter.offset()],extraParamsVals), extraParamsVals);
+                                xIter.next();
+                                yIter.next();
                             }
 
                             result[i] = OpType::postProcess(start, shape::length(iterationTadInfo), extraParamsVals);
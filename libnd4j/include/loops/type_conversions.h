@@ -33,6 +33,7 @@
 #define ND4J_FLOAT32 6
 #define ND4J_DOUBLE 7
 #define ND4J_THRESHOLD 8
+#define ND4J_THRESHOLD_V2 9
 #define ND4J_FLOAT24 119 // not supported after all. might want to add support later.
 
 #include <ops/ops.h>
@@ -48,6 +49,18 @@
 #define NUM_BANKS 32
 #define LOG_NUM_BANKS 4
 
+// threshold v2 layout, in Nd4jLong words:
+// [0] limit: max number of encoded elements, set by caller
+// [1] N: length of original array
+// [2] threshold: FloatBits in first int of this word (i.e. int[4]), set by caller
+// [3] number of encoded elements
+// [4] number of blocks
+// [5] payload length, in bytes
+// then 3 words per block: payload offset, number of elements, base index
+// then payload: varint-encoded (delta << 1 | sign) per element, deltas restart at each block base
+#define THRESHOLD_V2_HEADER 6
+#define THRESHOLD_V2_MAX_BLOCKS 256
+
 
 namespace nd4j {
 
@@ -69,6 +82,18 @@ namespace nd4j {
         template <typename T>
         static _CUDA_H void convertFromThreshold(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
 
+        template <typename T>
+        static _CUDA_H void convertToThresholdV2(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
+
+        template <typename T>
+        static _CUDA_H void convertFromThresholdV2(Nd4jPointer * extras, void *dx, Nd4jLong N, void *dz);
+
+        // returns number of bytes caller should allocate for v2 encoding of at most limit elements
+        static _CUDA_H Nd4jLong estimateThresholdV2Size(Nd4jLong limit);
+
+        // returns actual number of bytes occupied by given v2 encoded buffer
+        static _CUDA_H Nd4jLong thresholdV2Length(void *dx);
+
         static _CUDA_H Nd4jLong estimateQuantizedSize(Nd4jLong rawSize);
 
         template <typename T>
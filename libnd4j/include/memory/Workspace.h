@@ -55,11 +55,13 @@ namespace nd4j {
             Nd4jLong _initialSize = 0L;
             Nd4jLong _currentSize = 0L;
 
-            std::mutex _mutexAllocation;
             std::mutex _mutexSpills;
 
             bool _externalized = false;
 
+            // if true, arena gets resized on scopeOut() to fit the whole cycle, so next cycles won't spill
+            bool _learning = true;
+
             std::vector<void*> _spills;
 
             std::atomic<Nd4jLong> _spillsSize;
@@ -67,7 +69,11 @@ namespace nd4j {
 
             void init(Nd4jLong bytes);
             void freeSpills();
+            void* allocateSpill(Nd4jLong numBytes);
         public:
+            // all allocations within workspace are aligned to this number of bytes
+            static const Nd4jLong ALIGNMENT = 16L;
+
             explicit Workspace(ExternalWorkspace *external);
             explicit Workspace(Nd4jLong initialSize = 0);
             ~Workspace();
@@ -83,6 +89,12 @@ namespace nd4j {
 
 //            bool resizeSupported();
 
+            /**
+             * This method toggles cycle learning: when enabled, scopeOut() grows the arena to the footprint of the finished cycle
+             */
+            void setLearning(bool reallyLearn);
+            bool isLearning();
+
             void* allocateBytes(Nd4jLong numBytes);
             void* allocateBytes(MemoryType type, Nd4jLong numBytes);
 
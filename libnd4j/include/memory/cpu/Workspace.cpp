@@ -46,6 +46,9 @@ namespace nd4j {
 
                 _externalized = true;
             }
+
+            // external memory isn't ours to resize
+            _learning = false;
         };
 
         Workspace::Workspace(Nd4jLong initialSize) {
@@ -121,41 +124,43 @@ namespace nd4j {
         }
 
 
-        void* Workspace::allocateBytes(Nd4jLong numBytes) {
-            if (numBytes < 1) {
-                nd4j_printf("Bad number of bytes requested for allocation: %i\n", numBytes);
-                throw std::invalid_argument("Number of bytes for allocation should be positive");
-            }
+        void* Workspace::allocateSpill(Nd4jLong numBytes) {
+            nd4j_debug("Allocating %lld bytes in spills\n", numBytes);
 
-            //numBytes += 32;
-            void* result = nullptr;
-            this->_cycleAllocations += numBytes;
-            this->_mutexAllocation.lock();
+            void *p = malloc(numBytes);
 
-            if (_offset.load() + numBytes > _currentSize) {
-                nd4j_debug("Allocating %lld bytes in spills\n", numBytes);
-                this->_mutexAllocation.unlock();
+            CHECK_ALLOC(p, "Failed to allocate new workspace");
 
-                void *p = malloc(numBytes);
+            _mutexSpills.lock();
+            _spills.push_back(p);
+            _mutexSpills.unlock();
 
-                CHECK_ALLOC(p, "Failed to allocate new workspace");
+            _spillsSize += numBytes;
 
-                _mutexSpills.lock();
-                _spills.push_back(p);
-                _mutexSpills.unlock();
-
-                _spillsSize += numBytes;
+            return p;
+        }
 
-                return p;
+        void* Workspace::allocateBytes(Nd4jLong numBytes) {
+            if (numBytes < 1) {
+                nd4j_printf("Bad number of bytes requested for allocation: %i\n", numBytes);
+                throw std::invalid_argument("Number of bytes for allocation should be positive");
             }
 
-            result = (void *)(_ptrHost + _offset.load());
-            _offset += numBytes;
-            //memset(result, 0, (int) numBytes);
+            // we keep every allocation aligned, so offsets handed out are aligned as well
+            numBytes = (numBytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
 
-            nd4j_debug("Allocating %lld bytes from workspace; Current PTR: %p; Current offset: %lld\n", numBytes, result, _offset.load());
+            this->_cycleAllocations += numBytes;
+
+            // bump pointer: we just move offset forward with CAS, no locks involved
+            Nd4jLong offset = _offset.load(std::memory_order_relaxed);
+            do {
+                if (offset + numBytes > _currentSize)
+                    return allocateSpill(numBytes);
+            } while (!_offset.compare_exchange_weak(offset, offset + numBytes, std::memory_order_relaxed));
 
-            this->_mutexAllocation.unlock();
+            void* result = (void *)(_ptrHost + offset);
+
+            nd4j_debug("Allocating %lld bytes from workspace; Current PTR: %p; Current offset: %lld\n", numBytes, result, offset + numBytes);
 
             return result;
         }
@@ -166,14 +171,35 @@ namespace nd4j {
 
         void Workspace::scopeIn() {
             freeSpills();
-            init(_cycleAllocations.load());
+
+            if (_learning && !_externalized)
+                init(_cycleAllocations.load());
+
             _cycleAllocations = 0;
         }
 
         void Workspace::scopeOut() {
+            // footprint of this cycle: everything that went to arena plus everything that spilled
+            auto footprint = _offset.load() + _spillsSize.load();
+
+            if (_learning && !_externalized && footprint > _currentSize) {
+                nd4j_debug("Resizing workspace from %lld to %lld bytes\n", _currentSize, footprint);
+
+                freeSpills();
+                init(footprint);
+            }
+
             _offset = 0;
         }
 
+        void Workspace::setLearning(bool reallyLearn) {
+            _learning = reallyLearn;
+        }
+
+        bool Workspace::isLearning() {
+            return _learning;
+        }
+
         Nd4jLong Workspace::getSpilledSize() {
             return _spillsSize.load();
         }
@@ -1566,6 +1566,7 @@ struct __registratorSynonymDouble_##NAME {\
 
 #define INPUT_VARIABLE(INDEX)     reinterpret_cast<nd4j::NDArray<T> *>(block.getVariable(INDEX)->getNDArray())
 #define OUTPUT_VARIABLE(INDEX)    reinterpret_cast<nd4j::NDArray<T> *>(this->getZ(block, INDEX))
+#define INPUT_INDICES(INDEX)      block.getIndexArray(INDEX)
 
 #define INPUT_LIST(INDEX)     reinterpret_cast<nd4j::NDArrayList<T> *>(block.getVariable(INDEX)->getNDArrayList())
 
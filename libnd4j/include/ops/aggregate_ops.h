@@ -43,6 +43,97 @@
  */
 namespace aggregateOps {
 
+#ifndef __CUDACC__
+    /**
+     * Scratch memory for SkipGram/CBOW aggregates on CPU.
+     * Batched execution keeps one instance per thread, so buffers are grown once and reused for every aggregate in batch.
+     */
+    template<typename T>
+    class Word2VecScratch {
+    private:
+        std::vector<T> _neu1;
+        std::vector<T> _neu1e;
+        std::vector<int> _targets;
+
+        static T* zeroed(std::vector<T> &buffer, int length) {
+            if (static_cast<int>(buffer.size()) < length)
+                buffer.resize(length);
+
+            std::memset(buffer.data(), 0, sizeof(T) * length);
+            return buffer.data();
+        }
+
+    public:
+        T* neu1(int length) {
+            return zeroed(_neu1, length);
+        }
+
+        T* neu1e(int length) {
+            return zeroed(_neu1e, length);
+        }
+
+        int* targets(int length) {
+            if (static_cast<int>(_targets.size()) < length)
+                _targets.resize(length);
+
+            return _targets.data();
+        }
+    };
+
+    /**
+     * Draws negative samples for one aggregate upfront, so the training loop itself only does dot/sigmoid/axpy.
+     * First target is always positive one. Returns number of targets written, samples equal to ngStarter are dropped
+     */
+    template<typename T>
+    inline static int drawNegatives(int *targets, int ngStarter, int ngRounds, unsigned long long &next_random, T *negTable, int negTableLength, int vocabSize) {
+        int cnt = 0;
+        targets[cnt++] = ngStarter;
+        for (int r = 0; r < ngRounds; r++) {
+            next_random = next_random * (unsigned long long) 25214903917 + 11;
+            int target = negTable[(next_random >> 16) % negTableLength];
+
+            if (target <= 0 || target >= vocabSize) target = next_random % (vocabSize - 1) + 1;
+            if (target == ngStarter)
+                continue;
+
+            targets[cnt++] = target;
+        }
+
+        return cnt;
+    }
+#endif
+
+    /**
+     * Fused word2vec update: neu1e += g * syn1; syn1 += g * syn0 (unless inference) in a single pass over the row
+     */
+    template<typename T>
+    aggregate_def void w2vUpdate(T *syn0, T *syn1, T *neu1e, T g, int vectorLength, int isInference) {
+        if (!isInference) {
+#pragma omp simd
+            for (int x = 0; x < vectorLength; x++) {
+                T s1 = syn1[x];
+                neu1e[x] = g * s1 + neu1e[x];
+                syn1[x] = g * syn0[x] + s1;
+            }
+        } else {
+#pragma omp simd
+            for (int x = 0; x < vectorLength; x++) {
+                neu1e[x] = g * syn1[x] + neu1e[x];
+            }
+        }
+    }
+
+    template<typename T>
+    aggregate_def T w2vDot(T *syn0, T *syn1, int vectorLength) {
+        T dot = (T) 0.0f;
+#pragma omp simd reduction(sumT:dot)
+        for (int x = 0; x < vectorLength; x++) {
+            dot += syn0[x] * syn1[x];
+        }
+
+        return dot;
+    }
+
     template<typename T>
     class GEMM {
     public:
@@ -152,10 +243,7 @@ namespace aggregateOps {
 //            shape::printArray<T>(neu1e, vectorLength, "neu1e");
 
             // dot
-//#pragma omp simd reduction(sumT:dot)
-            for (int x = 0; x < vectorLength; x++) {
-                dot += syn0[x] * syn1[x];
-            }
+            dot = w2vDot<T>(syn0, syn1, vectorLength);
 
             // gradient
             if (dot < (T) - HS_MAX_EXP || dot >= (T) HS_MAX_EXP) {
@@ -173,19 +261,8 @@ namespace aggregateOps {
 
             //nd4j_printf("dot: [%f]; idx: [%i]; f: [%f]; g: [%f]\n", (float) dot, idx, (float) f, (float) g);
 
-            // axpy1
-#pragma omp simd
-            for (int x = 0; x < vectorLength; x++) {
-                neu1e[x] = g * syn1[x] + neu1e[x];
-            }
-
-            // axpy2
-            if (!isInference) {
-#pragma omp simd
-                for (int x = 0; x < vectorLength; x++) {
-                    syn1[x] = g * syn0[x] + syn1[x];
-                }
-            }
+            // axpy1 + axpy2
+            w2vUpdate<T>(syn0, syn1, neu1e, g, vectorLength, isInference);
         }
 
 #ifdef __CUDACC__
@@ -286,10 +363,7 @@ namespace aggregateOps {
             T alpha = realArguments[0];
 
             // dot
-//#pragma omp simd reduction(sumT:dot)
-            for (int x = 0; x < vectorLength; x++) {
-                dot += syn0[x] * syn1Neg[x];
-            }
+            dot = w2vDot<T>(syn0, syn1Neg, vectorLength);
 
             if (dot > HS_MAX_EXP)
                 g = (code - 1) * alpha;
@@ -306,19 +380,8 @@ namespace aggregateOps {
                 g = ((T) code - expTable[idx]) * alpha;
             }
 
-            // axpy1
-#pragma omp simd
-            for (int x = 0; x < vectorLength; x++) {
-                neu1e[x] = g * syn1Neg[x] + neu1e[x];
-            }
-
-            // axpy2
-            if (!isInference) {
-#pragma omp simd
-                for (int x = 0; x < vectorLength; x++) {
-                    syn1Neg[x] = g * syn0[x] + syn1Neg[x];
-                }
-            }
+            // axpy1 + axpy2
+            w2vUpdate<T>(syn0, syn1Neg, neu1e, g, vectorLength, isInference);
         }
 
 #ifdef __CUDACC__
@@ -491,7 +554,16 @@ namespace aggregateOps {
     class SkipGram {
     public:
 
+#ifndef __CUDACC__
         aggregate_def void executeAggregate(T **arguments, int numArguments, Nd4jLong **shapeArguments, int numShapeArguments, int *indexArguments, int numIndexArguments, int **intArrays, int numIntArrays, T *realArguments, int numRealArguments) {
+            Word2VecScratch<T> scratch;
+            executeAggregate(arguments, numArguments, shapeArguments, numShapeArguments, indexArguments, numIndexArguments, intArrays, numIntArrays, realArguments, numRealArguments, scratch);
+        }
+
+        /**
+         * This method does the same as above, but takes scratch buffers from caller, so nothing is allocated for each aggregate
+         */
+        aggregate_def void executeAggregate(T **arguments, int numArguments, Nd4jLong **shapeArguments, int numShapeArguments, int *indexArguments, int numIndexArguments, int **intArrays, int numIntArrays, T *realArguments, int numRealArguments, Word2VecScratch<T> &scratch) {
             int syn0Row = indexArguments[0];
             int vectorLength = indexArguments[1];
             int hsRounds = indexArguments[2];
@@ -503,8 +575,7 @@ namespace aggregateOps {
             int isInference = indexArguments[8];
 
 
-            auto neu1e = new T[vectorLength];
-            std::memset(neu1e, 0, sizeof(T) * vectorLength);
+            auto neu1e = scratch.neu1e(vectorLength);
 
             T *args[4];
             int idxArgs[4];
@@ -546,23 +617,13 @@ namespace aggregateOps {
 
 
 
-            int target = ngStarter;
             if (ngRounds > 0) {
-                for (int r = 0; r < ngRounds + 1; r++) {
-                    if (r == 0) {
-                        idxArgs[2] = 1;
-                    } else {
-                        next_random = next_random * (unsigned long long) 25214903917 + 11;
-                        target = negTable[(next_random >> 16) % negTableLength];
-
-                        if (target <= 0 || target >= vocabSize) target = next_random % (vocabSize - 1) + 1;
-                        if (target == ngStarter)
-                            continue;
-
-                        idxArgs[2] = 0;
-                    }
+                auto targets = scratch.targets(ngRounds + 1);
+                auto numTargets = drawNegatives<T>(targets, ngStarter, ngRounds, next_random, negTable, negTableLength, vocabSize);
 
-                    args[1] = syn1Neg + (target * vectorLength); // syn1Neg instead of syn1
+                for (int r = 0; r < numTargets; r++) {
+                    idxArgs[2] = r == 0 ? 1 : 0;
+                    args[1] = syn1Neg + (targets[r] * vectorLength); // syn1Neg instead of syn1
 
                     NegativeSampling<T>::executeAggregate(args, 4, nullptr, 0, idxArgs, 5, nullptr, 0, realArguments, 1);
                 }
@@ -581,10 +642,10 @@ namespace aggregateOps {
                     inferenceVector[x] += neu1e[x];
                 }
             }
-
-            delete[] neu1e;
         }
 
+#endif
+
 #ifdef __CUDACC__
         aggregate_def void executeAggregateCuda(T **arguments, int numArguments, Nd4jLong **shapeArguments, int numShapeArguments, int *indexArguments, int numIndexArguments, int **intArrays, int numIntArrays, T *realArguments, int numRealArguments) {
             __shared__ int syn0Row;
@@ -710,9 +771,20 @@ namespace aggregateOps {
     class CBOW {
     public:
 
+#ifndef __CUDACC__
         aggregate_def void executeAggregate(T **arguments, int numArguments, Nd4jLong **shapeArguments, int numShapeArguments,
                          int *indexArguments, int numIndexArguments, int **intArrays, int numIntArrays,
                          T *realArguments, int numRealArguments) {
+            Word2VecScratch<T> scratch;
+            executeAggregate(arguments, numArguments, shapeArguments, numShapeArguments, indexArguments, numIndexArguments, intArrays, numIntArrays, realArguments, numRealArguments, scratch);
+        }
+
+        /**
+         * This method does the same as above, but takes scratch buffers from caller, so nothing is allocated for each aggregate
+         */
+        aggregate_def void executeAggregate(T **arguments, int numArguments, Nd4jLong **shapeArguments, int numShapeArguments,
+                         int *indexArguments, int numIndexArguments, int **intArrays, int numIntArrays,
+                         T *realArguments, int numRealArguments, Word2VecScratch<T> &scratch) {
             int vectorLength = indexArguments[0];
             int hsRounds = indexArguments[1];
             int ngRounds = indexArguments[2];
@@ -732,10 +804,8 @@ namespace aggregateOps {
             int *codes = intArrays[2];
 
 
-            T *neu1 = new T[vectorLength];
-            T *neu1e = new T[vectorLength];
-            std::memset(neu1, 0, sizeof(T) * vectorLength);
-            std::memset(neu1e, 0, sizeof(T) * vectorLength);
+            T *neu1 = scratch.neu1(vectorLength);
+            T *neu1e = scratch.neu1e(vectorLength);
 
             T *syn0 = arguments[0];
             T *syn1 = arguments[1];
@@ -791,28 +861,19 @@ namespace aggregateOps {
                     HierarchicSoftmax<T>::executeAggregate((T **)args, 4, nullptr, 0, idxArgs, 3, nullptr, 0, realArguments, 2);
                 }
 
-            int target = ngStarter;
-            if (ngRounds > 0)
-                for (int i = 0; i < ngRounds + 1; i++) {
-                    if (i == 0) {
-                        idxArgs[2] = 1;
-                    } else {
-                        next_random = next_random * (unsigned long long) 25214903917 + 11;
-                        target = negTable[(next_random >> 16) % negTableLength];
-
-                        if (target <= 0 || target >= vocabSize) target = next_random % (vocabSize - 1) + 1;
-                        if (target == ngStarter)
-                            continue;
-
-                        idxArgs[2] = 0;
-                    }
+            if (ngRounds > 0) {
+                auto targets = scratch.targets(ngRounds + 1);
+                auto numTargets = drawNegatives<T>(targets, ngStarter, ngRounds, next_random, negTable, negTableLength, vocabSize);
 
-                    args[1] = syn1Neg + (target * vectorLength); // syn1Neg instead of syn1
+                for (int i = 0; i < numTargets; i++) {
+                    idxArgs[2] = i == 0 ? 1 : 0;
+                    args[1] = syn1Neg + (targets[i] * vectorLength); // syn1Neg instead of syn1
 
                     //printf("Negative round: target: [%i]; code: [%i]; neu1e[0]: [%f]\n", target, idxArgs[4], neu1e[0]);
 
                     NegativeSampling<T>::executeAggregate((T **)args, 4, nullptr, 0, idxArgs, 3, nullptr, 0, realArguments, 2);
                 }
+            }
 
 
             // if we don't train words - we skip start of idxSyn0
@@ -833,14 +894,11 @@ namespace aggregateOps {
                     inferenceVector[i] += neu1e[i];
                 }
             }
-
-
-
-            delete[] neu1;
-            delete[] neu1e;
         }
 
 
+#endif
+
 #ifdef __CUDACC__
         aggregate_def void executeAggregateCuda(T **arguments, int numArguments, Nd4jLong **shapeArguments, int numShapeArguments,
                          int *indexArguments, int numIndexArguments, int **intArrays, int numIntArrays,
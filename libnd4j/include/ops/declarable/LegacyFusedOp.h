@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+
+#ifndef LIBND4J_LEGACYFUSEDOP_H
+#define LIBND4J_LEGACYFUSEDOP_H
+
+#include <vector>
+#include <ops/declarable/LegacyOp.h>
+
+namespace nd4j {
+    namespace ops {
+        /**
+         * Single link of fused elementwise chain: one legacy Transform, Scalar or PairwiseTransform op
+         */
+        template <typename T>
+        struct FusedStage {
+            OpType opType;
+            int opNum;
+
+            // scalar for Scalar ops, unless it comes from operand
+            T scalar;
+
+            // index of extra input within fused op inputs, -1 if stage has no extra operand
+            int operand;
+
+            // if true - chain value is the second argument of PairwiseTransform op, i.e. z = op(operand, z)
+            bool operandFirst;
+
+            std::vector<T> extraParams;
+        };
+
+        /**
+        *   This class executes chain of legacy elementwise ops (Transform, Scalar, PairwiseTransform) as one node.
+        *   Input 0 is the input 0 of the first stage, other inputs are extra operands referenced by stages.
+        *
+        *   Arrays are processed in cache-sized blocks, and each block goes through all stages before the next one is touched,
+        *   so intermediate results never make a full trip to memory.
+        */
+        template <typename T>
+        class ND4J_EXPORT LegacyFusedOp : public LegacyOp<T> {
+        protected:
+            std::vector<FusedStage<T>> _stages;
+
+            Nd4jStatus validateAndExecute(Context<T>& block);
+        public:
+            LegacyFusedOp();
+            LegacyFusedOp(const std::vector<FusedStage<T>>& stages);
+
+            ShapeList* calculateOutputShape(ShapeList* inputShape, nd4j::graph::Context<T>& block);
+            virtual LegacyOp<T>* clone();
+
+            std::vector<FusedStage<T>>* stages();
+
+            /**
+             * This method returns true if given legacy op is strictly elementwise, so it can be a part of fused chain.
+             * Transforms with special execution (softmax, im2col etc) and random transforms are excluded.
+             */
+            static bool isFusable(OpType opType, int opNum);
+
+            template <typename N>
+            LegacyFusedOp<N>* asT() {
+                std::vector<FusedStage<N>> stages(_stages.size());
+                for (size_t e = 0; e < _stages.size(); e++) {
+                    stages[e].opType = _stages[e].opType;
+                    stages[e].opNum = _stages[e].opNum;
+                    stages[e].scalar = static_cast<N>(_stages[e].scalar);
+                    stages[e].operand = _stages[e].operand;
+                    stages[e].operandFirst = _stages[e].operandFirst;
+
+                    for (auto v: _stages[e].extraParams)
+                        stages[e].extraParams.emplace_back(static_cast<N>(v));
+                }
+
+                return new LegacyFusedOp<N>(stages);
+            }
+        };
+    }
+}
+
+
+#endif //LIBND4J_LEGACYFUSEDOP_H
@@ -64,16 +64,20 @@ CUSTOM_OP_IMPL(conv3dnew, 2, 1, false, 0, 13) {
     if (bias)
         REQUIRE_TRUE(bias->rankOf() <= 2 && oC == bias->lengthOf(), 0, "CUSTOM CONV3D OP: wrong shape of array with biases, expected rank, length: <=2, %i, but got %i, %i instead !", oC, bias->rankOf(), bias->lengthOf());
 
-    std::vector<int> permutForOutput;
-
-    if(!isNCDHW)         
-        input = input->permute({0,4,1,2,3});                                    // [bS, iD, iH, iW, iC] -> [bS, iC, iD, iH, iW]                        
-    else
-        permutForOutput    = {0,2,3,4,1};                                        // [bS, oC, oD, oH, oW] -> [bS, oD, oH, oW, oC]
-    
     if(isSameMode)                       // SAME
         ConvolutionUtils<T>::calcPadding3D(pD, pH, pW, oD, oH, oW, iD, iH, iW, kD, kH, kW, sD, sH, sW, dD, dH, dW);
 
+    // columns don't fit into memory limit, or input is channels-last: vol2col and gemm are done over tiles of output rows, without permuted copies
+    if(!isNCDHW || ConvolutionUtils<T>::isTilingRequired((Nd4jLong) bS * iC * kD * kH * kW * oD * oH * oW)) {
+        ConvolutionUtils<T>::convTiled(*input, *weights, *output, isNCDHW, kD, kH, kW, sD, sH, sW, pD, pH, pW, dD, dH, dW);
+        if(bias)
+            output->template applyBroadcast<simdOps::Add<T>>({indIOioC}, bias);
+        return Status::OK();
+    }
+
+    // only NCDHW gets here
+    std::vector<int> permutForOutput = {0,2,3,4,1};                             // [bS, oC, oD, oH, oW] -> [bS, oD, oH, oW, oC]
+
     NDArray<T> columns(input->ordering(), {bS, iC, kD, kH, kW, oD, oH, oW}, block.getWorkspace());            
     ConvolutionUtils<T>::vol2col(*input, columns, sD, sH, sW, pD, pH, pW, dD, dH, dW);                 // [bS, iC, iD, iH, iW] is convoluted to [bS, iC, kD, kH, kW, oD, oH, oW]        
     // [bS, iC, kD, kH, kW, oD, oH, oW] x [kD, kH, kW, iC, oC] = [bS, oD, oH, oW, oC]
@@ -81,9 +85,6 @@ CUSTOM_OP_IMPL(conv3dnew, 2, 1, false, 0, 13) {
 
     if(bias)
         output->template applyBroadcast<simdOps::Add<T>>({indIOioC}, bias);
-
-    if(!isNCDHW)
-        delete input;                
     
     return Status::OK();
 }
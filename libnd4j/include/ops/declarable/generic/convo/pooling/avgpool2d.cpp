@@ -59,11 +59,6 @@ CUSTOM_OP_IMPL(avgpool2d, 1, 1, false, 0, 10) {
     const int iH = static_cast<int>(isNCHW ? input->sizeAt(2) : input->sizeAt(1));
     const int iW = static_cast<int>(isNCHW ? input->sizeAt(3) : input->sizeAt(2));
 
-    if (!isNCHW) {
-        input  = input->permute({0, 3, 1, 2});                // [bS, iH, iW, iC] -> [bS, iC, iH, iW]
-        output = output->permute({0, 3, 1, 2});               // [bS, oH, oW, iC] -> [bS, iC, oH, oW]
-    }
-
     ConvolutionUtils<T>::calcOutSizePool2D(oH, oW, kH, kW, sH, sW, pH, pW, dH, dW, iH, iW, isSameMode);
 
     if (isSameMode)
@@ -71,12 +66,10 @@ CUSTOM_OP_IMPL(avgpool2d, 1, 1, false, 0, 10) {
             
     // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; 8 - poolingMode; 9 - divisor;    
     T extraParams[] = {static_cast<T>(kH), static_cast<T>(kW), static_cast<T>(sH), static_cast<T>(sW), static_cast<T>(pH), static_cast<T>(pW), static_cast<T>(dH), static_cast<T>(dW), static_cast<T>(1.f), static_cast<T>(extraParam0)};
-    ConvolutionUtils<T>::pooling2d(*input, *output, extraParams);
-
-    if (!isNCHW) {
-        delete input;
-        delete output;
-    }
+    if (isNCHW)
+        ConvolutionUtils<T>::pooling2d(*input, *output, extraParams);
+    else
+        ConvolutionUtils<T>::pooling2dNHWC(*input, *output, extraParams);
 
     return Status::OK();
 }
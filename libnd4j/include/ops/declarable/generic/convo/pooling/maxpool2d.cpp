@@ -61,11 +61,6 @@ CUSTOM_OP_IMPL(maxpool2d, 1, 1, false, 0, 9) {
     const int iH = isNCHW ? input->sizeAt(2) : input->sizeAt(1);
     const int iW = isNCHW ? input->sizeAt(3) : input->sizeAt(2);
 
-    if (!isNCHW) {
-        input  = input->permute({0, 3, 1, 2});                // [bS, iH, iW, iC] -> [bS, iC, iH, iW]
-        output = output->permute({0, 3, 1, 2});               // [bS, oH, oW, iC] -> [bS, iC, oH, oW]
-    }            
-
     ConvolutionUtils<T>::calcOutSizePool2D(oH, oW, kH, kW, sH, sW, pH, pW, dH, dW, iH, iW, isSameMode);
 
     if (isSameMode)
@@ -74,12 +69,10 @@ CUSTOM_OP_IMPL(maxpool2d, 1, 1, false, 0, 9) {
     // 0,1 - kernel Height/Width; 2,3 - stride Height/Width; 4,5 - pad Height/Width; 6,7 - dilation Height/Width; poolingMode; 9 - divisor;            
     T extraParams[] = {(T)kH, (T)kW, (T)sH, (T)sW, (T)pH, (T)pW, (T)dH, (T)dW, 0.f, 1.f};    
 
-    ConvolutionUtils<T>::pooling2d(*input, *output, extraParams);
-            
-    if (!isNCHW) {
-        delete input;
-        delete output;
-    }
+    if (isNCHW)
+        ConvolutionUtils<T>::pooling2d(*input, *output, extraParams);
+    else
+        ConvolutionUtils<T>::pooling2dNHWC(*input, *output, extraParams);
 
     return Status::OK();
 }
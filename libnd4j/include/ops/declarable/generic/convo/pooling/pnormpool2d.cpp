@@ -54,13 +54,8 @@ namespace nd4j {
 
             int isNCHW  = block.getIArguments()->size() > 10 ? !INT_ARG(10) : 1;       // 1-NHWC, 0-NCHW    
 
-            if (!isNCHW) {
-                input  = input->permute({0, 3, 1, 2});                  // [bS, iH, iW, iC] -> [bS, iC, iH, iW]
-                output = output->permute({0, 3, 1, 2});                 // [bS, oH, oW, iC] -> [bS, iC, oH, oW]
-            }
-
-            const auto inY = static_cast<int>(input->sizeAt(2));
-            const auto inX = static_cast<int>(input->sizeAt(3));
+            const auto inY = static_cast<int>(isNCHW ? input->sizeAt(2) : input->sizeAt(1));
+            const auto inX = static_cast<int>(isNCHW ? input->sizeAt(3) : input->sizeAt(2));
 
             ConvolutionUtils<T>::calcOutSizePool2D(oY, oX, kY, kX, sY, sX, pY, pX, dY, dX, inY, inX, isSameMode);
 
@@ -80,12 +75,10 @@ namespace nd4j {
                     static_cast<T>(2.f),
                     static_cast<T>(extraParam0)};
 
-            ConvolutionUtils<T>::pooling2d(*input, *output, argT.data());
-
-            if (!isNCHW) {
-                delete input;
-                delete output;
-            }
+            if (isNCHW)
+                ConvolutionUtils<T>::pooling2d(*input, *output, argT.data());
+            else
+                ConvolutionUtils<T>::pooling2dNHWC(*input, *output, argT.data());
 
             return Status::OK();
         }
@@ -23,6 +23,7 @@
 #include <pointercast.h>
 #include <op_boilerplate.h>
 #include <NDArray.h>
+#include <array/IndexArray.h>
 #include <numeric>
 
 
@@ -112,7 +113,7 @@ class ScatterHelper {
 
 ////////////////////////////////////////////////////////////////////////
         template <typename OpClass>
-        static FORCEINLINE void scatter(const NDArray<T>& indices, const NDArray<T>& updates, NDArray<T>& output) {
+        static FORCEINLINE void scatter(const IndexArray& indices, const NDArray<T>& updates, NDArray<T>& output) {
 
             const int outRank = output.rankOf();
             const int indRank = indices.rankOf();
@@ -153,7 +154,7 @@ class ScatterHelper {
 
 ////////////////////////////////////////////////////////////////////////
 template <typename OpClass>
-static FORCEINLINE void scatterND(const NDArray<T>& indices, const NDArray<T>& updates, NDArray<T>& output) {   
+static FORCEINLINE void scatterND(const IndexArray& indices, const NDArray<T>& updates, NDArray<T>& output) {   
 
     const Nd4jLong indLen = indices.lengthOf();
     const int outRank = output.rankOf();
@@ -173,7 +174,6 @@ static FORCEINLINE void scatterND(const NDArray<T>& indices, const NDArray<T>& u
     } 
     else {
 
-        std::vector<int> dimsToExcludeInd = ShapeUtils<T>::evalDimsToExclude(indRank, {indRank-1});
         std::vector<int> dimsToExcludeUpd(indRank - 1);
         std::iota(dimsToExcludeUpd.begin(), dimsToExcludeUpd.end(), 0);
         std::vector<Nd4jLong> idxRangeOut(2*outRank, 0);
@@ -182,10 +182,8 @@ static FORCEINLINE void scatterND(const NDArray<T>& indices, const NDArray<T>& u
 #pragma omp parallel for schedule(guided) firstprivate(idxRangeOut)
         for(Nd4jLong i = 0; i < indLen/indLastDim; ++i) {
             
-            NDArray<T> indSubArr = indices(i, dimsToExcludeInd);
-
             for(Nd4jLong j = 0; j < indLastDim; ++j) {
-                idxRangeOut[2*j] = indSubArr(j);
+                idxRangeOut[2*j] = indices(i * indLastDim + j);
                 idxRangeOut[2*j + 1] = idxRangeOut[2*j] + 1;
             }
 
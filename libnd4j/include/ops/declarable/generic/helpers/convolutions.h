@@ -77,6 +77,25 @@ namespace nd4j {
             static void getSizesAndIndexesConv3d(const bool isNCDHW, const NDArray<T>& input, const NDArray<T>& output, int& bS, int& iC, int& iD, int& iH, int& iW, int& oC, int& oD, int& oH, int& oW, int& indIOioC, int& indIOioD, int& indWiC, int& indWoC, int& indWkD);
 
             static void conv2d(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* output, const std::vector<int>& intArgs);
+
+            // im2col + gemm convolution over tiles of output rows, so that column buffer never exceeds Environment::convolutionMemoryLimit()
+            // input/output are [bS, iC, (iD), iH, iW] or [bS, (iD), iH, iW, iC], weights [(kD), kH, kW, iC, oC]; for 2d case kD = sD = dD = 1, pD = 0
+            static void convTiled(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const bool isNC, const int kD, const int kH, const int kW, const int sD, const int sH, const int sW, const int pD, const int pH, const int pW, const int dD, const int dH, const int dW);
+
+            // returns true if column buffer of given length doesn't fit into convolution memory limit
+            static bool isTilingRequired(const Nd4jLong columnsLength);
+
+            // returns true if conv2d is 1x1 convolution over contiguous input and output, so it maps to gemm over existing buffers
+            static bool isPointwiseApplicable(const NDArray<T>& input, const NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW);
+
+            // 1x1 convolution as gemm over input buffer, weights [1, 1, iC, oC], no bias
+            static void pointwiseConv2d(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const bool isNCHW);
+
+            // returns true if conv2d with given params goes through winograd F(4x4, 3x3)
+            static bool isWinogradApplicable(const int kH, const int kW, const int sH, const int sW, const int dH, const int dW, const int iC, const int oC, const int oH, const int oW);
+
+            // winograd F(4x4, 3x3) convolution for 3x3 kernel with unit strides and dilations, weights [3, 3, iC, oC], no bias
+            static void winogradConv2d(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const bool isNCHW, const int pH, const int pW);
 #ifdef HAVE_MKLDNN
             static void mkldnn_conv2d(MKLDNNStream<T> &stream, const std::vector<NDArray<T>*>& inArrs, NDArray<T>* output, const std::vector<int>& intArgs);
 #endif
@@ -84,6 +103,12 @@ namespace nd4j {
 
             static void depthwiseConv2d(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* output, const std::vector<int>& intArgs);
 
+            // direct depthwise convolution without column buffer: input [bS, iC, iH, iW], weights [kH, kW, iC, mC], output [bS, iC*mC, oH, oW], no bias
+            static void depthwiseConv2dNCHW(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW);
+
+            // direct depthwise convolution without column buffer: input [bS, iH, iW, iC], weights [kH, kW, iC, mC], output [bS, oH, oW, iC*mC], no bias
+            static void depthwiseConv2dNHWC(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW);
+
             static void depthwiseConv2dBP(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArray<T>*>& outArrs, const std::vector<int>& intArgs);
 
             static void sconv2d(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* output, const std::vector<int>& intArgs);
@@ -106,6 +131,9 @@ namespace nd4j {
 
             static void pooling2d(NDArray<T>& input, NDArray<T>& output, const T* extraParams);
 
+            // channels-last pooling2d: input [bS, iH, iW, iC], output [bS, oH, oW, iC], same extraParams as pooling2d
+            static void pooling2dNHWC(NDArray<T>& input, NDArray<T>& output, const T* extraParams);
+
             static void pooling2dBP(NDArray<T>& input, NDArray<T>& gradO, NDArray<T>& gradI, const T* extraParams);
 
             static void pooling3dBP(NDArray<T>& input, NDArray<T>& gradO, NDArray<T>& gradI, const T* extraParams);
@@ -21,6 +21,13 @@
 
 #include <ops/declarable/generic/helpers/convolutions.h>
 #include <MmulHelper.h>
+#include <Environment.h>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 
 namespace nd4j {
 namespace ops  {
@@ -810,15 +817,34 @@ void ConvolutionUtils<T>::conv2d(const std::vector<NDArray<T>*>& inArrs, NDArray
     
     std::vector<int> weightsAxesForDot = {indWiC, indWkH, indWkH+1};                                                        // iC, kH, kW
     
-    std::vector<int> permutForOutput;
-    if(!isNCHW)
-        input = input->permute({0, 3, 1, 2});                                       // [bS, iH, iW, iC] -> [bS, iC, iH, iW] if NHWC
-    else
-        permutForOutput = {0, indOoH, indOoH+1, indIOioC};                          // [bS, oC, oH, oW] -> [bS, oH, oW, oC]
-     
     if(isSameMode)                       // SAME        
         ConvolutionUtils<T>::calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
+    if(isPointwiseApplicable(*input, *output, kH, kW, sH, sW, pH, pW)) {
+        ConvolutionUtils<T>::pointwiseConv2d(*input, *weights, *output, isNCHW);
+        if(bias)
+            output->template applyBroadcast<simdOps::Add<T>>({indIOioC}, bias);
+        return;
+    }
+
+    if(isWinogradApplicable(kH, kW, sH, sW, dH, dW, iC, oC, oH, oW)) {
+        ConvolutionUtils<T>::winogradConv2d(*input, *weights, *output, isNCHW, pH, pW);
+        if(bias)
+            output->template applyBroadcast<simdOps::Add<T>>({indIOioC}, bias);
+        return;
+    }
+
+    // channels-last im2col reads contiguous channels and gemm writes straight into NHWC output, so NHWC always goes this way
+    if(!isNCHW || isTilingRequired((Nd4jLong) bS * iC * kH * kW * oH * oW)) {
+        ConvolutionUtils<T>::convTiled(*input, *weights, *output, isNCHW, 1, kH, kW, 1, sH, sW, 0, pH, pW, 1, dH, dW);
+        if(bias)
+            output->template applyBroadcast<simdOps::Add<T>>({indIOioC}, bias);
+        return;
+    }
+
+    // only NCHW gets here
+    std::vector<int> permutForOutput = {0, indOoH, indOoH+1, indIOioC};            // [bS, oC, oH, oW] -> [bS, oH, oW, oC]
+
     NDArray<T> columns(input->ordering(), {bS, iC, kH, kW, oH, oW}, input->getWorkspace());        
 
     //----- calculation of output -----//
@@ -829,9 +855,420 @@ void ConvolutionUtils<T>::conv2d(const std::vector<NDArray<T>*>& inArrs, NDArray
     //----- add biases if required -----//
     if(bias)
         output->template applyBroadcast<simdOps::Add<T>>({indIOioC}, bias);
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool ConvolutionUtils<T>::isPointwiseApplicable(const NDArray<T>& input, const NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW) {
+
+    return kH == 1 && kW == 1 && sH == 1 && sW == 1 && pH == 0 && pW == 0 && input.ordering() == 'c' && input.ews() == 1 && output.ordering() == 'c' && output.ews() == 1;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void ConvolutionUtils<T>::pointwiseConv2d(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const bool isNCHW) {
+
+    // weights [1, 1, iC, oC] are matrix [iC, oC]
+    const Nd4jLong bS = input.sizeAt(0);
+    const Nd4jLong iC = weights.sizeAt(2);
+    const Nd4jLong oC = weights.sizeAt(3);
+    const Nd4jLong numPixels = input.lengthOf() / (bS * iC);
+
+    NDArray<T>* wCont = weights.ordering() == 'c' && weights.ews() == 1 ? &weights : weights.dup('c');
+    NDArray<T> wMatrix(wCont->getBuffer(), 'c', {iC, oC}, input.getWorkspace());
+
+    if (!isNCHW) {
+        // [bS*iH*iW, iC] x [iC, oC] = [bS*oH*oW, oC]
+        NDArray<T> x(input.getBuffer(), 'c', {bS * numPixels, iC}, input.getWorkspace());
+        NDArray<T> z(output.getBuffer(), 'c', {bS * numPixels, oC}, input.getWorkspace());
+        MmulHelper<T>::mmul(&x, &wMatrix, &z, (T) 1.f, (T) 0.f);
+    }
+    else {
+        // [oC, iC] x [iC, iH*iW] = [oC, oH*oW] for every batch entry
+        NDArray<T>* wTransposed = wMatrix.transpose();
+        NDArray<T>* wT = wTransposed->dup('c');
+        for (Nd4jLong b = 0; b < bS; b++) {
+            NDArray<T> x(input.getBuffer() + b * iC * numPixels, 'c', {iC, numPixels}, input.getWorkspace());
+            NDArray<T> z(output.getBuffer() + b * oC * numPixels, 'c', {oC, numPixels}, input.getWorkspace());
+            MmulHelper<T>::mmul(wT, &x, &z, (T) 1.f, (T) 0.f);
+        }
+        delete wTransposed;
+        delete wT;
+    }
+
+    if (wCont != &weights)
+        delete wCont;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool ConvolutionUtils<T>::isTilingRequired(const Nd4jLong columnsLength) {
+
+    return columnsLength * (Nd4jLong) sizeof(T) > Environment::getInstance()->convolutionMemoryLimit();
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void ConvolutionUtils<T>::convTiled(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const bool isNC, const int kD, const int kH, const int kW, const int sD, const int sH, const int sW, const int pD, const int pH, const int pW, const int dD, const int dH, const int dW) {
+
+    const int rank = input.rankOf();                    // 4 for conv2d, 5 for conv3d
+    const int is3d = rank == 5 ? 1 : 0;
+    const int indC = isNC ? 1 : rank - 1;               // channels axis
+    const int indS = isNC ? 2 : 1;                      // first spatial axis
+
+    const int bS = input.sizeAt(0);
+    const int iC = input.sizeAt(indC);
+    const int iD = is3d ? input.sizeAt(indS) : 1;
+    const int iH = input.sizeAt(indS + is3d);
+    const int iW = input.sizeAt(indS + is3d + 1);
+    const int oC = output.sizeAt(indC);
+    const int oD = is3d ? output.sizeAt(indS) : 1;
+    const int oH = output.sizeAt(indS + is3d);
+    const int oW = output.sizeAt(indS + is3d + 1);
+
+    const Nd4jLong* xStrides = input.stridesOf();
+    const Nd4jLong* zStrides = output.stridesOf();
+    const Nd4jLong xStrB = xStrides[0], xStrC = xStrides[indC], xStrD = is3d ? xStrides[indS] : 0, xStrH = xStrides[indS + is3d], xStrW = xStrides[indS + is3d + 1];
+    const Nd4jLong zStrB = zStrides[0], zStrC = zStrides[indC], zStrD = is3d ? zStrides[indS] : 0, zStrH = zStrides[indS + is3d], zStrW = zStrides[indS + is3d + 1];
+
+    // weights [kD, kH, kW, iC, oC] in c order are matrix [K, oC], so every column row is filled in [kD, kH, kW, iC] order
+    const Nd4jLong K = (Nd4jLong) kD * kH * kW * iC;
+    NDArray<T>* wCont = weights.ordering() == 'c' && weights.ews() == 1 ? &weights : weights.dup('c');
+    NDArray<T> wMatrix(wCont->getBuffer(), 'c', {K, (Nd4jLong) oC}, input.getWorkspace());
+
+    // tile is number of output rows (oW pixels each) along flattened [bS, oD, oH], scratch holds columns and gemm result of single tile
+    const Nd4jLong numRows = (Nd4jLong) bS * oD * oH;
+    const Nd4jLong rowBytes = (Nd4jLong) oW * (K + oC) * sizeof(T);
+    const Nd4jLong tileRows = nd4j::math::nd4j_max<Nd4jLong>(1, nd4j::math::nd4j_min<Nd4jLong>(numRows, Environment::getInstance()->convolutionMemoryLimit() / rowBytes));
+
+    // contiguous channels-last output already is [bS*oD*oH*oW, oC] matrix, so tiles of gemm result go there without scatter
+    const bool directOutput = !isNC && output.ordering() == 'c' && output.ews() == 1;
+
+    NDArray<T> scratch('c', {tileRows * oW * (K + oC)}, input.getWorkspace());
+    T* cols = scratch.getBuffer();
+    T* res  = cols + tileRows * oW * K;
+    const T* x = input.getBuffer();
+    T* z = output.getBuffer();
+
+    for (Nd4jLong r0 = 0; r0 < numRows; r0 += tileRows) {
+
+        const Nd4jLong numPixels = nd4j::math::nd4j_min<Nd4jLong>(tileRows, numRows - r0) * oW;
+
+#pragma omp parallel for schedule(guided)
+        for (Nd4jLong p = 0; p < numPixels; p++) {
+            const Nd4jLong row = r0 + p / oW;
+            const int ow = p % oW;
+            const int oh = row % oH;
+            const int od = (row / oH) % oD;
+            const Nd4jLong b = row / ((Nd4jLong) oH * oD);
+
+            T* col = cols + p * K;
+            for (int kd = 0; kd < kD; kd++) {
+                const int id = od * sD - pD + kd * dD;
+                for (int kh = 0; kh < kH; kh++) {
+                    const int ih = oh * sH - pH + kh * dH;
+                    for (int kw = 0; kw < kW; kw++, col += iC) {
+                        const int iw = ow * sW - pW + kw * dW;
+
+                        if (id < 0 || id >= iD || ih < 0 || ih >= iH || iw < 0 || iw >= iW) {
+                            for (int c = 0; c < iC; c++)
+                                col[c] = (T) 0.f;
+                            continue;
+                        }
+
+                        const T* xp = x + b * xStrB + id * xStrD + ih * xStrH + iw * xStrW;
+                        for (int c = 0; c < iC; c++)
+                            col[c] = xp[c * xStrC];
+                    }
+                }
+            }
+        }
+
+        NDArray<T> colsTile(cols, 'c', {numPixels, K}, input.getWorkspace());
+        NDArray<T> resTile(directOutput ? z + r0 * oW * oC : res, 'c', {numPixels, (Nd4jLong) oC}, input.getWorkspace());
+        MmulHelper<T>::mmul(&colsTile, &wMatrix, &resTile, (T) 1.f, (T) 0.f);          // [pixels, K] x [K, oC] = [pixels, oC]
+
+        if (directOutput)
+            continue;
+
+#pragma omp parallel for schedule(guided)
+        for (Nd4jLong p = 0; p < numPixels; p++) {
+            const Nd4jLong row = r0 + p / oW;
+            const int ow = p % oW;
+            const int oh = row % oH;
+            const int od = (row / oH) % oD;
+            const Nd4jLong b = row / ((Nd4jLong) oH * oD);
+
+            T* zp = z + b * zStrB + od * zStrD + oh * zStrH + ow * zStrW;
+            const T* rp = res + p * oC;
+            for (int c = 0; c < oC; c++)
+                zp[c * zStrC] = rp[c];
+        }
+    }
+
+    if (wCont != &weights)
+        delete wCont;
+}
 
-    if(!isNCHW)
-        delete input;                
+//////////////////////////////////////////////////////////////////////////
+// winograd F(4x4, 3x3) transforms along single dimension: B^T d for input, G g for filter, A^T m for output
+template <typename T>
+static FORCEINLINE void winogradInputTransform(const T* d, const Nd4jLong dStride, T* r, const Nd4jLong rStride) {
+
+    const T d0 = d[0], d1 = d[dStride], d2 = d[2*dStride], d3 = d[3*dStride], d4 = d[4*dStride], d5 = d[5*dStride];
+
+    r[0]         = (T) 4.f * d0 - (T) 5.f * d2 + d4;
+    r[rStride]   = d3 + d4 - (T) 4.f * (d1 + d2);
+    r[2*rStride] = d4 - d3 + (T) 4.f * (d1 - d2);
+    r[3*rStride] = d4 - d2 + (T) 2.f * (d3 - d1);
+    r[4*rStride] = d4 - d2 + (T) 2.f * (d1 - d3);
+    r[5*rStride] = (T) 4.f * d1 - (T) 5.f * d3 + d5;
+}
+
+template <typename T>
+static FORCEINLINE void winogradFilterTransform(const T* g, const Nd4jLong gStride, T* r, const Nd4jLong rStride) {
+
+    const T g0 = g[0], g1 = g[gStride], g2 = g[2*gStride];
+
+    r[0]         = g0 / (T) 4.f;
+    r[rStride]   = -(g0 + g1 + g2) / (T) 6.f;
+    r[2*rStride] = -(g0 - g1 + g2) / (T) 6.f;
+    r[3*rStride] = g0 / (T) 24.f + g1 / (T) 12.f + g2 / (T) 6.f;
+    r[4*rStride] = g0 / (T) 24.f - g1 / (T) 12.f + g2 / (T) 6.f;
+    r[5*rStride] = g2;
+}
+
+template <typename T>
+static FORCEINLINE void winogradOutputTransform(const T* m, const Nd4jLong mStride, T* r, const Nd4jLong rStride) {
+
+    const T m0 = m[0], m1 = m[mStride], m2 = m[2*mStride], m3 = m[3*mStride], m4 = m[4*mStride], m5 = m[5*mStride];
+    const T sum12 = m1 + m2, dif12 = m1 - m2, sum34 = m3 + m4, dif34 = m3 - m4;
+
+    r[0]         = m0 + sum12 + sum34;
+    r[rStride]   = dif12 + (T) 2.f * dif34;
+    r[2*rStride] = sum12 + (T) 4.f * sum34;
+    r[3*rStride] = dif12 + (T) 8.f * dif34 + m5;
+}
+
+//////////////////////////////////////////////////////////////////////////
+// pre-transformed winograd filters, keyed by weights buffer; entry is reused while hash of that buffer stays the same.
+// total size of transformed filters is bounded by Environment::winogradCacheLimit(), least recently used entries are evicted first
+template <typename T>
+class WinogradFilterCache {
+public:
+    struct Entry {
+        uint64_t hash;                  // hash of [3, 3, iC, oC] weights this entry was built from
+        int iC;
+        int oC;
+        std::vector<T> transformed;     // [36, iC, oC]
+    };
+
+private:
+    typedef std::pair<const T*, std::shared_ptr<Entry>> Item;
+
+    std::mutex _mutex;
+    std::list<Item> _lru;                                           // most recently used first
+    std::map<const T*, typename std::list<Item>::iterator> _entries;
+    Nd4jLong _bytes = 0;
+
+    static uint64_t hashOf(const T* weights, const Nd4jLong length) {
+        const Nd4jLong bytes = length * sizeof(T);
+        const Nd4jLong words = bytes / sizeof(uint64_t);
+        auto ptr = reinterpret_cast<const uint8_t*>(weights);
+
+        uint64_t hash = 14695981039346656037ULL;
+        for (Nd4jLong e = 0; e < words; e++) {
+            uint64_t word;
+            std::memcpy(&word, ptr + e * sizeof(uint64_t), sizeof(uint64_t));
+            hash = (hash ^ word) * 1099511628211ULL;
+            hash ^= hash >> 29;
+        }
+
+        for (Nd4jLong e = words * sizeof(uint64_t); e < bytes; e++)
+            hash = (hash ^ ptr[e]) * 1099511628211ULL;
+
+        return hash;
+    }
+
+    // caller holds _mutex
+    void erase(typename std::map<const T*, typename std::list<Item>::iterator>::iterator it) {
+        _bytes -= it->second->second->transformed.size() * sizeof(T);
+        _lru.erase(it->second);
+        _entries.erase(it);
+    }
+
+public:
+    static WinogradFilterCache<T>* getInstance() {
+        static WinogradFilterCache<T> instance;
+        return &instance;
+    }
+
+    // weights must be contiguous [3, 3, iC, oC] in c order, key is buffer of original (possibly strided) weights array
+    std::shared_ptr<Entry> get(const T* key, const T* weights, const int iC, const int oC) {
+
+        const Nd4jLong plane = (Nd4jLong) iC * oC;
+        const uint64_t hash = hashOf(weights, 9 * plane);
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _entries.find(key);
+            if (it != _entries.end()) {
+                auto entry = it->second->second;
+                if (entry->hash == hash && entry->iC == iC && entry->oC == oC) {
+                    _lru.splice(_lru.begin(), _lru, it->second);
+                    return entry;
+                }
+            }
+        }
+
+        auto entry = std::make_shared<Entry>();
+        entry->hash = hash;
+        entry->iC = iC;
+        entry->oC = oC;
+        entry->transformed.resize(36 * plane);
+        T* u = entry->transformed.data();
+
+#pragma omp parallel for schedule(guided)
+        for (Nd4jLong e = 0; e < plane; e++) {
+            T gg[18];                                       // G g, [6, 3]
+            for (int kw = 0; kw < 3; kw++)
+                winogradFilterTransform<T>(weights + kw * plane + e, 3 * plane, gg + kw, 3);
+            for (int i = 0; i < 6; i++)                     // (G g) G^T, [6, 6]
+                winogradFilterTransform<T>(gg + i * 3, 1, u + i * 6 * plane + e, plane);
+        }
+
+        const Nd4jLong limit = Environment::getInstance()->winogradCacheLimit();
+        const Nd4jLong entryBytes = 36 * plane * sizeof(T);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _entries.find(key);
+        if (it != _entries.end())
+            erase(it);
+
+        // filter that doesn't fit into the limit alone is used once and dropped
+        if (entryBytes > limit)
+            return entry;
+
+        while (_bytes + entryBytes > limit)
+            erase(_entries.find(_lru.back().first));
+
+        _lru.emplace_front(key, entry);
+        _entries[key] = _lru.begin();
+        _bytes += entryBytes;
+
+        return entry;
+    }
+};
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+bool ConvolutionUtils<T>::isWinogradApplicable(const int kH, const int kW, const int sH, const int sW, const int dH, const int dW, const int iC, const int oC, const int oH, const int oW) {
+
+    // transforms overhead doesn't pay off for few channels, and half precision loses too much accuracy in transforms
+    return kH == 3 && kW == 3 && sH == 1 && sW == 1 && dH == 1 && dW == 1 && iC >= 8 && oC >= 8 && oH >= 4 && oW >= 4 && !std::is_same<T, float16>::value;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void ConvolutionUtils<T>::winogradConv2d(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const bool isNCHW, const int pH, const int pW) {
+
+    // input [bS, iC, iH, iW] (NCHW) or [bS, iH, iW, iC] (NHWC), output [bS, oC, oH, oW] (NCHW) or [bS, oH, oW, oC] (NHWC)
+    const int indC = isNCHW ? 1 : 3;
+    const int indH = isNCHW ? 2 : 1;
+
+    const int bS = input.sizeAt(0);
+    const int iC = input.sizeAt(indC);
+    const int iH = input.sizeAt(indH);
+    const int iW = input.sizeAt(indH + 1);
+    const int oC = output.sizeAt(indC);
+    const int oH = output.sizeAt(indH);
+    const int oW = output.sizeAt(indH + 1);
+
+    const Nd4jLong xStrB = input.stridesOf()[0],  xStrC = input.stridesOf()[indC],  xStrH = input.stridesOf()[indH],  xStrW = input.stridesOf()[indH + 1];
+    const Nd4jLong zStrB = output.stridesOf()[0], zStrC = output.stridesOf()[indC], zStrH = output.stridesOf()[indH], zStrW = output.stridesOf()[indH + 1];
+
+    NDArray<T>* wCont = weights.ordering() == 'c' && weights.ews() == 1 ? &weights : weights.dup('c');
+    auto filter = WinogradFilterCache<T>::getInstance()->get(weights.getBuffer(), wCont->getBuffer(), iC, oC);
+    if (wCont != &weights)
+        delete wCont;
+    T* U = filter->transformed.data();                                  // [36, iC, oC]
+
+    // every 4x4 output tile needs 6x6 input patch; tiles are processed in blocks that fit into convolution memory limit
+    const int tH = (oH + 3) / 4;
+    const int tW = (oW + 3) / 4;
+    const Nd4jLong numTiles = (Nd4jLong) bS * tH * tW;
+    const Nd4jLong tileBytes = 36L * (iC + oC) * sizeof(T);
+    const Nd4jLong blockTiles = nd4j::math::nd4j_max<Nd4jLong>(1, nd4j::math::nd4j_min<Nd4jLong>(numTiles, Environment::getInstance()->convolutionMemoryLimit() / tileBytes));
+
+    NDArray<T> scratch('c', {36 * blockTiles * (iC + oC)}, input.getWorkspace());
+    T* V = scratch.getBuffer();                                         // [36, tiles, iC]
+    T* M = V + 36 * blockTiles * iC;                                    // [36, tiles, oC]
+    const T* x = input.getBuffer();
+    T* z = output.getBuffer();
+
+    for (Nd4jLong t0 = 0; t0 < numTiles; t0 += blockTiles) {
+
+        const Nd4jLong nT = nd4j::math::nd4j_min<Nd4jLong>(blockTiles, numTiles - t0);
+
+        // input transform, B^T d B
+#pragma omp parallel for schedule(guided)
+        for (Nd4jLong t = 0; t < nT; t++) {
+            const Nd4jLong tile = t0 + t;
+            const int tw = tile % tW;
+            const int th = (tile / tW) % tH;
+            const Nd4jLong b = tile / ((Nd4jLong) tH * tW);
+            const int h0 = th * 4 - pH;
+            const int w0 = tw * 4 - pW;
+
+            T d[36], bd[36];
+            for (int c = 0; c < iC; c++) {
+                const T* xc = x + b * xStrB + c * xStrC;
+                for (int i = 0; i < 6; i++) {
+                    const int ih = h0 + i;
+                    for (int j = 0; j < 6; j++) {
+                        const int iw = w0 + j;
+                        d[i * 6 + j] = ih >= 0 && ih < iH && iw >= 0 && iw < iW ? xc[ih * xStrH + iw * xStrW] : (T) 0.f;
+                    }
+                }
+
+                for (int j = 0; j < 6; j++)
+                    winogradInputTransform<T>(d + j, 6, bd + j, 6);
+                for (int i = 0; i < 6; i++)
+                    winogradInputTransform<T>(bd + i * 6, 1, V + (i * 6 * nT + t) * iC + c, nT * iC);
+            }
+        }
+
+        // 36 independent gemms: [tiles, iC] x [iC, oC] = [tiles, oC]
+        for (int e = 0; e < 36; e++) {
+            NDArray<T> vTile(V + e * nT * iC, 'c', {nT, (Nd4jLong) iC}, input.getWorkspace());
+            NDArray<T> uTile(U + (Nd4jLong) e * iC * oC, 'c', {(Nd4jLong) iC, (Nd4jLong) oC}, input.getWorkspace());
+            NDArray<T> mTile(M + e * nT * oC, 'c', {nT, (Nd4jLong) oC}, input.getWorkspace());
+            MmulHelper<T>::mmul(&vTile, &uTile, &mTile, (T) 1.f, (T) 0.f);
+        }
+
+        // output transform, A^T m A, only part of tile within output bounds is stored
+#pragma omp parallel for schedule(guided)
+        for (Nd4jLong t = 0; t < nT; t++) {
+            const Nd4jLong tile = t0 + t;
+            const int tw = tile % tW;
+            const int th = (tile / tW) % tH;
+            const Nd4jLong b = tile / ((Nd4jLong) tH * tW);
+            const int hEnd = nd4j::math::nd4j_min<int>(4, oH - th * 4);
+            const int wEnd = nd4j::math::nd4j_min<int>(4, oW - tw * 4);
+
+            T am[24], y[16];
+            for (int c = 0; c < oC; c++) {
+                for (int j = 0; j < 6; j++)
+                    winogradOutputTransform<T>(M + (j * nT + t) * oC + c, 6 * nT * oC, am + j, 6);
+                for (int i = 0; i < 4; i++)
+                    winogradOutputTransform<T>(am + i * 6, 1, y + i * 4, 1);
+
+                T* zc = z + b * zStrB + c * zStrC + (th * 4) * zStrH + (tw * 4) * zStrW;
+                for (int i = 0; i < hEnd; i++)
+                    for (int j = 0; j < wEnd; j++)
+                        zc[i * zStrH + j * zStrW] = y[i * 4 + j];
+            }
+        }
+    }
 }
 
 #ifdef HAVE_MKLDNN
@@ -1022,38 +1459,178 @@ void ConvolutionUtils<T>::depthwiseConv2d(const std::vector<NDArray<T>*>& inArrs
     int indIOioC, indIiH, indWmC, indWiC, indWkH, indOoH;   // corresponding indexes
     getSizesAndIndexesConv2d(isNCHW, *input, *output, bS, iC, iH, iW, oC, oH, oW, indIOioC, indIiH, indWiC, indWmC, indWkH, indOoH);    
     mC = weights->sizeAt(indWmC);                           // channels multiplier
-    
-    std::vector<std::vector<Nd4jLong>> modifColumns = {{1,0,4,5,2,3}, {iC,bS*oH*oW,kH*kW}};  // [bS,iC,kH,kW,oH,oW] -> [iC,bS,oH,oW,kH,kW] -> [iC,bS*oH*oW,kH*kW]
-    std::vector<std::vector<Nd4jLong>> modifOutput;
-    std::vector<Nd4jLong> outReShape;
 
-    if(!isNCHW) {        
-        input = input->permute({0, 3, 1, 2});                                           // [bS,iH,iW,iC]    -> [bS,iC,iH,iW] 
-        outReShape = {bS, oH, oW, iC, mC};                                              // [bS,oH,oW,iC*mC] -> [bS,oH,oW,iC,mC]
-        modifOutput = {{3,0,1,2,4},{iC, bS*oH*oW, mC}};                                 // [bS,oH,oW,iC,mC] -> [iC,bS,oH,oW,mC] -> [iC,bS*oH*oW,mC]
-    }
-    else {
-        outReShape = {bS, iC, mC, oH, oW};                                              // [bS,iC*mC,oH,oW] -> [bS,iC,mC,oH,oW]
-        modifOutput = {{1,0,3,4,2},{iC, bS*oH*oW, mC}};                                 // [bS,iC,mC,oH,oW] -> [iC,bS,oH,oW,mC] -> [iC,bS*oH*oW,mC]
-    }
-
-    if(isSameMode)                       // SAME        
+    if(isSameMode)                       // SAME
         ConvolutionUtils<T>::calcPadding2D(pH, pW, oH, oW, iH, iW, kH, kW, sH, sW, dH, dW);
 
-    NDArray<T> columns(input->ordering(), {bS, iC, kH, kW, oH, oW}, input->getWorkspace());                
-    NDArray<T>* outputReshaped = output->reshape(output->ordering(), outReShape);
-    std::vector<T> extrasIm2Col({(T) kH, (T) kW, (T) sH, (T) sW, (T) pH, (T) pW, (T) dH, (T) dW, (T)0.f, (T)0.f});
+    // both kernels are direct, no column buffer is built
+    if(isNCHW)
+        ConvolutionUtils<T>::depthwiseConv2dNCHW(*input, *weights, *output, kH, kW, sH, sW, pH, pW, dH, dW);
+    else
+        ConvolutionUtils<T>::depthwiseConv2dNHWC(*input, *weights, *output, kH, kW, sH, sW, pH, pW, dH, dW);
 
-    input->template applyTransform<simdOps::Im2col<T>>(&columns, extrasIm2Col.data());                                 // [bS, iC, iH, iW] is convoluted to [bS, iC, kH, kW, oH, oW]
-    nd4j::MmulHelper<T>::tensorDot(&columns, weights, outputReshaped, modifColumns, {{2,0,1,3},{iC,kH*kW,mC}}, modifOutput);    // [iC, bS*oH*oW, kW*kH] x [iC, kH*kW, mC] = [iC, bS*oH*oW, mC]
-    
     if(bias)
         output->template applyBroadcast<simdOps::Add<T>>({indIOioC}, bias);
+}
 
-    if(!isNCHW)
-        delete input;                  
-    
-    delete outputReshaped;
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void ConvolutionUtils<T>::depthwiseConv2dNCHW(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW) {
+
+    const int bS = input.sizeAt(0);
+    const int iC = input.sizeAt(1);
+    const int iH = input.sizeAt(2);
+    const int iW = input.sizeAt(3);
+    const int mC = weights.sizeAt(3);
+    const int oH = output.sizeAt(2);
+    const int oW = output.sizeAt(3);
+
+    // inner loops run over contiguous input rows
+    NDArray<T>* xCont = input.stridesOf()[3] == 1 ? &input : input.dup('c');
+    NDArray<T>* wCont = weights.ordering() == 'c' && weights.ews() == 1 ? &weights : weights.dup('c');
+
+    const T* x = xCont->getBuffer();
+    const T* w = wCont->getBuffer();
+    T* z = output.getBuffer();
+    const Nd4jLong xStrB = xCont->stridesOf()[0], xStrC = xCont->stridesOf()[1], xStrH = xCont->stridesOf()[2];
+    const Nd4jLong zStrB = output.stridesOf()[0], zStrC = output.stridesOf()[1], zStrH = output.stridesOf()[2], zStrW = output.stridesOf()[3];
+    const Nd4jLong numPlanes = (Nd4jLong) bS * iC;
+
+#pragma omp parallel
+    {
+        std::vector<T> rowBuffer(oW);
+        T* acc = rowBuffer.data();
+
+#pragma omp for schedule(guided)
+        for (Nd4jLong plane = 0; plane < numPlanes; plane++) {
+            const Nd4jLong b = plane / iC;
+            const int c = plane % iC;
+            const T* xp = x + b * xStrB + c * xStrC;
+
+            for (int m = 0; m < mC; m++) {
+                T* zp = z + b * zStrB + (c * mC + m) * zStrC;
+
+                for (int oh = 0; oh < oH; oh++) {
+                    for (int ow = 0; ow < oW; ow++)
+                        acc[ow] = (T) 0.f;
+
+                    for (int kh = 0; kh < kH; kh++) {
+                        const int ih = oh * sH - pH + kh * dH;
+                        if (ih < 0 || ih >= iH)
+                            continue;
+
+                        const T* xRow = xp + ih * xStrH;
+                        for (int kw = 0; kw < kW; kw++) {
+                            const T wv = w[((kh * kW + kw) * iC + c) * mC + m];
+
+                            // range of output columns whose input column lies inside of row, so inner loop has no bounds checks
+                            const int offset = kw * dW - pW;
+                            const int owStart = offset < 0 ? (-offset + sW - 1) / sW : 0;
+                            const int owEnd = iW - 1 - offset < 0 ? 0 : nd4j::math::nd4j_min<int>(oW, (iW - 1 - offset) / sW + 1);
+
+                            if (sW == 1) {
+                                const T* xk = xRow + offset;
+#pragma omp simd
+                                for (int ow = owStart; ow < owEnd; ow++)
+                                    acc[ow] += wv * xk[ow];
+                            }
+                            else {
+                                for (int ow = owStart; ow < owEnd; ow++)
+                                    acc[ow] += wv * xRow[ow * sW + offset];
+                            }
+                        }
+                    }
+
+                    T* zRow = zp + oh * zStrH;
+                    for (int ow = 0; ow < oW; ow++)
+                        zRow[ow * zStrW] = acc[ow];
+                }
+            }
+        }
+    }
+
+    if (xCont != &input)
+        delete xCont;
+    if (wCont != &weights)
+        delete wCont;
+}
+
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void ConvolutionUtils<T>::depthwiseConv2dNHWC(NDArray<T>& input, NDArray<T>& weights, NDArray<T>& output, const int kH, const int kW, const int sH, const int sW, const int pH, const int pW, const int dH, const int dW) {
+
+    const int bS = input.sizeAt(0);
+    const int iH = input.sizeAt(1);
+    const int iW = input.sizeAt(2);
+    const int iC = input.sizeAt(3);
+    const int mC = weights.sizeAt(3);
+    const int oH = output.sizeAt(1);
+    const int oW = output.sizeAt(2);
+    const int oC = iC * mC;
+
+    // inner loops run over contiguous channels
+    NDArray<T>* xCont = input.stridesOf()[3] == 1 ? &input : input.dup('c');
+    NDArray<T>* wCont = weights.ordering() == 'c' && weights.ews() == 1 ? &weights : weights.dup('c');
+
+    const T* x = xCont->getBuffer();
+    const T* w = wCont->getBuffer();
+    T* z = output.getBuffer();
+    const Nd4jLong xStrB = xCont->stridesOf()[0], xStrH = xCont->stridesOf()[1], xStrW = xCont->stridesOf()[2];
+    const Nd4jLong zStrB = output.stridesOf()[0], zStrH = output.stridesOf()[1], zStrW = output.stridesOf()[2], zStrC = output.stridesOf()[3];
+    const Nd4jLong numPixels = (Nd4jLong) bS * oH * oW;
+
+#pragma omp parallel
+    {
+        std::vector<T> accBuffer(oC);
+        T* acc = accBuffer.data();
+
+#pragma omp for schedule(guided)
+        for (Nd4jLong p = 0; p < numPixels; p++) {
+            const int ow = p % oW;
+            const int oh = (p / oW) % oH;
+            const Nd4jLong b = p / ((Nd4jLong) oH * oW);
+
+            for (int c = 0; c < oC; c++)
+                acc[c] = (T) 0.f;
+
+            for (int kh = 0; kh < kH; kh++) {
+                const int ih = oh * sH - pH + kh * dH;
+                if (ih < 0 || ih >= iH)
+                    continue;
+
+                for (int kw = 0; kw < kW; kw++) {
+                    const int iw = ow * sW - pW + kw * dW;
+                    if (iw < 0 || iw >= iW)
+                        continue;
+
+                    const T* xp = x + b * xStrB + ih * xStrH + iw * xStrW;
+                    const T* wp = w + (kh * kW + kw) * oC;
+
+                    if (mC == 1) {
+#pragma omp simd
+                        for (int c = 0; c < iC; c++)
+                            acc[c] += xp[c] * wp[c];
+                    }
+                    else {
+                        for (int c = 0; c < iC; c++) {
+                            const T xv = xp[c];
+                            for (int m = 0; m < mC; m++)
+                                acc[c * mC + m] += xv * wp[c * mC + m];
+                        }
+                    }
+                }
+            }
+
+            T* zp = z + b * zStrB + oh * zStrH + ow * zStrW;
+            for (int c = 0; c < oC; c++)
+                zp[c * zStrC] = acc[c];
+        }
+    }
+
+    if (xCont != &input)
+        delete xCont;
+    if (wCont != &weights)
+        delete wCont;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -1759,6 +2336,120 @@ void ConvolutionUtils<T>::pooling2d(NDArray<T>& input, NDArray<T>& output, const
     }
 }
 
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+void ConvolutionUtils<T>::pooling2dNHWC(NDArray<T>& input, NDArray<T>& output, const T* extraParams) {
+    // input is  [bS, iH, iW, iC]
+    // output is [bS, oH, oW, iC]
+    const Nd4jLong kH = (int)extraParams[0];
+    const Nd4jLong kW = (int)extraParams[1];
+    const Nd4jLong sH = (int)extraParams[2];
+    const Nd4jLong sW = (int)extraParams[3];
+    const Nd4jLong pH = (int)extraParams[4];
+    const Nd4jLong pW = (int)extraParams[5];
+    const Nd4jLong dH = (int)extraParams[6];
+    const Nd4jLong dW = (int)extraParams[7];
+    const int poolingMode = (int)extraParams[8];
+    const T extraParam0 = extraParams[9];
+
+    if(poolingMode < 0 || poolingMode > 2) {
+        nd4j_printf("ConvolutionUtils::pooling2dNHWC: pooling mode argument can take three values only: 0, 1, 2, but got %i instead !\n", poolingMode);
+        throw std::runtime_error("ConvolutionUtils::pooling2dNHWC: wrong pooling mode");
+    }
+
+    const Nd4jLong kHEff = kH + (kH-1)*(dH-1);
+    const Nd4jLong kWEff = kW + (kW-1)*(dW-1);
+
+    const Nd4jLong bS = input.sizeAt(0);
+    const Nd4jLong iH = input.sizeAt(1);
+    const Nd4jLong iW = input.sizeAt(2);
+    const int      iC = input.sizeAt(3);
+    const Nd4jLong oH = output.sizeAt(1);
+    const Nd4jLong oW = output.sizeAt(2);
+
+    // inner loops run over contiguous channels
+    NDArray<T>* xCont = input.stridesOf()[3] == 1 ? &input : input.dup('c');
+
+    const T* in = xCont->getBuffer();
+    T* out = output.getBuffer();
+    const Nd4jLong iStrB = xCont->stridesOf()[0], iStrH = xCont->stridesOf()[1], iStrW = xCont->stridesOf()[2];
+    const Nd4jLong oStrB = output.stridesOf()[0], oStrH = output.stridesOf()[1], oStrW = output.stridesOf()[2], oStrC = output.stridesOf()[3];
+
+#pragma omp parallel
+    {
+        std::vector<T> accBuffer(iC);
+        T* acc = accBuffer.data();
+
+#pragma omp for schedule(guided)
+        for (Nd4jLong p = 0; p < bS * oH * oW; p++) {
+            const Nd4jLong ow = p % oW;
+            const Nd4jLong oh = (p / oW) % oH;
+            const Nd4jLong b  = p / (oH * oW);
+
+            Nd4jLong hstart = oh * sH - pH;
+            Nd4jLong wstart = ow * sW - pW;
+            Nd4jLong hend = hstart + kHEff;
+            Nd4jLong wend = wstart + kWEff;
+
+            if(hstart < 0)
+                hstart += dH * ((-hstart + dH - 1) / dH);
+            if(wstart < 0)
+                wstart += dW * ((-wstart + dW - 1) / dW);
+            if(hend > iH)
+                hend -= dH * ((hend - iH + dH - 1) / dH);
+            if(wend > iW)
+                wend -= dW * ((wend - iW + dW - 1) / dW);
+
+            const T init = poolingMode == 0 ? (T) -MAX_FLOAT : (T) 0.f;
+            for (int c = 0; c < iC; c++)
+                acc[c] = init;
+
+            for (Nd4jLong h = hstart; h < hend; h += dH) {
+                for (Nd4jLong w = wstart; w < wend; w += dW) {
+                    const T* pIn = in + b * iStrB + h * iStrH + w * iStrW;
+
+                    if (poolingMode == 0) {
+#pragma omp simd
+                        for (int c = 0; c < iC; c++)
+                            acc[c] = pIn[c] > acc[c] ? pIn[c] : acc[c];
+                    }
+                    else if (poolingMode == 1) {
+#pragma omp simd
+                        for (int c = 0; c < iC; c++)
+                            acc[c] += pIn[c];
+                    }
+                    else {
+                        for (int c = 0; c < iC; c++)
+                            acc[c] += nd4j::math::nd4j_pow<T>(nd4j::math::nd4j_abs<T>(pIn[c]), extraParam0);
+                    }
+                }
+            }
+
+            if (poolingMode == 1) {
+                T divisor = (T) 1.f;
+                if ((int) extraParam0 == 0)         //Exclude padding
+                    divisor = static_cast<T>(((hend - hstart + dH - 1) / dH) * ((wend - wstart + dW - 1) / dW));
+                else if ((int) extraParam0 == 1)    //Include padding
+                    divisor = static_cast<T>(kH * kW);
+
+                for (int c = 0; c < iC; c++)
+                    acc[c] /= divisor;
+            }
+            else if (poolingMode == 2) {
+                for (int c = 0; c < iC; c++)
+                    acc[c] = nd4j::math::nd4j_pow<T>(acc[c], static_cast<T>(1.f) / extraParam0);
+            }
+
+            T* pOut = out + b * oStrB + oh * oStrH + ow * oStrW;
+            for (int c = 0; c < iC; c++)
+                pOut[c * oStrC] = acc[c];
+        }
+    }
+
+    if (xCont != &input)
+        delete xCont;
+}
+
 //////////////////////////////////////////////////////////////////////////
 template <typename T>
 void ConvolutionUtils<T>::pooling3d(NDArray<T>& input, NDArray<T>& output, const T* extraParams) {
@@ -22,6 +22,7 @@
 #if NOT_EXCLUDED(OP_embedding_lookup)
 
 #include <ops/declarable/CustomOperations.h>
+#include <ops/declarable/helpers/transforms.h>
 #include <helpers/ShapeUtils.h>
 #include <vector>
 #include <numeric>
@@ -35,11 +36,10 @@ namespace ops {
 CUSTOM_OP_IMPL(embedding_lookup, 2, 1, false, 0, 1) {
 
     NDArray<T>* input   = INPUT_VARIABLE(0); // lookup param
-    NDArray<T>* indeces = INPUT_VARIABLE(1); // indeces, as is
     NDArray<T>* output  = OUTPUT_VARIABLE(0); //
 
     if (block.width() > 2) { // multiple input
-        indeces = INPUT_VARIABLE(block.width() - 1);
+        auto indeces = INPUT_INDICES(block.width() - 1);
         std::vector<int> dims(input->rankOf());
         int i = output->rankOf() - input->rankOf();
         for (auto& v: dims){
@@ -51,26 +51,22 @@ CUSTOM_OP_IMPL(embedding_lookup, 2, 1, false, 0, 1) {
                     output->sizeAt(0), block.width()
                 );
         for (Nd4jLong e = 0; e < indeces->lengthOf(); ++e) {
-            Nd4jLong thisIndex = static_cast<Nd4jLong>((*indeces)(e));
+            Nd4jLong thisIndex = (*indeces)(e);
+            REQUIRE_TRUE(thisIndex >= 0 && thisIndex < block.width() - 1, 0, "embedding_lookup: index %lld is out of range [0, %i)", (long long) thisIndex, block.width() - 1);
             input   = INPUT_VARIABLE(thisIndex); // lookup param
 
             outputView->at(e)->assign(input);
         }
     }
     else {
+        auto indeces = INPUT_INDICES(1); // indeces, as is
         int indexRank = indeces->rankOf();
         REQUIRE_TRUE(indexRank > 0, 0, "embeded_lookup: input array of indexes can't be single scalar, the requirement is: rank > 0 !");
+        REQUIRE_TRUE(indeces->isInRange(0, input->sizeAt(0)), 0, "embedding_lookup: indices should be within [0, %i) range", (int) input->sizeAt(0));
+        REQUIRE_TRUE(output->lengthOf() == indeces->lengthOf() * (input->lengthOf() / input->sizeAt(0)), 0, "embedding_lookup: wrong shape of output array for given indices.");
 
-        int inputRank = input->rankOf();
-        int lastIndDim = indeces->lengthOf();
-        int partition_mode = INT_ARG(0); // partition_mode == 0 - i.e. 'mod' , 1 - 'div'
-
-        nd4j::ops::gather<T> op;
-
-        std::unique_ptr<ResultSet<T>> result(op.execute({input, indeces}, {}, {0}));
-        REQUIRE_TRUE(result->status() == ND4J_STATUS_OK, 0, "embedding_lookup: cannot retrieve results from gather op.");
-        REQUIRE_TRUE(result->at(0)->isSameShape(output), 0, "embedding_lookup: wrong shape of return from gather op.");
-        output->assign(result->at(0));
+        // gather is called directly here, so exact integer indices aren't converted to T on the way
+        helpers::gather(input, indeces.get(), output, {0});
     }
     return ND4J_STATUS_OK;
 }
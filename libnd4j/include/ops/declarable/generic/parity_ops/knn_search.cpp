@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#include <op_boilerplate.h>
+#if NOT_EXCLUDED(OP_knn_search)
+
+#include <ops/declarable/helpers/knn.h>
+#include <ops/declarable/CustomOperations.h>
+
+namespace nd4j {
+    namespace ops {
+        CUSTOM_OP_IMPL(knn_search, 2, 2, false, 0, -2) {
+            auto x = INPUT_VARIABLE(0);
+            auto y = INPUT_VARIABLE(1);
+
+            auto distances = OUTPUT_VARIABLE(0);
+            auto indices = OUTPUT_VARIABLE(1);
+
+            int k = block.numI() > 0 ? INT_ARG(0) : 1;
+            int metric = block.numI() > 1 ? INT_ARG(1) : 1;
+
+            REQUIRE_TRUE(x->rankOf() == 2 && y->rankOf() == 2, 0, "knn_search: both queries and catalog should be matrices, but got ranks %i and %i", x->rankOf(), y->rankOf());
+            REQUIRE_TRUE(x->sizeAt(1) == y->sizeAt(1), 0, "knn_search: queries and catalog should have the same number of columns, but got %i and %i", (int) x->sizeAt(1), (int) y->sizeAt(1));
+            REQUIRE_TRUE(k > 0 && k <= y->sizeAt(0), 0, "knn_search: k should be within [1, %i], but got %i", (int) y->sizeAt(0), k);
+            REQUIRE_TRUE(helpers::knnIsSupportedMetric(metric), 0, "knn_search: metric %i isn't supported", metric);
+
+            return helpers::knnFunctor(x, y, distances, indices, k, metric);
+        }
+
+        DECLARE_SHAPE_FN(knn_search) {
+            auto shapeList = SHAPELIST();
+            auto in = inputShape->at(0);
+            int k = block.numI() > 0 ? INT_ARG(0) : 1;
+
+            for (int e = 0; e < 2; e++) {
+                Nd4jLong* newShape;
+                ALLOCATE(newShape, block.getWorkspace(), shape::shapeInfoLength(2), Nd4jLong);
+                std::vector<Nd4jLong> internalShape = {shape::sizeAt(in, 0), (Nd4jLong) k};
+                shape::shapeBuffer(2, internalShape.data(), newShape);
+
+                shapeList->push_back(newShape);
+            }
+
+            return shapeList;
+        }
+    }
+}
+
+#endif
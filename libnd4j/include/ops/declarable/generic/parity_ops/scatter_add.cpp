@@ -69,7 +69,7 @@ namespace nd4j {
                 output->assign(input);
 
             // ScatterHelper<T>::template scatterApply<simdOps::Add<T>>(output, indices, updates);
-            ScatterHelper<T>::template scatter<simdOps::Add<T>>(*indices, *updates, *output);
+            ScatterHelper<T>::template scatter<simdOps::Add<T>>(*INPUT_INDICES(1), *updates, *output);
 
             return ND4J_STATUS_OK;
         }
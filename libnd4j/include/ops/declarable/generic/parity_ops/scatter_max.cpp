@@ -68,7 +68,7 @@ OP_IMPL(scatter_max, 3, 1, true) {
     if (!block.isInplace())
             output->assign(input);
 
-    ScatterHelper<T>::template scatter<simdOps::Max<T>>(*indices, *updates, *output);
+    ScatterHelper<T>::template scatter<simdOps::Max<T>>(*INPUT_INDICES(1), *updates, *output);
 
     return Status::OK();
 }
@@ -68,7 +68,7 @@ namespace nd4j {
                 output->assign(input);
 
             // ScatterHelper<T>::template scatterApply<simdOps::Multiply<T>>(output, indices, updates);        
-            ScatterHelper<T>::template scatter<simdOps::Multiply<T>>(*indices, *updates, *output);
+            ScatterHelper<T>::template scatter<simdOps::Multiply<T>>(*INPUT_INDICES(1), *updates, *output);
 
             return ND4J_STATUS_OK;
         }
@@ -58,7 +58,7 @@ CUSTOM_OP_IMPL(scatter_nd, 3, 1, false, 0, 0) {
     else 
         *output = static_cast<T>(0);
 
-    ScatterHelper<T>::template scatterND<simdOps::Copy<T>>(*indices, *updates, *output);
+    ScatterHelper<T>::template scatterND<simdOps::Copy<T>>(*INPUT_INDICES(0), *updates, *output);
 
     return Status::OK();
 }
@@ -55,7 +55,7 @@ OP_IMPL(scatter_nd_sub, 3, 1, true) {
     if (!block.isInplace())
         output->assign(input);
     
-    ScatterHelper<T>::template scatterND<simdOps::Subtract<T>>(*indices, *updates, *output);
+    ScatterHelper<T>::template scatterND<simdOps::Subtract<T>>(*INPUT_INDICES(1), *updates, *output);
 
     return Status::OK();
 }
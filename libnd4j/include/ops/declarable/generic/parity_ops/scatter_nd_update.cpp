@@ -55,7 +55,7 @@ OP_IMPL(scatter_nd_update, 3, 1, true) {
     if (!block.isInplace())
         output->assign(input);
     
-    ScatterHelper<T>::template scatterND<simdOps::Copy<T>>(*indices, *updates, *output);
+    ScatterHelper<T>::template scatterND<simdOps::Copy<T>>(*INPUT_INDICES(1), *updates, *output);
 
     return Status::OK();
 }
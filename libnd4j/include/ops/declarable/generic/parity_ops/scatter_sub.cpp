@@ -69,7 +69,7 @@ namespace nd4j {
                 output->assign(input);
 
             // ScatterHelper<T>::template scatterApply<simdOps::Subtract<T>>(output, indices, updates);        
-            ScatterHelper<T>::template scatter<simdOps::Subtract<T>>(*indices, *updates, *output);
+            ScatterHelper<T>::template scatter<simdOps::Subtract<T>>(*INPUT_INDICES(1), *updates, *output);
 
             return ND4J_STATUS_OK;
         }
@@ -25,31 +25,31 @@ namespace nd4j {
     namespace ops {
         CUSTOM_OP_IMPL(segment_max, 2, 1, false, 0, 0) {
             NDArray<T>* input = INPUT_VARIABLE(0);
-            NDArray<T>* idxSegments = INPUT_VARIABLE(1);
+            auto idxSegments = INPUT_INDICES(1);
             NDArray<T>* segmentedOutput = OUTPUT_VARIABLE(0);
             REQUIRE_TRUE(idxSegments->isVector(), 0, "segment_max: segment indexes array should be a vector, but it rank is %i.", idxSegments->rankOf());
             REQUIRE_TRUE(idxSegments->lengthOf() == input->sizeAt(0), 0, "segment_max: segment indexes array length should be equal to the input first dimension, but %i != %i.", idxSegments->lengthOf(), input->sizeAt(0));
 
             Nd4jLong expected, wrong;
 
-            REQUIRE_TRUE(helpers::segmentIndicesValidate(idxSegments, expected, wrong), 0, "segment_max: segment indices should be arranged, but %i > %i",
+            REQUIRE_TRUE(helpers::segmentIndicesValidate(idxSegments.get(), expected, wrong), 0, "segment_max: segment indices should be arranged, but %i > %i",
                     wrong, expected);
 
-            helpers::segmentMaxFunctor(input, idxSegments, segmentedOutput);
+            helpers::segmentMaxFunctor(input, idxSegments.get(), segmentedOutput);
 
             return ND4J_STATUS_OK;
         }
 
         DECLARE_SHAPE_FN(segment_max) {
 
-            NDArray<T>* idxVector = INPUT_VARIABLE(1);
+            auto idxVector = INPUT_INDICES(1);
 
             auto in = inputShape->at(0);
             int outRank = shape::rank(in);
             Nd4jLong* outputShape = nullptr;
-            T val = (*idxVector)(idxVector->lengthOf() - 1);
+            Nd4jLong val = (*idxVector)(idxVector->lengthOf() - 1);
 
-            int numOfClasses = static_cast<int>(val) + 1;
+            Nd4jLong numOfClasses = val + 1;
 
             ALLOCATE(outputShape, block.getWorkspace(), shape::shapeInfoLength(outRank), Nd4jLong);
 
@@ -69,7 +69,7 @@ namespace nd4j {
             auto output = OUTPUT_VARIABLE(0);
             auto outIndices = OUTPUT_VARIABLE(1);
             outIndices->assign(indices);
-            return helpers::segmentMaxFunctorBP(input, indices, gradOut, output);
+            return helpers::segmentMaxFunctorBP(input, INPUT_INDICES(1).get(), gradOut, output);
         }
         DECLARE_SHAPE_FN(segment_max_bp){
             Nd4jLong* in = inputShape->at(0);
@@ -25,31 +25,31 @@ namespace nd4j {
     namespace ops {
         CUSTOM_OP_IMPL(segment_sum, 2, 1, false, 0, 0) {
             NDArray<T>* input = INPUT_VARIABLE(0);
-            NDArray<T>* idxSegments = INPUT_VARIABLE(1);
+            auto idxSegments = INPUT_INDICES(1);
             NDArray<T>* segmentedOutput = OUTPUT_VARIABLE(0);
             REQUIRE_TRUE(idxSegments->isVector(), 0, "segment_sum: segment indexes array should be a vector, but it rank is %i.", idxSegments->rankOf());
             REQUIRE_TRUE(idxSegments->lengthOf() == input->sizeAt(0), 0, "segment_sum: segment indexes array length should be equal to the input first dimension, but %i != %i.", idxSegments->lengthOf(), input->sizeAt(0));
 
             Nd4jLong expected, wrong;
 
-            REQUIRE_TRUE(helpers::segmentIndicesValidate(idxSegments, expected, wrong), 0, "segment_sum: segment indices should be arranged, but %i > %i",
+            REQUIRE_TRUE(helpers::segmentIndicesValidate(idxSegments.get(), expected, wrong), 0, "segment_sum: segment indices should be arranged, but %i > %i",
                     wrong, expected);
 
-            helpers::segmentSumFunctor(input, idxSegments, segmentedOutput);
+            helpers::segmentSumFunctor(input, idxSegments.get(), segmentedOutput);
 
             return ND4J_STATUS_OK;
         }
 
         DECLARE_SHAPE_FN(segment_sum) {
 
-            NDArray<T>* idxVector = INPUT_VARIABLE(1);
+            auto idxVector = INPUT_INDICES(1);
 
             auto in = inputShape->at(0);
             int outRank = shape::rank(in);
             Nd4jLong* outputShape = nullptr;
-            T val = (*idxVector)(idxVector->lengthOf() - 1);
+            Nd4jLong val = (*idxVector)(idxVector->lengthOf() - 1);
 
-            int numOfClasses = static_cast<int>(val) + 1;
+            Nd4jLong numOfClasses = val + 1;
 
             ALLOCATE(outputShape, block.getWorkspace(), shape::shapeInfoLength(outRank), Nd4jLong);
 
@@ -65,7 +65,7 @@ namespace nd4j {
 
         CUSTOM_OP_IMPL(segment_sum_bp, 3, 2, false, 0, 0) {
 
-            return helpers::segmentSumFunctorBP(INPUT_VARIABLE(0), INPUT_VARIABLE(1), INPUT_VARIABLE(2), OUTPUT_VARIABLE(0));
+            return helpers::segmentSumFunctorBP(INPUT_VARIABLE(0), INPUT_INDICES(1).get(), INPUT_VARIABLE(2), OUTPUT_VARIABLE(0));
         }
         DECLARE_SHAPE_FN(segment_sum_bp){
             Nd4jLong* in = inputShape->at(0);
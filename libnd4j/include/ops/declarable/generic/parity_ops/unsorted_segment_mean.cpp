@@ -25,7 +25,7 @@ namespace nd4j {
     namespace ops {
         CUSTOM_OP_IMPL(unsorted_segment_mean, 2, 1, false, 0, 1) {
             NDArray<T>* input = INPUT_VARIABLE(0);
-            NDArray<T>* idxSegments = INPUT_VARIABLE(1);
+            auto idxSegments = INPUT_INDICES(1);
             NDArray<T>* segmentedOutput = OUTPUT_VARIABLE(0);
             Nd4jLong numOfClasses = INT_ARG(0);
 
@@ -34,10 +34,10 @@ namespace nd4j {
 
             Nd4jLong wrong;
 
-            REQUIRE_TRUE(helpers::unsortedSegmentIndicesValidate(idxSegments, numOfClasses, wrong), 0, "unsorted_segment_mean: segment indices should be in range [0, %i), but %i > %i",
+            REQUIRE_TRUE(helpers::unsortedSegmentIndicesValidate(idxSegments.get(), numOfClasses, wrong), 0, "unsorted_segment_mean: segment indices should be in range [0, %i), but %i > %i",
                     numOfClasses, wrong, numOfClasses);
 
-            helpers::unsortedSegmentMeanFunctor(input, idxSegments, numOfClasses, segmentedOutput);
+            helpers::unsortedSegmentMeanFunctor(input, idxSegments.get(), numOfClasses, segmentedOutput);
 
             return ND4J_STATUS_OK;
         }
@@ -62,7 +62,7 @@ namespace nd4j {
         }
 
         CUSTOM_OP_IMPL(unsorted_segment_mean_bp, 3, 2, false, 0, 1) {
-            return helpers::unsortedSegmentMeanFunctorBP(INPUT_VARIABLE(0), INPUT_VARIABLE(1), INPUT_VARIABLE(2), INT_ARG(0), OUTPUT_VARIABLE(0));
+            return helpers::unsortedSegmentMeanFunctorBP(INPUT_VARIABLE(0), INPUT_INDICES(1).get(), INPUT_VARIABLE(2), INT_ARG(0), OUTPUT_VARIABLE(0));
         }
         DECLARE_SHAPE_FN(unsorted_segment_mean_bp){
             Nd4jLong* in = inputShape->at(0);
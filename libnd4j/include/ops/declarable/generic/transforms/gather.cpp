@@ -33,7 +33,7 @@ namespace ops  {
 CUSTOM_OP_IMPL(gather, 1, 1, false, 0, -2) {
 
 	auto input   = INPUT_VARIABLE(0);
-    auto indices = block.width() > 1 ? INPUT_VARIABLE(1) : nullptr;
+    auto indices = block.width() > 1 ? INPUT_INDICES(1) : nullptr;
 	auto output  = OUTPUT_VARIABLE(0);
 
 	const int numOfIntArgs = block.numI();
@@ -57,7 +57,7 @@ CUSTOM_OP_IMPL(gather, 1, 1, false, 0, -2) {
     REQUIRE_TRUE(intArgs[0] < inputRank, 0, "GATHER op: input axis must be smaller than input array rank, but got %i and %i correspondingly!", intArgs[0], inputRank);
     REQUIRE_TRUE(indices || numOfIntArgs > 1, 0, "GATHER op: indices should be provided either as additional input array or as IntArguments !");
 
-	helpers::gather(input, indices, output, intArgs);
+	helpers::gather(input, indices.get(), output, intArgs);
 
     return Status::OK();
 }
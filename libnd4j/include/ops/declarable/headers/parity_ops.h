@@ -651,6 +651,23 @@ namespace nd4j {
         DECLARE_CUSTOM_OP(in_top_k, 2, 1, true, 1, 1);
         #endif
 
+        /**
+         * knn_search operation finds k nearest catalog rows for each query row, without building full distance matrix
+         * Input arrays:
+         *    0 - queries matrix [N, D]
+         *    1 - catalog matrix [M, D]
+         * Int arguments:
+         *    0 - k (default 1)
+         *    1 - metric, as Reduce3 op number (default 1 - euclidean). Supported: 0 manhattan, 1 euclidean,
+         *        2 cosine similarity, 3 dot, 5 cosine distance, 6 jaccard, 7 hamming
+         * Output arrays:
+         *    0 - distances [N, k], closest first
+         *    1 - catalog row indices [N, k]
+         */
+        #if NOT_EXCLUDED(OP_knn_search)
+        DECLARE_CUSTOM_OP(knn_search, 2, 2, false, 0, -2);
+        #endif
+
         /**
          * moments operation calculate a mean and variation for given NDArray
          * with reduce a result according to axis array given.
@@ -25,6 +25,9 @@
 
 
 #include<ops/declarable/helpers/gru.h>
+#include<ops/declarable/helpers/rnn.h>
+#include <helpers/MmulHelper.h>
+#include <array/NDArrayExpression.h>
 
 namespace nd4j 	  {
 namespace ops 	  {
@@ -62,7 +65,7 @@ void gruCell(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h) {
     const int nU = h0->sizeAt(1);                // number of units
     
     // gates = sigmoid(x*Wx + h0*Wh + b)
-    NDArray<T> gates = sigmoid<T>(mmul(*x, (*Wx)({0,0, 0,2*nU})) + mmul(*h0, (*Wh)({0,0, 0,2*nU})) + (*b)({0,2*nU}));       // [bS, 2*nU] + [bS, 2*nU] + [1, 2*nU] = [bS, 2*nU]    
+    NDArray<T> gates = expr::evaluate(expr::sigmoid(expr::lazy(mmul(*x, (*Wx)({0,0, 0,2*nU}))) + mmul(*h0, (*Wh)({0,0, 0,2*nU})) + (*b)({0,2*nU})), 'c', x->getWorkspace());       // [bS, 2*nU] + [bS, 2*nU] + [1, 2*nU] = [bS, 2*nU]    
     
     // reset gate
     NDArray<T> r = gates({0,0, 0,nU});                     // [bS, nU]
@@ -72,10 +75,10 @@ void gruCell(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h) {
 
     // ◦ means element-wise product or so called Hadamard product
     // n = activation(x*Wx + (r◦h0)*Wh + b)
-    NDArray<T> n = activation<T>(mmul(*x, (*Wx)({0,0, 2*nU,3*nU})) + mmul((*h0)*r, (*Wh)({0,0, 2*nU,3*nU})) + (*b)({2*nU,3*nU}));     // [bS, nU]
+    NDArray<T> n = expr::evaluate(expr::tanh(expr::lazy(mmul(*x, (*Wx)({0,0, 2*nU,3*nU}))) + mmul((*h0)*r, (*Wh)({0,0, 2*nU,3*nU})) + (*b)({2*nU,3*nU})), 'c', x->getWorkspace());     // [bS, nU]
 
     // current cell output
-    h->assign( u * (*h0) + ((T)1. - u) * n );
+    h->assign( expr::lazy(u) * (*h0) + ((T)1. - expr::lazy(u)) * n );
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -92,18 +95,78 @@ void gruTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h) {
     // h is cell outputs at each time step [time, bS, nU]
 
     const int time = x->sizeAt(0);    
-
-    NDArray<T> ht_1(*h0);
+    const int bS   = x->sizeAt(1);
+    const int nU   = h0->sizeAt(1);
+    const Nd4jLong tbS = (Nd4jLong) time * bS;
+
+    auto workspace = x->getWorkspace();
+
+    // input part of all gates for whole sequence at once: [time*bS, iS] * [iS, 3*nU]
+    NDArray<T>* xCopy = nullptr;
+    NDArray<T>* x2d = sequenceAsMatrix<T>(x, xCopy);
+    NDArray<T> xW('f', {tbS, 3*nU}, workspace);
+    MmulHelper<T>::mmul(x2d, Wx, &xW);
+    delete x2d;
+    delete xCopy;
+
+    // recurrent weights are split once, and kept contiguous
+    NDArray<T>* WhRU = (*Wh)({0,0, 0,2*nU}).dup('f');            // [nU, 2*nU]
+    NDArray<T>* WhN  = (*Wh)({0,0, 2*nU,3*nU}).dup('f');         // [nU, nU]
+
+    NDArray<T> ht_1('f', {bS, nU}, workspace);
+    NDArray<T> rh  ('f', {bS, nU}, workspace);                  // r◦h0
+    NDArray<T> u   ('f', {bS, nU}, workspace);
+    NDArray<T> zRU ('f', {bS, 2*nU}, workspace);
+    NDArray<T> zN  ('f', {bS, nU}, workspace);
+    ht_1.assign(h0);
+
+    T* pxW  = xW.getBuffer();
+    T* ph   = ht_1.getBuffer();
+    T* prh  = rh.getBuffer();
+    T* pu   = u.getBuffer();
+    T* pzRU = zRU.getBuffer();
+    T* pzN  = zN.getBuffer();
+    T* pb   = b->getBuffer();
+    const Nd4jLong bStride = b->isScalar() ? 0 : shape::elementWiseStride(b->getShapeInfo());
+    const Nd4jLong* hStrides = h->stridesOf();
+
+    const bool parallel = (Nd4jLong) bS * nU > Environment::getInstance()->elementwiseThreshold();
 
     // loop through time steps
     for (int t = 0; t < time; ++t) {
 
-        NDArray<T> xt = (*x)({t,t+1, 0,0, 0,0});
-        NDArray<T> ht = (*h)({t,t+1, 0,0, 0,0});
-
-        helpers::gruCell<T>({&xt, &ht_1, Wx, Wh, b}, &ht);
-        ht_1.assign(ht);    
+        const Nd4jLong xOffset = (Nd4jLong) t * bS;
+
+        MmulHelper<T>::mmul(&ht_1, WhRU, &zRU);
+
+        // reset and update gates
+#pragma omp parallel for schedule(static) if(parallel) collapse(2)
+        for (int j = 0; j < nU; ++j) {
+            for (int e = 0; e < bS; ++e) {
+                const Nd4jLong idx = (Nd4jLong) j * bS + e;
+                T r    = nd4j::math::nd4j_sigmoid<T>(pzRU[idx] + pxW[(Nd4jLong) j * tbS + xOffset + e] + pb[j * bStride]);
+                pu[idx] = nd4j::math::nd4j_sigmoid<T>(pzRU[(Nd4jLong) (nU + j) * bS + e] + pxW[(Nd4jLong) (nU + j) * tbS + xOffset + e] + pb[(nU + j) * bStride]);
+                prh[idx] = r * ph[idx];
+            }
+        }
+
+        MmulHelper<T>::mmul(&rh, WhN, &zN);
+
+        // candidate and current cell output
+#pragma omp parallel for schedule(static) if(parallel) collapse(2)
+        for (int j = 0; j < nU; ++j) {
+            for (int e = 0; e < bS; ++e) {
+                const Nd4jLong idx = (Nd4jLong) j * bS + e;
+                T n  = nd4j::math::nd4j_tanh<T>(pzN[idx] + pxW[(Nd4jLong) (2*nU + j) * tbS + xOffset + e] + pb[(2*nU + j) * bStride]);
+                T ht = pu[idx] * ph[idx] + ((T)1. - pu[idx]) * n;
+                ph[idx] = ht;
+                h->getBuffer()[t * hStrides[0] + e * hStrides[1] + j * hStrides[2]] = ht;
+            }
+        }
     }
+
+    delete WhRU;
+    delete WhN;
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -132,14 +195,14 @@ void gruCellBP(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArray
 
     // ***** feed forward step ***** //    
     // gates = sigmoid(x*Wx + h0*Wh + b)
-    NDArray<T> gates = sigmoid<T>(mmul(*x, (*Wx)({0,0, 0,2*nU})) + mmul(*h0, (*Wh)({0,0, 0,2*nU})) + (*b)({0,2*nU}));       // [bS, 2*nU] + [bS, 2*nU] + [1, 2*nU] = [bS, 2*nU]    
+    NDArray<T> gates = expr::evaluate(expr::sigmoid(expr::lazy(mmul(*x, (*Wx)({0,0, 0,2*nU}))) + mmul(*h0, (*Wh)({0,0, 0,2*nU})) + (*b)({0,2*nU})), 'c', x->getWorkspace());       // [bS, 2*nU] + [bS, 2*nU] + [1, 2*nU] = [bS, 2*nU]    
     // reset gate
     NDArray<T> r = gates({0,0, 0, nU});               // [bS, nU]
     // update gate
     NDArray<T> u = gates({0,0, nU, 2*nU});            // [bS, nU]
     // ◦ means element-wise product or so called Hadamard product
     // n = activation(x*Wx + (r◦h0)*Wh + b)
-    NDArray<T> n = activation<T>(mmul(*x, (*Wx)({0,0, 2*nU,3*nU})) + mmul((*h0)*r, (*Wh)({0,0, 2*nU,3*nU})) + (*b)({2*nU,3*nU}));     // [bS, nU]
+    NDArray<T> n = expr::evaluate(expr::tanh(expr::lazy(mmul(*x, (*Wx)({0,0, 2*nU,3*nU}))) + mmul((*h0)*r, (*Wh)({0,0, 2*nU,3*nU})) + (*b)({2*nU,3*nU})), 'c', x->getWorkspace());     // [bS, nU]
 
     // ***** back prop step ***** // 
     NDArray<T> Wxr  = (*Wx)({0,0, 0,   nU});
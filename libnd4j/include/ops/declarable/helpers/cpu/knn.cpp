@@ -0,0 +1,250 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+#include <ops/declarable/helpers/knn.h>
+#include <helpers/MmulHelper.h>
+#include <algorithm>
+#include <vector>
+
+// rows of x processed at once, and columns of y per tile. one tile of distances is KNN_ROW_BLOCK * KNN_COL_TILE elements
+#define KNN_ROW_BLOCK 256
+#define KNN_COL_TILE 1024
+
+namespace nd4j {
+namespace ops {
+namespace helpers {
+
+    bool knnIsSupportedMetric(int metric) {
+        switch (metric) {
+            case 0:     // ManhattanDistance
+            case 1:     // EuclideanDistance
+            case 2:     // CosineSimilarity
+            case 3:     // Dot
+            case 5:     // CosineDistance
+            case 6:     // JaccardDistance
+            case 7:     // SimpleHammingDistance
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------- //
+    // similarities are better when larger, distances when smaller
+    static FORCEINLINE bool largerIsCloser(int metric) {
+        return metric == 2 || metric == 3;
+    }
+
+    // these metrics are expressed via dot products, so they go through GEMM
+    static FORCEINLINE bool usesGemm(int metric) {
+        return metric == 1 || metric == 2 || metric == 3 || metric == 5;
+    }
+
+    // ----------------------------------------------------------------------------------------------- //
+    // a is closer than b, ties are resolved in favor of lower index. NaN is farther than anything else, so ordering stays strict weak
+    template <typename T>
+    struct Closer {
+        bool larger;
+
+        bool operator()(const std::pair<T, Nd4jLong>& a, const std::pair<T, Nd4jLong>& b) const {
+            const bool aNaN = a.first != a.first;
+            const bool bNaN = b.first != b.first;
+
+            if (aNaN != bNaN)
+                return bNaN;
+
+            if (!aNaN && a.first != b.first)
+                return larger ? a.first > b.first : a.first < b.first;
+
+            return a.second < b.second;
+        }
+    };
+
+    // ----------------------------------------------------------------------------------------------- //
+    template <typename T>
+    static FORCEINLINE T elementwiseDistance(const T* a, const T* b, const Nd4jLong length, const int metric) {
+        T sum = static_cast<T>(0.f);
+        switch (metric) {
+            case 0: {
+#pragma omp simd reduction(sumT:sum)
+                for (Nd4jLong e = 0; e < length; e++)
+                    sum += nd4j::math::nd4j_abs<T>(a[e] - b[e]);
+
+                return sum;
+            }
+            case 6: {
+                T denom = static_cast<T>(0.f);
+#pragma omp simd reduction(sumT:sum, denom)
+                for (Nd4jLong e = 0; e < length; e++) {
+                    sum += nd4j::math::nd4j_min<T>(a[e], b[e]);
+                    denom += nd4j::math::nd4j_max<T>(a[e], b[e]);
+                }
+
+                return static_cast<T>(1.f) - sum / denom;
+            }
+            default: {
+#pragma omp simd reduction(sumT:sum)
+                for (Nd4jLong e = 0; e < length; e++)
+                    sum += a[e] == b[e] ? static_cast<T>(0.f) : static_cast<T>(1.f);
+
+                return sum / static_cast<T>(length);
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------- //
+    // fills tile [rows x cols] ('f' order) with distances between x rows [r0, r0 + rows) and y rows [c0, c0 + cols)
+    template <typename T>
+    static void distanceTile(T* x, T* y, const Nd4jLong D, const Nd4jLong r0, const Nd4jLong rows, const Nd4jLong c0, const Nd4jLong cols,
+                             const std::vector<T>& xNorms, const std::vector<T>& yNorms, const int metric, T* tile) {
+        if (usesGemm(metric)) {
+            // c-ordered [rows, D] block of x, and c-ordered [cols, D] block of y viewed as 'f' [D, cols]
+            NDArray<T> xBlock(x + r0 * D, 'c', {rows, D});
+            NDArray<T> yBlockT(y + c0 * D, 'f', {D, cols});
+            NDArray<T> gram(tile, 'f', {rows, cols});
+
+            MmulHelper<T>::mmul(&xBlock, &yBlockT, &gram, static_cast<T>(1.f), static_cast<T>(0.f));
+
+            if (metric == 3)
+                return;
+
+#pragma omp parallel for schedule(static) if (rows * cols > Environment::getInstance()->elementwiseThreshold())
+            for (Nd4jLong c = 0; c < cols; c++) {
+                T yn = yNorms[c0 + c];
+                for (Nd4jLong r = 0; r < rows; r++) {
+                    T xn = xNorms[r0 + r];
+                    T g = tile[r + c * rows];
+
+                    if (metric == 1) {
+                        // ||a - b||^2 = ||a||^2 + ||b||^2 - 2ab, clamped against cancellation
+                        tile[r + c * rows] = nd4j::math::nd4j_sqrt<T>(nd4j::math::nd4j_max<T>(static_cast<T>(0.f), xn + yn - static_cast<T>(2.f) * g));
+                    } else {
+                        T similarity = g / (nd4j::math::nd4j_sqrt<T>(xn) * nd4j::math::nd4j_sqrt<T>(yn));
+                        tile[r + c * rows] = metric == 2 ? similarity : static_cast<T>(1.f) - similarity;
+                    }
+                }
+            }
+        } else {
+            // tile of y is small enough to stay in cache while every x row of the block passes over it
+#pragma omp parallel for schedule(static) if (rows * cols * D > Environment::getInstance()->elementwiseThreshold())
+            for (Nd4jLong r = 0; r < rows; r++) {
+                T* a = x + (r0 + r) * D;
+                for (Nd4jLong c = 0; c < cols; c++)
+                    tile[r + c * rows] = elementwiseDistance<T>(a, y + (c0 + c) * D, D, metric);
+            }
+        }
+    }
+
+    // ----------------------------------------------------------------------------------------------- //
+    template <typename T>
+    int knnFunctor(NDArray<T>* x, NDArray<T>* y, NDArray<T>* distances, NDArray<T>* indices, int k, int metric) {
+        const Nd4jLong N = x->sizeAt(0);
+        const Nd4jLong M = y->sizeAt(0);
+        const Nd4jLong D = x->sizeAt(1);
+
+        // rows have to be contiguous for both GEMM views and simd loops
+        NDArray<T>* xC = x->ordering() == 'c' && x->ews() == 1 ? x : x->dup('c');
+        NDArray<T>* yC = y->ordering() == 'c' && y->ews() == 1 ? y : y->dup('c');
+        T* xBuffer = xC->getBuffer();
+        T* yBuffer = yC->getBuffer();
+
+        std::vector<T> xNorms;
+        std::vector<T> yNorms;
+        if (usesGemm(metric)) {
+            xNorms.resize(N);
+            yNorms.resize(M);
+
+#pragma omp parallel for schedule(static)
+            for (Nd4jLong r = 0; r < N; r++) {
+                T sum = static_cast<T>(0.f);
+                T* row = xBuffer + r * D;
+#pragma omp simd reduction(sumT:sum)
+                for (Nd4jLong e = 0; e < D; e++)
+                    sum += row[e] * row[e];
+                xNorms[r] = sum;
+            }
+
+#pragma omp parallel for schedule(static)
+            for (Nd4jLong r = 0; r < M; r++) {
+                T sum = static_cast<T>(0.f);
+                T* row = yBuffer + r * D;
+#pragma omp simd reduction(sumT:sum)
+                for (Nd4jLong e = 0; e < D; e++)
+                    sum += row[e] * row[e];
+                yNorms[r] = sum;
+            }
+        }
+
+        Closer<T> closer;
+        closer.larger = largerIsCloser(metric);
+
+        // per-row bounded heaps, farthest of the kept neighbours on top. full N x M matrix never exists
+        std::vector<std::vector<std::pair<T, Nd4jLong>>> heaps(N);
+        std::vector<T> tile(KNN_ROW_BLOCK * KNN_COL_TILE);
+
+        for (Nd4jLong r0 = 0; r0 < N; r0 += KNN_ROW_BLOCK) {
+            const Nd4jLong rows = nd4j::math::nd4j_min<Nd4jLong>(KNN_ROW_BLOCK, N - r0);
+
+            for (Nd4jLong c0 = 0; c0 < M; c0 += KNN_COL_TILE) {
+                const Nd4jLong cols = nd4j::math::nd4j_min<Nd4jLong>(KNN_COL_TILE, M - c0);
+
+                distanceTile<T>(xBuffer, yBuffer, D, r0, rows, c0, cols, xNorms, yNorms, metric, tile.data());
+
+#pragma omp parallel for schedule(static)
+                for (Nd4jLong r = 0; r < rows; r++) {
+                    auto& heap = heaps[r0 + r];
+                    for (Nd4jLong c = 0; c < cols; c++) {
+                        std::pair<T, Nd4jLong> candidate(tile[r + c * rows], c0 + c);
+
+                        if (static_cast<int>(heap.size()) < k) {
+                            heap.push_back(candidate);
+                            std::push_heap(heap.begin(), heap.end(), closer);
+                        } else if (closer(candidate, heap.front())) {
+                            std::pop_heap(heap.begin(), heap.end(), closer);
+                            heap.back() = candidate;
+                            std::push_heap(heap.begin(), heap.end(), closer);
+                        }
+                    }
+                }
+            }
+        }
+
+#pragma omp parallel for schedule(static)
+        for (Nd4jLong r = 0; r < N; r++) {
+            auto& heap = heaps[r];
+            std::sort_heap(heap.begin(), heap.end(), closer);
+
+            for (int e = 0; e < k; e++) {
+                distances->putScalar(r, e, heap[e].first);
+                indices->putScalar(r, e, static_cast<T>(heap[e].second));
+            }
+        }
+
+        if (xC != x)
+            delete xC;
+
+        if (yC != y)
+            delete yC;
+
+        return ND4J_STATUS_OK;
+    }
+
+    template int knnFunctor<float>(NDArray<float>* x, NDArray<float>* y, NDArray<float>* distances, NDArray<float>* indices, int k, int metric);
+    template int knnFunctor<float16>(NDArray<float16>* x, NDArray<float16>* y, NDArray<float16>* distances, NDArray<float16>* indices, int k, int metric);
+    template int knnFunctor<double>(NDArray<double>* x, NDArray<double>* y, NDArray<double>* distances, NDArray<double>* indices, int k, int metric);
+}
+}
+}
@@ -27,6 +27,9 @@
 
 
 #include<ops/declarable/helpers/lstm.h>
+#include<ops/declarable/helpers/rnn.h>
+#include <helpers/MmulHelper.h>
+#include <array/NDArrayExpression.h>
 
 namespace nd4j 	  {
 namespace ops 	  {
@@ -91,7 +94,8 @@ void lstmCell(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArray<
     const int numProj     = ht_1->sizeAt(1);
     const int numUnits    = ct_1->sizeAt(1);    
     
-    NDArray<T> z = mmul(*xt, *Wx) + mmul(*ht_1, *Wh) + *b;      // [bS x 4*numUnits] + [bS x 4*numUnits] + [1 x 4*numUnits] = [bS x 4*numUnits]    
+    NDArray<T> z = mmul(*xt, *Wx);
+    z.assign(expr::lazy(z) + mmul(*ht_1, *Wh) + *b);            // [bS x 4*numUnits] + [bS x 4*numUnits] + [1 x 4*numUnits] = [bS x 4*numUnits]    
     
     NDArray<T> zit = z({0,0, 0,            numUnits});      	// z for input gate,  = mmul(Wxi,xt) + mmul(Whi,ht_1) + bi    = [bS x numUnits]
     NDArray<T> zft = z({0,0, numUnits,   2*numUnits});      	// z for forget gate, = mmul(Wxf,xt) + mmul(Whf,ht_1) + bf    = [bS x numUnits]
@@ -99,35 +103,48 @@ void lstmCell(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArray<
     NDArray<T> zot = z({0,0, 3*numUnits, 4*numUnits});      	// z for output gate, = mmul(Wxo,xt) + mmul(Who,ht_1) + bo    = [bS x numUnits] 
 
     if(peephole) {                                              // add peephole connections: z  +  ct_1*Wc
-        zit += (*ct_1) * (*Wc)({0,          numUnits});       // add peephole connections to input gate
-        zft += (*ct_1) * (*Wc)({numUnits, 2*numUnits});       // add peephole connections to forget gate
+        zit.assign(expr::lazy(zit) + expr::lazy(*ct_1) * (*Wc)({0,          numUnits}));       // add peephole connections to input gate
+        zft.assign(expr::lazy(zft) + expr::lazy(*ct_1) * (*Wc)({numUnits, 2*numUnits}));       // add peephole connections to forget gate
     }
 
     // current sell state = ft*ct_1 + it*activation(mmul(Wxc,xt) + mmul(Whc,ht_1) + bc
-    ct->assign( sigmoid<T>(zft + forgetBias) * (*ct_1) + sigmoid<T>(zit) * activation<T>(zct) );
+    ct->assign( expr::sigmoid(expr::lazy(zft) + forgetBias) * (*ct_1) + expr::sigmoid(expr::lazy(zit)) * expr::tanh(expr::lazy(zct)) );
     
     // if clipping value is provided then cell state is clipped by this value prior to the cell output activation
     if(clippingCellValue != (T)0.)
         clipping(ct, clippingCellValue);
 
     if(peephole) 
-        zot += (*ct) * (*Wc)({{2*numUnits, 3*numUnits}});            // add peephole connections to output gate zot + ct*Wc
+        zot.assign(expr::lazy(zot) + expr::lazy(*ct) * (*Wc)({{2*numUnits, 3*numUnits}}));            // add peephole connections to output gate zot + ct*Wc
 
     // current cell output = ot*activation(ct)   
-    NDArray<T> htNoPeepHole = sigmoid<T>(zot) * activation<T>(*ct);      // = [bS x numUnits]
-
     // apply projection
     if(projection) {
+        NDArray<T> htNoPeepHole = expr::evaluate(expr::sigmoid(expr::lazy(zot)) * expr::tanh(expr::lazy(*ct)), 'c', xt->getWorkspace());      // = [bS x numUnits]
         ht->assign( mmul(htNoPeepHole, *Wp) );                           // [bS x numUnits] * [ numUnits x numProj] = [bS x numProj]
         // if clipping projection is provided then projected cell output state is clipped by this value 
         if(clippingProjValue != (T)0.)
             clipping(ht, clippingProjValue);
     }
     else
-        ht->assign(&htNoPeepHole);     
+        ht->assign( expr::sigmoid(expr::lazy(zot)) * expr::tanh(expr::lazy(*ct)) );
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+// same clipping rule as clipping() above, applied to a single value
+template <typename T>
+static FORCEINLINE T clipValue(T value, T limit) {
+
+    if(limit < (T)0.)
+        limit *= (T)(-1.);
+
+    if(value < -limit || value > limit)
+        value = limit;
+
+    return value;
+}
+
 //////////////////////////////////////////////////////////////////////////
 template <typename T>
 void lstmTimeLoop(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArray<T>*>& outArrs, const std::vector<T>& params) {
@@ -145,21 +162,108 @@ void lstmTimeLoop(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDAr
     NDArray<T>* h   =  outArrs[0];                 // cell outputs [time x bS x numProj], that is per each time step
     NDArray<T>* c   =  outArrs[1];                 // cell states  [time x bS x numUnits] that is per each time step    
 
-    const int time  = x->sizeAt(0);
-
-    NDArray<T> currentH(*h0);
-    NDArray<T> currentC(*c0);
+    const bool peephole   = (bool)params[0];
+    const bool projection = (bool)params[1];
+    const T clippingCellValue = params[2];
+    const T clippingProjValue = params[3];
+    const T forgetBias        = params[4];
+
+    const int time     = x->sizeAt(0);
+    const int bS       = x->sizeAt(1);
+    const int numProj  = h0->sizeAt(1);
+    const int numUnits = c0->sizeAt(1);
+    const Nd4jLong tbS = (Nd4jLong) time * bS;
+
+    auto workspace = x->getWorkspace();
+
+    // input projection for all time steps at once: [time*bS x inSize] * [inSize x 4*numUnits]
+    NDArray<T>* xCopy = nullptr;
+    NDArray<T>* x2d = sequenceAsMatrix<T>(x, xCopy);
+    NDArray<T> xW('f', {tbS, 4 * numUnits}, workspace);
+    MmulHelper<T>::mmul(x2d, Wx, &xW);
+    delete x2d;
+    delete xCopy;
+
+    // everything below is preallocated once, and kept in f order, so MmulHelper writes into it directly
+    NDArray<T> z('f', {bS, 4 * numUnits}, workspace);          // recurrent part of gates
+    NDArray<T> hPrev('f', {bS, numProj}, workspace);
+    NDArray<T> cPrev('f', {bS, numUnits}, workspace);
+    NDArray<T> hRaw('f', {bS, numUnits}, workspace);           // cell output before projection
+    hPrev.assign(h0);
+    cPrev.assign(c0);
+
+    NDArray<T>* hCell = projection ? &hRaw : &hPrev;
+
+    T* pxW = xW.getBuffer();
+    T* pz  = z.getBuffer();
+    T* pc  = cPrev.getBuffer();
+    T* pcell = hCell->getBuffer();
+    T* pb  = b->getBuffer();
+    const Nd4jLong bStride = b->isScalar() ? 0 : shape::elementWiseStride(b->getShapeInfo());
+
+    // peephole weights might be strided vector, so we keep them dense
+    std::vector<T> wc(peephole ? 3 * numUnits : 0);
+    for (int e = 0; e < wc.size(); e++)
+        wc[e] = (*Wc)(e);
+
+    const Nd4jLong* hStrides = h->stridesOf();
+    const Nd4jLong* cStrides = c->stridesOf();
 
     // loop through time steps
     for (int t = 0; t < time; ++t) {
-        
-        NDArray<T> xt = (*x)({t,t+1, 0,0, 0,0});
-        NDArray<T> ht = (*h)({t,t+1, 0,0, 0,0});
-        NDArray<T> ct = (*c)({t,t+1, 0,0, 0,0});
-
-        helpers::lstmCell<T>({&xt,&currentH,&currentC, Wx,Wh,Wc,Wp, b},   {&ht, &ct},   params);
-        currentH.assign(ht);
-        currentC.assign(ct);
+
+        // z = h_{t-1} * Wh, written into preallocated buffer
+        MmulHelper<T>::mmul(&hPrev, Wh, &z);
+
+        const Nd4jLong xOffset = (Nd4jLong) t * bS;
+
+        // all gates and cell state update in single pass
+#pragma omp parallel for schedule(static) if(bS * numUnits > Environment::getInstance()->elementwiseThreshold()) collapse(2)
+        for (int u = 0; u < numUnits; ++u) {
+            for (int e = 0; e < bS; ++e) {
+
+                T zit = pz[(Nd4jLong) u * bS + e]                  + pxW[(Nd4jLong) u * tbS + xOffset + e]                  + pb[u * bStride];
+                T zft = pz[(Nd4jLong) (numUnits + u) * bS + e]     + pxW[(Nd4jLong) (numUnits + u) * tbS + xOffset + e]     + pb[(numUnits + u) * bStride];
+                T zct = pz[(Nd4jLong) (2 * numUnits + u) * bS + e] + pxW[(Nd4jLong) (2 * numUnits + u) * tbS + xOffset + e] + pb[(2 * numUnits + u) * bStride];
+                T zot = pz[(Nd4jLong) (3 * numUnits + u) * bS + e] + pxW[(Nd4jLong) (3 * numUnits + u) * tbS + xOffset + e] + pb[(3 * numUnits + u) * bStride];
+
+                const Nd4jLong idx = (Nd4jLong) u * bS + e;
+                T ct_1 = pc[idx];
+
+                if(peephole) {
+                    zit += ct_1 * wc[u];
+                    zft += ct_1 * wc[numUnits + u];
+                }
+
+                T ct = nd4j::math::nd4j_sigmoid<T>(zft + forgetBias) * ct_1 + nd4j::math::nd4j_sigmoid<T>(zit) * nd4j::math::nd4j_tanh<T>(zct);
+
+                if(clippingCellValue != (T)0.)
+                    ct = clipValue<T>(ct, clippingCellValue);
+
+                if(peephole)
+                    zot += ct * wc[2 * numUnits + u];
+
+                pc[idx] = ct;
+                pcell[idx] = nd4j::math::nd4j_sigmoid<T>(zot) * nd4j::math::nd4j_tanh<T>(ct);
+
+                c->getBuffer()[t * cStrides[0] + e * cStrides[1] + u * cStrides[2]] = ct;
+            }
+        }
+
+        if(projection) {
+            MmulHelper<T>::mmul(&hRaw, Wp, &hPrev);
+
+            if(clippingProjValue != (T)0.) {
+                T* ph = hPrev.getBuffer();
+                for (Nd4jLong e = 0; e < hPrev.lengthOf(); ++e)
+                    ph[e] = clipValue<T>(ph[e], clippingProjValue);
+            }
+        }
+
+        T* ph = hPrev.getBuffer();
+        for (int u = 0; u < numProj; ++u)
+            for (int e = 0; e < bS; ++e)
+                h->getBuffer()[t * hStrides[0] + e * hStrides[1] + u * hStrides[2]] = ph[(Nd4jLong) u * bS + e];
     }    
 }
 
@@ -22,6 +22,8 @@
 
 #include<ops/declarable/helpers/rnn.h>
 #include <helpers/BlasHelper.h>
+#include <helpers/MmulHelper.h>
+#include <array/NDArrayExpression.h>
 
 
 namespace nd4j    {
@@ -51,12 +53,26 @@ void rnnCell(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* ht) {
     const int numUnits  = ht_1->sizeAt(1);
     
     // ht is current cell output [bS x numUnits], that is at current time step t        
-    ht->assign(activation<T>(mmul(*xt, *Wx) + (*b)({{0, numUnits}})  +  mmul(*ht_1, *Wh) + (*b)({{numUnits, 2*numUnits}})));      // [bS x numUnits] + [numUnits]  +  [bS x numUnits] + [numUnits] = [bS x numUnits]    
+    ht->assign(expr::tanh(expr::lazy(mmul(*xt, *Wx)) + (*b)({{0, numUnits}})  +  mmul(*ht_1, *Wh) + (*b)({{numUnits, 2*numUnits}})));      // [bS x numUnits] + [numUnits]  +  [bS x numUnits] + [numUnits] = [bS x numUnits]    
 
 }
 
 
 
+//////////////////////////////////////////////////////////////////////////
+template <typename T>
+NDArray<T>* sequenceAsMatrix(NDArray<T>* x, NDArray<T>*& copy) {
+
+    const Nd4jLong time = x->sizeAt(0), bS = x->sizeAt(1), inSize = x->sizeAt(2);
+    const Nd4jLong* strides = x->stridesOf();
+
+    copy = nullptr;
+    if(x->ordering() != 'c' || strides[0] != bS * inSize || strides[1] != inSize || strides[2] != 1)
+        copy = x->dup('c');
+
+    return new NDArray<T>(copy != nullptr ? copy->getBuffer() : x->getBuffer(), 'c', {time * bS, inSize}, x->getWorkspace());
+}
+
 //////////////////////////////////////////////////////////////////////////
 template <typename T>
 void rnnTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, NDArray<T>* hFinal) {
@@ -71,37 +87,70 @@ void rnnTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, NDArray<
     
     const int time     = x->sizeAt(0);
     const int bS       = x->sizeAt(1);        
-    
+    const int numUnits = Wh->sizeAt(0);
+    const Nd4jLong tbS = (Nd4jLong) time * bS;
+
+    auto workspace = x->getWorkspace();
+
+    // input-to-hidden part for all time steps at once: [time*bS x inSize] * [inSize x numUnits]
+    NDArray<T>* xCopy = nullptr;
+    NDArray<T>* x2d = sequenceAsMatrix<T>(x, xCopy);
+    NDArray<T> xW('f', {tbS, numUnits}, workspace);
+    MmulHelper<T>::mmul(x2d, Wx, &xW);
+    delete x2d;
+    delete xCopy;
+
     // at first time step
+    NDArray<T> ht_1('f', {bS, numUnits}, workspace);
+    NDArray<T> z('f', {bS, numUnits}, workspace);
     if(h0)
-        hFinal->assign(h0);
+        ht_1.assign(h0);
     else 
-        *hFinal = 0.;   
-
-    BlasHelper::getInstance();          // to avoid memory leak in pragma parallel loops
-// #pragma omp parallel for schedule(guided) collapse(2) if(bS > Environment::getInstance()->elementwiseThreshold())  
-    // loop through batch of inputs           
-    for (int e = 0; e < bS; ++e) {                  
-        // loop through time steps
-        for (int t = 0; t < time; ++t) {                                 
-
-            int maxStep = maxTimeStep ? (int)(*maxTimeStep)(e) : time;
-
-            NDArray<T> xt   = (*x)({t,t+1, e,e+1, 0,0}, true);
-            NDArray<T> ht   = (*h)({t,t+1, e,e+1, 0,0}, true);
-            NDArray<T> ht_1 = (*hFinal)({e,e+1, 0,0}, true);                       // previous state 
-            
-            if(t >= maxStep) {
-                ht = 0.;
-                if(maxStep != 0)                    
-                    ht_1.assign((*h)({maxStep-1,maxStep, e,e+1, 0,0}));
-            }
-            else {
-                helpers::rnnCell<T>({&xt, Wx, Wh, b, &ht_1}, &ht);
-                ht_1.assign(ht);
+        ht_1 = 0.;   
+
+    std::vector<int> maxSteps(bS, time);
+    if(maxTimeStep)
+        for (int e = 0; e < bS; ++e)
+            maxSteps[e] = (int)(*maxTimeStep)(e);
+
+    // both biases are merged once
+    std::vector<T> bias(numUnits);
+    for (int j = 0; j < numUnits; ++j)
+        bias[j] = (*b)(j) + (*b)(numUnits + j);
+
+    T* pxW = xW.getBuffer();
+    T* pz  = z.getBuffer();
+    T* ph  = ht_1.getBuffer();
+    const Nd4jLong* hStrides = h->stridesOf();
+
+    // loop through time steps
+    for (int t = 0; t < time; ++t) {
+
+        const Nd4jLong xOffset = (Nd4jLong) t * bS;
+
+        MmulHelper<T>::mmul(&ht_1, Wh, &z);
+
+#pragma omp parallel for schedule(static) if((Nd4jLong) bS * numUnits > Environment::getInstance()->elementwiseThreshold()) collapse(2)
+        for (int j = 0; j < numUnits; ++j) {
+            for (int e = 0; e < bS; ++e) {
+
+                const Nd4jLong idx = (Nd4jLong) j * bS + e;
+                T* ht = h->getBuffer() + t * hStrides[0] + e * hStrides[1] + j * hStrides[2];
+
+                // there are no calculations beyond max time step, previous state is kept as is
+                if(t >= maxSteps[e]) {
+                    *ht = (T) 0.;
+                    continue;
+                }
+
+                T value = nd4j::math::nd4j_tanh<T>(pz[idx] + pxW[(Nd4jLong) j * tbS + xOffset + e] + bias[j]);
+                ph[idx] = value;
+                *ht = value;
             }
         }
-    }    
+    }
+
+    hFinal->assign(&ht_1);
 }
 
 
@@ -114,6 +163,10 @@ template void rnnTimeLoop<float>  (const std::vector<NDArray<float>*>&   inArrs,
 template void rnnTimeLoop<float16>(const std::vector<NDArray<float16>*>& inArrs, NDArray<float16>* h, NDArray<float16>* hFinal);
 template void rnnTimeLoop<double> (const std::vector<NDArray<double>*>&  inArrs, NDArray<double>*  h, NDArray<double>*  hFinal);
 
+template NDArray<float>*   sequenceAsMatrix<float>  (NDArray<float>*   x, NDArray<float>*&   copy);
+template NDArray<float16>* sequenceAsMatrix<float16>(NDArray<float16>* x, NDArray<float16>*& copy);
+template NDArray<double>*  sequenceAsMatrix<double> (NDArray<double>*  x, NDArray<double>*&  copy);
+
 
 }
 }
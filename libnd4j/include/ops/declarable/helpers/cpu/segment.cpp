@@ -26,20 +26,20 @@ namespace helpers {
 
     // segment max
     template <typename T>
-    void segmentMaxFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+    void segmentMaxFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output) {
         int numClasses = output->sizeAt(0);
         // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0.));
+        Nd4jLong idx = (*indices)(0);
         if (input->isVector()) {
             T val = (*input)(0.);
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int e = 1; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
+                if (idx == (*indices)(e)) {
                    // max 
                    val = nd4j::math::nd4j_max(val, (*input)(e));
                 }
                 else {
-                    idx = static_cast<int>((*indices)(e));
+                    idx = (*indices)(e);
                     val = (*input)(e);
                 }
                 (*output)(idx) = val;
@@ -61,13 +61,13 @@ namespace helpers {
             maxT->assign(listOfTensors->at(0));
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 1; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
+                if ((*indices)(i) == idx) {
                     for (int e = 0; e < maxT->lengthOf(); e++) {
                        (*maxT)(e) = nd4j::math::nd4j_max((*maxT)(e), (*listOfTensors->at(i))(e));
                     }
                 }
                 else {
-                    idx = static_cast<int>((*indices)(i));
+                    idx = (*indices)(i);
                     maxT = listOfOutTensors->at(idx);
                     maxT->assign(listOfTensors->at(i));
                 }
@@ -80,21 +80,21 @@ namespace helpers {
 
     // segmen min 
     template <typename T>
-    void segmentMinFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+    void segmentMinFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output) {
         int numClasses = output->sizeAt(0);
         // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0.));
+        Nd4jLong idx = (*indices)(0);
         if (input->isVector()) {
             T val = (*input)(0.);
 #pragma omp parallel for if(indices->rankOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
 
             for (int e = 1; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
+                if (idx == (*indices)(e)) {
                    // min 
                    val = nd4j::math::nd4j_min(val, (*input)(e));
                 }
                 else {
-                    idx = static_cast<int>((*indices)(e));
+                    idx = (*indices)(e);
                     val = (*input)(e);
                 }
                 (*output)(idx) = val;
@@ -117,13 +117,13 @@ namespace helpers {
             minT->assign(listOfTensors->at(0));
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 1; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
+                if ((*indices)(i) == idx) {
                     for (int e = 0; e < minT->lengthOf(); e++) {
                        (*minT)(e) = nd4j::math::nd4j_min((*minT)(e), (*listOfTensors->at(i))(e));
                     }
                 }
                 else {
-                    idx = static_cast<int>((*indices)(i));
+                    idx = (*indices)(i);
                     minT = listOfOutTensors->at(idx);
                     minT->assign(listOfTensors->at(i));
                 }
@@ -133,23 +133,23 @@ namespace helpers {
 
     // segmen mean
     template <typename T>
-    void segmentMeanFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+    void segmentMeanFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output) {
         int numClasses = output->sizeAt(0);
         // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0.));
+        Nd4jLong idx = (*indices)(0);
         if (input->isVector()) {
             T val = T(0.f);
             int count = 0;
 //#pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int e = 0; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
+                if (idx == (*indices)(e)) {
                    // mean 
                    val += (*input)(e);
                    count++;
                 }
                 else {
                    (*output)(idx) = val / count;
-                    idx = static_cast<int>((*indices)(e));
+                    idx = (*indices)(e);
                     val = (*input)(e);
                     count = 1;
                 }
@@ -171,7 +171,7 @@ namespace helpers {
             NDArray<T>* meanV = meanT->dup();
             meanV->assign(listOfTensors->at(0));
             for (int i = 1; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
+                if ((*indices)(i) == idx) {
                     for (int e = 0; e < meanT->lengthOf(); e++) {
                        (*meanV)(e) += (*listOfTensors->at(i))(e);
                     }
@@ -180,7 +180,7 @@ namespace helpers {
                 else {
                     //meanT->assign(meanV);
                     meanV->template applyScalar<simdOps::Divide<T>>(count, meanT);
-                    idx = static_cast<int>((*indices)(i));
+                    idx = (*indices)(i);
                     meanT = listOfOutTensors->at(idx);
                     meanV->assign(listOfTensors->at(i));
                     count = T(1.f);
@@ -194,20 +194,20 @@ namespace helpers {
     }
 
     template <typename T>
-    void segmentSumFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+    void segmentSumFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output) {
         int numClasses = output->sizeAt(0);
         // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0.));
+        Nd4jLong idx = (*indices)(0);
         if (input->isVector()) {
             T val = T(0.f);
             int count = 0;
             for (int e = 0; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
+                if (idx == (*indices)(e)) {
                    // sum 
                    val += (*input)(e);
                 }
                 else {
-                    idx = static_cast<int>((*indices)(e));
+                    idx = (*indices)(e);
                     val = (*input)(e);
                 }
                 (*output)(idx) = val;
@@ -226,13 +226,13 @@ namespace helpers {
             NDArray<T>* sumT = listOfOutTensors->at(idx);
 
             for (int i = 0; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
+                if ((*indices)(i) == idx) {
                     for (int e = 0; e < sumT->lengthOf(); e++) {
                        (*sumT)(e) += (*listOfTensors->at(i))(e);
                     }
                 }
                 else {
-                    idx = static_cast<int>((*indices)(i));
+                    idx = (*indices)(i);
                     sumT = listOfOutTensors->at(idx);
                     sumT->assign(listOfTensors->at(i));
                 }
@@ -243,21 +243,21 @@ namespace helpers {
     }
 
     template <typename T>
-    void segmentProdFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output) {
+    void segmentProdFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output) {
         int numClasses = output->sizeAt(0);
         // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0.));
+        Nd4jLong idx = (*indices)(0);
         output->assign((T)1.);
         if (input->isVector()) {
             T val = (*input)(0.);
             int count = 0;
             for (int e = 1; e < indices->lengthOf(); e++) {
-                if (idx == static_cast<int>((*indices)(e))) {
+                if (idx == (*indices)(e)) {
                    // sum 
                    val *= (*input)(e);
                 }
                 else {
-                    idx = static_cast<int>((*indices)(e));
+                    idx = (*indices)(e);
                     val = (*input)(e);
                 }
                 (*output)(idx) = val;
@@ -275,13 +275,13 @@ namespace helpers {
             NDArray<T>* sumT = listOfOutTensors->at(idx);
             sumT->assign(listOfTensors->at(0));
             for (int i = 1; i < indices->lengthOf(); i++) {
-                if (static_cast<int>((*indices)(i)) == idx) {
+                if ((*indices)(i) == idx) {
                     for (int e = 0; e < sumT->lengthOf(); e++) {
                        (*sumT)(e) *= (*listOfTensors->at(i))(e);
                     }
                 }
                 else {
-                    idx = static_cast<int>((*indices)(i));
+                    idx = (*indices)(i);
                     sumT = listOfOutTensors->at(idx);
                     sumT->assign(listOfTensors->at(i));
                 }
@@ -291,67 +291,62 @@ namespace helpers {
         }
     }
 
-    template <typename T>
-    bool segmentIndicesValidate(NDArray<T>* indices, Nd4jLong& expected, Nd4jLong& output) {
-            T val = (*indices)(0.);
-            for (int e = 1; e < indices->lengthOf(); e++) {
+    bool segmentIndicesValidate(IndexArray* indices, Nd4jLong& expected, Nd4jLong& output) {
+            Nd4jLong val = (*indices)(0);
+            for (Nd4jLong e = 1; e < indices->lengthOf(); e++) {
                 output = (*indices)(e);
-                if (val > output) 
+                if (val > output) {
+                    expected = val;
                     return false;
-                val = (*indices)(e);
+                }
+                val = output;
             }
             return true;
     }
 
-    template bool segmentIndicesValidate(NDArray<float>* indices, Nd4jLong& expected, Nd4jLong& output);
-    template bool segmentIndicesValidate(NDArray<float16>* indices, Nd4jLong& expected, Nd4jLong& output);
-    template bool segmentIndicesValidate(NDArray<double>* indices, Nd4jLong& expected, Nd4jLong& output);
+    template void segmentMaxFunctor<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* output);
+    template void segmentMaxFunctor<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* output);
+    template void segmentMaxFunctor<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* output);
 
-    template void segmentMaxFunctor<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* output);
-    template void segmentMaxFunctor<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* output);
-    template void segmentMaxFunctor<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* output);
+    template void segmentMinFunctor<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* output);
+    template void segmentMinFunctor<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* output);
+    template void segmentMinFunctor<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* output);
 
-    template void segmentMinFunctor<float>(NDArray<float>* input, NDArray<float>* , NDArray<float>* output);
-    template void segmentMinFunctor<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* output);
-    template void segmentMinFunctor<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* output);
+    template void segmentMeanFunctor<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* output);
+    template void segmentMeanFunctor<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* output);
+    template void segmentMeanFunctor<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* output);
 
-    template void segmentMeanFunctor<float>(NDArray<float>* input, NDArray<float>* , NDArray<float>* output);
-    template void segmentMeanFunctor<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* output);
-    template void segmentMeanFunctor<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* output);
+    template void segmentSumFunctor<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* output);
+    template void segmentSumFunctor<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* output);
+    template void segmentSumFunctor<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* output);
 
-    template void segmentSumFunctor<float>(NDArray<float>* input, NDArray<float>* , NDArray<float>* output);
-    template void segmentSumFunctor<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* output);
-    template void segmentSumFunctor<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* output);
-
-    template void segmentProdFunctor<float>(NDArray<float>* input, NDArray<float>* , NDArray<float>* output);
-    template void segmentProdFunctor<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* output);
-    template void segmentProdFunctor<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* output);
+    template void segmentProdFunctor<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* output);
+    template void segmentProdFunctor<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* output);
+    template void segmentProdFunctor<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* output);
 
     // -------------------------------------------------------------------------------------------------------------- //
     // Unsorted segment ops
     // -------------------------------------------------------------------------------------------------------------- //
-    template <typename T>
-    bool unsortedSegmentIndicesValidate(NDArray<T>* indices, Nd4jLong expected, Nd4jLong& output) {
-        Nd4jLong val = static_cast<Nd4jLong >((*indices)(0.));
-        for (int e = 1; e < indices->lengthOf(); e++) {
-            if (val >= expected) {
+    bool unsortedSegmentIndicesValidate(IndexArray* indices, Nd4jLong expected, Nd4jLong& output) {
+        for (Nd4jLong e = 0; e < indices->lengthOf(); e++) {
+            Nd4jLong val = (*indices)(e);
+            if (val < 0 || val >= expected) {
                 output = val;
                 return false;
             }
-            val = static_cast<Nd4jLong >((*indices)(e));
         }
         output = expected;
         return true;
     }
 
     template <typename T>
-    void unsortedSegmentMaxFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
+    void unsortedSegmentMaxFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
 
         // if input is a vector: (as if in doc sample)
-        //int idx = static_cast<int>((*indices)(0.));
+        //Nd4jLong idx = (*indices)(0);
         std::map<Nd4jLong, std::vector<Nd4jLong>> idxs;//(indices->lengthOf());
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e)
-            idxs[static_cast<Nd4jLong>(indices->getScalar(e))].push_back(e);
+            idxs[(*indices)(e)].push_back(e);
 
         //std::sort(idxs.begin(), idxs.end());
 
@@ -369,7 +364,6 @@ namespace helpers {
         }
         else {
             std::vector<int> restDims(input->rankOf() - 1);
-            Nd4jLong idx = idxs[0][0];
 #pragma omp parallel for if(input->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int e = 1; e < input->rankOf(); e++)
                 restDims[e - 1] = e;
@@ -400,12 +394,12 @@ namespace helpers {
     }
 
     template <typename T>
-    void unsortedSegmentMinFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
+    void unsortedSegmentMinFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
         // if input is a vector: (as if in doc sample)
-        //int idx = static_cast<int>((*indices)(0.));
+        //Nd4jLong idx = (*indices)(0);
         std::map<Nd4jLong, std::vector<Nd4jLong>> idxs;//(indices->lengthOf());
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e)
-            idxs[static_cast<Nd4jLong>(indices->getScalar(e))].push_back(e);
+            idxs[(*indices)(e)].push_back(e);
 
         //std::sort(idxs.begin(), idxs.end());
 
@@ -423,7 +417,6 @@ namespace helpers {
         }
         else {
             std::vector<int> restDims(input->rankOf() - 1);
-            Nd4jLong idx = idxs[0][0];
 #pragma omp parallel for if(input->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int e = 1; e < input->rankOf(); e++)
                 restDims[e - 1] = e;
@@ -455,10 +448,10 @@ namespace helpers {
     }
 
     template <typename T>
-    void unsortedSegmentMeanFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
+    void unsortedSegmentMeanFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
         std::map<Nd4jLong, std::vector<Nd4jLong>> idxs;//(indices->lengthOf());
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e)
-            idxs[static_cast<Nd4jLong>(indices->getScalar(e))].push_back(e);
+            idxs[(*indices)(e)].push_back(e);
 
         //std::sort(idxs.begin(), idxs.end());
 
@@ -503,10 +496,10 @@ namespace helpers {
     }
 
     template <typename T>
-    void unsortedSegmentSumFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
+    void unsortedSegmentSumFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
         std::map<Nd4jLong, std::vector<Nd4jLong>> idxs;//(indices->lengthOf());
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e)
-            idxs[static_cast<Nd4jLong>(indices->getScalar(e))].push_back(e);
+            idxs[(*indices)(e)].push_back(e);
 
         //std::sort(idxs.begin(), idxs.end());
 
@@ -550,10 +543,10 @@ namespace helpers {
     }
 
     template <typename T>
-    void unsortedSegmentProdFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
+    void unsortedSegmentProdFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
         std::map<Nd4jLong, std::vector<Nd4jLong>> idxs;//(indices->lengthOf());
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e)
-            idxs[static_cast<Nd4jLong>(indices->getScalar(e))].push_back(e);
+            idxs[(*indices)(e)].push_back(e);
 
         //std::sort(idxs.begin(), idxs.end());
 
@@ -598,10 +591,10 @@ namespace helpers {
     }
 
     template <typename T>
-    void unsortedSegmentSqrtNFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
+    void unsortedSegmentSqrtNFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output) {
         std::map<Nd4jLong, std::vector<Nd4jLong>> idxs;//(indices->lengthOf());
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e)
-            idxs[static_cast<Nd4jLong>(indices->getScalar(e))].push_back(e);
+            idxs[(*indices)(e)].push_back(e);
 
         //std::sort(idxs.begin(), idxs.end());
 
@@ -645,33 +638,29 @@ namespace helpers {
         }
     }
 
-    template void unsortedSegmentMaxFunctor<float>(NDArray<float>* input, NDArray<float>* indices, Nd4jLong numOfClasses, NDArray<float>* output);
-    template void unsortedSegmentMaxFunctor<float16>(NDArray<float16>* input, NDArray<float16>* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template void unsortedSegmentMaxFunctor<double>(NDArray<double>* input, NDArray<double>* indices, Nd4jLong numOfClasses, NDArray<double>* output);
-
-    template void unsortedSegmentMinFunctor<float>(NDArray<float>* input, NDArray<float>* indices, Nd4jLong numOfClasses, NDArray<float>* output);
-    template void unsortedSegmentMinFunctor<float16>(NDArray<float16>* input, NDArray<float16>* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template void unsortedSegmentMinFunctor<double>(NDArray<double>* input, NDArray<double>* indices, Nd4jLong numOfClasses, NDArray<double>* output);
+    template void unsortedSegmentMaxFunctor<float>(NDArray<float>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float>* output);
+    template void unsortedSegmentMaxFunctor<float16>(NDArray<float16>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template void unsortedSegmentMaxFunctor<double>(NDArray<double>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template void unsortedSegmentMeanFunctor<float>(NDArray<float>* input, NDArray<float>* indices, Nd4jLong numOfClasses, NDArray<float>* output);
-    template void unsortedSegmentMeanFunctor<float16>(NDArray<float16>* input, NDArray<float16>* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template void unsortedSegmentMeanFunctor<double>(NDArray<double>* input, NDArray<double>* indices, Nd4jLong numOfClasses, NDArray<double>* output);
+    template void unsortedSegmentMinFunctor<float>(NDArray<float>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float>* output);
+    template void unsortedSegmentMinFunctor<float16>(NDArray<float16>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template void unsortedSegmentMinFunctor<double>(NDArray<double>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template void unsortedSegmentSumFunctor<float>(NDArray<float>* input, NDArray<float>* indices, Nd4jLong numOfClasses, NDArray<float>* output);
-    template void unsortedSegmentSumFunctor<float16>(NDArray<float16>* input, NDArray<float16>* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template void unsortedSegmentSumFunctor<double>(NDArray<double>* input, NDArray<double>* indices, Nd4jLong numOfClasses, NDArray<double>* output);
+    template void unsortedSegmentMeanFunctor<float>(NDArray<float>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float>* output);
+    template void unsortedSegmentMeanFunctor<float16>(NDArray<float16>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template void unsortedSegmentMeanFunctor<double>(NDArray<double>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template void unsortedSegmentProdFunctor<float>(NDArray<float>* input, NDArray<float>* indices, Nd4jLong numOfClasses, NDArray<float>* output);
-    template void unsortedSegmentProdFunctor<float16>(NDArray<float16>* input, NDArray<float16>* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template void unsortedSegmentProdFunctor<double>(NDArray<double>* input, NDArray<double>* indices, Nd4jLong numOfClasses, NDArray<double>* output);
+    template void unsortedSegmentSumFunctor<float>(NDArray<float>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float>* output);
+    template void unsortedSegmentSumFunctor<float16>(NDArray<float16>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template void unsortedSegmentSumFunctor<double>(NDArray<double>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template void unsortedSegmentSqrtNFunctor<float>(NDArray<float>* input, NDArray<float>* indices, Nd4jLong numOfClasses, NDArray<float>* output);
-    template void unsortedSegmentSqrtNFunctor<float16>(NDArray<float16>* input, NDArray<float16>* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template void unsortedSegmentSqrtNFunctor<double>(NDArray<double>* input, NDArray<double>* indices, Nd4jLong numOfClasses, NDArray<double>* output);
+    template void unsortedSegmentProdFunctor<float>(NDArray<float>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float>* output);
+    template void unsortedSegmentProdFunctor<float16>(NDArray<float16>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template void unsortedSegmentProdFunctor<double>(NDArray<double>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template bool unsortedSegmentIndicesValidate(NDArray<float>* indices, Nd4jLong expected, Nd4jLong& output);
-    template bool unsortedSegmentIndicesValidate(NDArray<float16>* indices, Nd4jLong expected, Nd4jLong& output);
-    template bool unsortedSegmentIndicesValidate(NDArray<double>* indices, Nd4jLong expected, Nd4jLong& output);
+    template void unsortedSegmentSqrtNFunctor<float>(NDArray<float>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float>* output);
+    template void unsortedSegmentSqrtNFunctor<float16>(NDArray<float16>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template void unsortedSegmentSqrtNFunctor<double>(NDArray<double>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<double>* output);
 
     // -------------------------------------------------------------------------------------------------------------- //
     // Backpropagate ops helpers
@@ -681,7 +670,7 @@ namespace helpers {
     
     // segment max
     template <typename T>
-    int segmentMaxFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output) {
+    int segmentMaxFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output) {
         int numOfClasses = gradOut->sizeAt(0);
         // if input is a vector: (as if in doc sample)
         auto tempRes = gradOut->dup();
@@ -689,7 +678,7 @@ namespace helpers {
         if (input->isVector()) {
 #pragma omp parallel for if(input->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (Nd4jLong e = 0; e < input->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 if (nd4j::math::nd4j_abs(tempRes->getScalar(classNum) -(*input)(e)) < T(1.e-5))
                     (*output)(e) = (*gradOut)(classNum);
             }
@@ -711,7 +700,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -728,12 +717,12 @@ namespace helpers {
 
     // segmen min
     template <typename T>
-    int segmentMinFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output) {
+    int segmentMinFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output) {
         auto tempRes = gradOut->dup();
         segmentMinFunctor(input, indices, tempRes);
         if (input->isVector()) {
             for (Nd4jLong e = 0; e < input->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 if (nd4j::math::nd4j_abs(tempRes->getScalar(classNum) -(*input)(e)) < T(1.e-5))
                     (*output)(e) = (*gradOut)(classNum);
             }
@@ -755,7 +744,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -771,7 +760,7 @@ namespace helpers {
 
     // segmen mean
     template <typename T>
-    int segmentMeanFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output) {
+    int segmentMeanFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output) {
         int numClasses = output->sizeAt(0);
         std::map<Nd4jLong, Nd4jLong> classCount;//(numClasses);
 
@@ -780,13 +769,13 @@ namespace helpers {
         }
 
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-            classCount[static_cast<Nd4jLong>(indices->getScalar(e))] ++;
+            classCount[(*indices)(e)] ++;
         }
 
         // if input is a vector: (as if in doc sample)
         if (input->isVector()) {
             for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 (*output)(e) = (*gradOut)(classNum) / T(classCount[classNum]);
             }
         }
@@ -806,7 +795,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -820,13 +809,13 @@ namespace helpers {
     }
 
     template <typename T>
-    int segmentSumFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output) {
+    int segmentSumFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output) {
         int numClasses = output->sizeAt(0);
         // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0.));
+        Nd4jLong idx = (*indices)(0);
         if (input->isVector()) {
             for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 (*output)(e) = (*gradOut)(classNum);
             }
         }
@@ -843,7 +832,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -856,12 +845,12 @@ namespace helpers {
     }
 
     template <typename T>
-    int segmentProdFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output) {
+    int segmentProdFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output) {
         auto tempRes = gradOut->dup();
         segmentProdFunctor(input, indices, tempRes);
         if (input->isVector()) {
             for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 (*output)(e) = (*gradOut)(classNum) * (*tempRes)(classNum)/ (*input)(e);
             }
         }
@@ -882,7 +871,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -896,32 +885,32 @@ namespace helpers {
         return ND4J_STATUS_OK;
     }
 
-    template int segmentMaxFunctorBP<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* gradOut, NDArray<float>* output);
-    template int segmentMaxFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, NDArray<float16>* output);
-    template int segmentMaxFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, NDArray<double>* output);
+    template int segmentMaxFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, NDArray<float>* output);
+    template int segmentMaxFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, NDArray<float16>* output);
+    template int segmentMaxFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, NDArray<double>* output);
 
-    template int segmentMinFunctorBP<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* gradOut, NDArray<float>* output);
-    template int segmentMinFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, NDArray<float16>* output);
-    template int segmentMinFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, NDArray<double>* output);
+    template int segmentMinFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, NDArray<float>* output);
+    template int segmentMinFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, NDArray<float16>* output);
+    template int segmentMinFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, NDArray<double>* output);
 
-    template int segmentMeanFunctorBP<float>(NDArray<float>* input, NDArray<float>* , NDArray<float>* gradOut, NDArray<float>* output);
-    template int segmentMeanFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, NDArray<float16>* output);
-    template int segmentMeanFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, NDArray<double>* output);
+    template int segmentMeanFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, NDArray<float>* output);
+    template int segmentMeanFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, NDArray<float16>* output);
+    template int segmentMeanFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, NDArray<double>* output);
 
-    template int segmentSumFunctorBP<float>(NDArray<float>* input, NDArray<float>* , NDArray<float>* gradOut, NDArray<float>* output);
-    template int segmentSumFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* gradOut, NDArray<float16>* output);
-    template int segmentSumFunctorBP<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* gradOut, NDArray<double>* output);
+    template int segmentSumFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, NDArray<float>* output);
+    template int segmentSumFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, NDArray<float16>* output);
+    template int segmentSumFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, NDArray<double>* output);
 
-    template int segmentProdFunctorBP<float>(NDArray<float>* input, NDArray<float>* , NDArray<float>* gradOut, NDArray<float>* output);
-    template int segmentProdFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* , NDArray<float16>* gradOut, NDArray<float16>* output);
-    template int segmentProdFunctorBP<double>(NDArray<double>* input, NDArray<double>* , NDArray<double>* gradOut, NDArray<double>* output);
+    template int segmentProdFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, NDArray<float>* output);
+    template int segmentProdFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, NDArray<float16>* output);
+    template int segmentProdFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, NDArray<double>* output);
 
     // -------------------------------------------------------------------------------------------------------------- //
     // Unsorted backpropagate segment ops
     // -------------------------------------------------------------------------------------------------------------- //
 
     template <typename T>
-    int unsortedSegmentMaxFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
+    int unsortedSegmentMaxFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
 //        int numOfClasses = gradOut->sizeAt(0);
         // if input is a vector: (as if in doc sample)
         auto tempRes = gradOut->dup();
@@ -929,7 +918,7 @@ namespace helpers {
         if (input->isVector()) {
 #pragma omp parallel for if(input->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (Nd4jLong e = 0; e < input->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 if (nd4j::math::nd4j_abs(tempRes->getScalar(classNum) -(*input)(e)) < T(1.e-5))
                     (*output)(e) = (*gradOut)(classNum);
             }
@@ -951,7 +940,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -966,13 +955,13 @@ namespace helpers {
     }
 
     template <typename T>
-    int unsortedSegmentMinFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
+    int unsortedSegmentMinFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
         auto tempRes = gradOut->dup();
         unsortedSegmentMinFunctor(input, indices, numOfClasses, tempRes);
         if (input->isVector()) {
 #pragma omp parallel for if(input->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (Nd4jLong e = 0; e < input->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 if (nd4j::math::nd4j_abs(tempRes->getScalar(classNum) -(*input)(e)) < T(1.e-5))
                     (*output)(e) = (*gradOut)(classNum);
             }
@@ -994,7 +983,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -1010,7 +999,7 @@ namespace helpers {
     }
 
     template <typename T>
-    int unsortedSegmentMeanFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
+    int unsortedSegmentMeanFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
 
         std::map<Nd4jLong, Nd4jLong> classCount;//(numClasses);
 
@@ -1021,14 +1010,14 @@ namespace helpers {
 
 //#pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-            classCount[static_cast<Nd4jLong>(indices->getScalar(e))] ++;
+            classCount[(*indices)(e)] ++;
         }
 
         // if input is a vector: (as if in doc sample)
         if (input->isVector()) {
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 (*output)(e) = (*gradOut)(classNum) / T(classCount[classNum]);
             }
         }
@@ -1048,7 +1037,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -1061,13 +1050,13 @@ namespace helpers {
     }
 
     template <typename T>
-    int unsortedSegmentSumFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
+    int unsortedSegmentSumFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
 
         // if input is a vector: (as if in doc sample)
-        int idx = static_cast<int>((*indices)(0.));
+        Nd4jLong idx = (*indices)(0);
         if (input->isVector()) {
             for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 (*output)(e) = (*gradOut)(classNum);
             }
         }
@@ -1084,7 +1073,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -1098,14 +1087,14 @@ namespace helpers {
     }
 
     template <typename T>
-    int unsortedSegmentProdFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
+    int unsortedSegmentProdFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
         auto tempRes = gradOut->dup();
 
         unsortedSegmentProdFunctor(input, indices, numOfClasses, tempRes);
         if (input->isVector()) {
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 (*output)(e) = (*gradOut)(classNum) * (*tempRes)(classNum)/ (*input)(e);
             }
         }
@@ -1126,7 +1115,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -1142,7 +1131,7 @@ namespace helpers {
     }
 
     template <typename T>
-    int unsortedSegmentSqrtNFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
+    int unsortedSegmentSqrtNFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output) {
         std::map<Nd4jLong, Nd4jLong> classCount;//(numClasses);
 
 //#pragma omp parallel for if(numOfClasses > Environment::getInstance()->elementwiseThreshold()) schedule(static)
@@ -1152,14 +1141,14 @@ namespace helpers {
 
 //#pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
         for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-            classCount[static_cast<Nd4jLong>(indices->getScalar(e))] ++;
+            classCount[(*indices)(e)] ++;
         }
 
         // if input is a vector: (as if in doc sample)
         if (input->isVector()) {
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (Nd4jLong e = 0; e < indices->lengthOf(); ++e) {
-                Nd4jLong classNum = static_cast<Nd4jLong>(indices->getScalar(e));
+                Nd4jLong classNum = (*indices)(e);
                 (*output)(e) = (*gradOut)(classNum) / nd4j::math::nd4j_sqrt(T(classCount[classNum]));
             }
         }
@@ -1179,7 +1168,7 @@ namespace helpers {
             int pos = 0;
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
             for (int i = 0; i < indices->lengthOf(); i++) {
-                Nd4jLong classNum = static_cast<Nd4jLong>((*indices)(i));
+                Nd4jLong classNum = (*indices)(i);
                 NDArray<T>* current = listOfTensors->at(i);
                 NDArray<T>* currentOut = listOfOutTensors->at(i);
                 NDArray<T>* currentGradOut = listOfGradOuts->at(classNum);
@@ -1192,29 +1181,29 @@ namespace helpers {
         return ND4J_STATUS_OK;
     }
 
-    template int unsortedSegmentMaxFunctorBP<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
-    template int unsortedSegmentMaxFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template int unsortedSegmentMaxFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
+    template int unsortedSegmentMaxFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
+    template int unsortedSegmentMaxFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template int unsortedSegmentMaxFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template int unsortedSegmentMinFunctorBP<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
-    template int unsortedSegmentMinFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template int unsortedSegmentMinFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
+    template int unsortedSegmentMinFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
+    template int unsortedSegmentMinFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template int unsortedSegmentMinFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template int unsortedSegmentMeanFunctorBP<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
-    template int unsortedSegmentMeanFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template int unsortedSegmentMeanFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
+    template int unsortedSegmentMeanFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
+    template int unsortedSegmentMeanFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template int unsortedSegmentMeanFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template int unsortedSegmentSumFunctorBP<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
-    template int unsortedSegmentSumFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template int unsortedSegmentSumFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
+    template int unsortedSegmentSumFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
+    template int unsortedSegmentSumFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template int unsortedSegmentSumFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template int unsortedSegmentProdFunctorBP<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
-    template int unsortedSegmentProdFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template int unsortedSegmentProdFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
+    template int unsortedSegmentProdFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
+    template int unsortedSegmentProdFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template int unsortedSegmentProdFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
 
-    template int unsortedSegmentSqrtNFunctorBP<float>(NDArray<float>* input, NDArray<float>* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
-    template int unsortedSegmentSqrtNFunctorBP<float16>(NDArray<float16>* input, NDArray<float16>* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
-    template int unsortedSegmentSqrtNFunctorBP<double>(NDArray<double>* input, NDArray<double>* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
+    template int unsortedSegmentSqrtNFunctorBP<float>(NDArray<float>* input, IndexArray* indices, NDArray<float>* gradOut, Nd4jLong numOfClasses, NDArray<float>* output);
+    template int unsortedSegmentSqrtNFunctorBP<float16>(NDArray<float16>* input, IndexArray* indices, NDArray<float16>* gradOut, Nd4jLong numOfClasses, NDArray<float16>* output);
+    template int unsortedSegmentSqrtNFunctorBP<double>(NDArray<double>* input, IndexArray* indices, NDArray<double>* gradOut, Nd4jLong numOfClasses, NDArray<double>* output);
 }
 }
 }
\ No newline at end of file
@@ -21,6 +21,8 @@
 //
 
 #include<ops/declarable/helpers/sru.h>
+#include <helpers/MmulHelper.h>
+#include <array/NDArrayExpression.h>
 
 namespace nd4j    {
 namespace ops     {
@@ -62,18 +64,18 @@ void sruCell(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArray<T
     NDArray<T> z = mmul(*x, *w);               //  [bS x 3*inSize]    
 
     // forget gate = sigmoid(x*Wf + bf)
-    NDArray<T> f = sigmoid<T>(z({0,0, inSize,   2*inSize}) + (*b)({0, inSize}));
+    NDArray<T> f = expr::evaluate(expr::sigmoid(expr::lazy(z({0,0, inSize,   2*inSize})) + (*b)({0, inSize})), 'c', x->getWorkspace());
     
     // reset gate = sigmoid(x*Wr + br)
-    NDArray<T> r = sigmoid<T>(z({0,0, 2*inSize, 3*inSize}) + (*b)({inSize, 2*inSize}));
+    NDArray<T> r = expr::evaluate(expr::sigmoid(expr::lazy(z({0,0, 2*inSize, 3*inSize})) + (*b)({inSize, 2*inSize})), 'c', x->getWorkspace());
 
     // ◦ means element-wise product or so called Hadamard product
     // current sell state = f◦c0 + (1 - f)◦(x*Wc)
-    c->assign( f*(*c0) + ((T)1. - f) * z({0,0 ,0, inSize}) );
+    c->assign( expr::lazy(f)*(*c0) + ((T)1. - expr::lazy(f)) * z({0,0 ,0, inSize}) );
     // *c = f*(*c0 - z({},{0, inSize})) + z({{},{0, inSize}});
 
     // current cell output = r◦activation(c) + (1 - r)◦x
-    h->assign( r*activation<T>(*c) + ((T)1. - r) * (*x) );    
+    h->assign( expr::lazy(r)*expr::tanh(expr::lazy(*c)) + ((T)1. - expr::lazy(r)) * (*x) );    
     // *h = r * (activation<T>(c) - *x) + *x;        
 }
 
@@ -163,21 +165,58 @@ void sruTimeLoop(const std::vector<NDArray<T>*>& inArrs, const std::vector<NDArr
 
     w = w->transpose();                             // [3*inSize x inSize] -> [inSize x 3*inSize] 
 
-    const int time  = x->sizeAt(2);
+    const int bS     = x->sizeAt(0);
+    const int inSize = x->sizeAt(1);
+    const int time   = x->sizeAt(2);
+    const Nd4jLong tbS = (Nd4jLong) time * bS;
 
-    NDArray<T> ct_1(*c0);
+    auto workspace = x->getWorkspace();
 
-    // loop through time steps
-    for (int t = 0; t < time; ++t) {
+    // there is no recurrent matrix product in sru, so the whole sequence is projected by single gemm: [time*bS x inSize] * [inSize x 3*inSize]
+    NDArray<T>* xPermuted = x->permute({2, 0, 1});                  // [time x bS x inSize]
+    NDArray<T>* xSeq = xPermuted->dup('c');
+    NDArray<T> x2d(xSeq->getBuffer(), 'c', {tbS, inSize}, workspace);
+    NDArray<T> z('f', {tbS, 3*inSize}, workspace);
+    MmulHelper<T>::mmul(&x2d, w, &z);
 
-        NDArray<T> xt = (*x)({0,0, 0,0, t,t+1});
-        NDArray<T> ht = (*h)({0,0, 0,0, t,t+1});
-        NDArray<T> ct = (*c)({0,0, 0,0, t,t+1});
+    T* pz = z.getBuffer();
+    T* px = xSeq->getBuffer();
+    T* pb = b->getBuffer();
+    const Nd4jLong bStride = b->isScalar() ? 0 : shape::elementWiseStride(b->getShapeInfo());
+    const Nd4jLong* hStrides = h->stridesOf();
+    const Nd4jLong* cStrides = c->stridesOf();
 
-        helpers::sruCell<T>({&xt, &ct_1, w, b},  {&ht, &ct});        
-        ct_1.assign(ct);
-    }    
+    // each (batch, feature) pair is an independent recurrence over time
+#pragma omp parallel for schedule(static) if((Nd4jLong) bS * inSize > Environment::getInstance()->elementwiseThreshold()) collapse(2)
+    for (int e = 0; e < bS; ++e) {
+        for (int k = 0; k < inSize; ++k) {
 
+            const T bf = pb[k * bStride];
+            const T br = pb[(inSize + k) * bStride];
+            T ct_1 = (*c0)(e, k);
+
+            for (int t = 0; t < time; ++t) {
+
+                const Nd4jLong row = (Nd4jLong) t * bS + e;
+
+                // forget and reset gates
+                T f = nd4j::math::nd4j_sigmoid<T>(pz[(Nd4jLong) (inSize + k) * tbS + row] + bf);
+                T r = nd4j::math::nd4j_sigmoid<T>(pz[(Nd4jLong) (2*inSize + k) * tbS + row] + br);
+
+                // current cell state = f◦c0 + (1 - f)◦(x*Wc)
+                T ct = f * ct_1 + ((T)1. - f) * pz[(Nd4jLong) k * tbS + row];
+
+                // current cell output = r◦activation(c) + (1 - r)◦x
+                h->getBuffer()[e * hStrides[0] + k * hStrides[1] + t * hStrides[2]] = r * nd4j::math::nd4j_tanh<T>(ct) + ((T)1. - r) * px[row * inSize + k];
+                c->getBuffer()[e * cStrides[0] + k * cStrides[1] + t * cStrides[2]] = ct;
+
+                ct_1 = ct;
+            }
+        }
+    }
+
+    delete xSeq;
+    delete xPermuted;
     delete w;
 }
 
@@ -20,137 +20,161 @@
 
 #include <ops/declarable/helpers/top_k.h>
 #include <ops/declarable/headers/parity_ops.h>
+#include <algorithm>
 namespace nd4j {
 namespace ops {
 namespace helpers {
 
+    // ----------------------------------------------------------------------------------------------- //
+    // element a precedes element b in top k if it's greater, ties are resolved in favor of lower index.
+    // NaN is treated as greater than any number, otherwise there's no strict weak ordering
     template <typename T>
-    int topKFunctor(NDArray<T>* input, NDArray<T>* values, NDArray<T>* indeces, int k, bool needSort) {
-        int width = input->sizeAt(-1); // last dim of input
-        std::unique_ptr<ResultSet<T>> lastDimList(input->allTensorsAlongDimension({input->rankOf() - 1}));
+    static FORCEINLINE bool precedes(const T* row, const Nd4jLong ews, const int a, const int b) {
+        const T va = row[a * ews];
+        const T vb = row[b * ews];
 
-// ----------------------------------------------------------------------------------------------- //
-// this assumption is right:
-//        if (values->lengthOf() != k * lastDimList->size()) {
-//            nd4j_printf("top_k: something is wrong. %i expected, but %i given.\n",
-//                values->lengthOf(), k * lastDimList->size());
-//        }
-// ----------------------------------------------------------------------------------------------- //
+        const bool nanA = nd4j::math::nd4j_isnan<T>(va);
+        const bool nanB = nd4j::math::nd4j_isnan<T>(vb);
+        if (nanA || nanB)
+            return nanA && (!nanB || a < b);
+
+        return va > vb || (va == vb && a < b);
+    }
 
-            if (k == 1) {
-                int pos = 0;
-//#pragma omp parallel for if(lastDimList->size() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
-                for (size_t e = 0; e < lastDimList->size(); ++e) {
-                    int maxPos = lastDimList->at(e)->argMax();
-                    if (indeces)
-                        (*indeces)(e) = maxPos; //topIndex;
-                    if (values)
-                        (*values)(e) = (*lastDimList->at(e))(maxPos);
+    // ----------------------------------------------------------------------------------------------- //
+    // selects indices of k top elements of a single row, result is sorted either by value or by index
+    template <typename T>
+    static void selectTopK(const T* row, const Nd4jLong ews, const int width, const int k, bool needSort, std::vector<int>& top) {
+        auto comparator = [row, ews] (const int a, const int b) -> bool {
+            return precedes<T>(row, ews, a, b);
+        };
+
+        if (k * 8 >= width) {
+            // k is comparable to width: linear selection over all indices
+            top.resize(width);
+            for (int i = 0; i < width; ++i)
+                top[i] = i;
+
+            if (k < width)
+                std::nth_element(top.begin(), top.begin() + k - 1, top.end(), comparator);
+
+            top.resize(k);
+        } else {
+            // bounded heap, with the weakest of current top k on its top
+            top.resize(k);
+            for (int i = 0; i < k; ++i)
+                top[i] = i;
+
+            std::make_heap(top.begin(), top.end(), comparator);
+
+            for (int i = k; i < width; ++i) {
+                if (precedes<T>(row, ews, i, top.front())) {
+                    std::pop_heap(top.begin(), top.end(), comparator);
+                    top.back() = i;
+                    std::push_heap(top.begin(), top.end(), comparator);
                 }
             }
-            else { 
-                int nextPos = 0;
-
-//#pragma omp parallel for if(lastDimList->size() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
-                for (int e = 0; e < lastDimList->size(); ++e) {
-                    NDArray<T>* trial = lastDimList->at(e); // a vector to be search
-
-                    std::vector<int> topIndices(k);
-                    std::vector<T> topValues(k);
-
-                    // fill up the first k elements
-                    for (int pos = 0; pos < k; ++pos) {
-                        topIndices[pos] = pos;
-                        topValues[pos] = (*trial)(pos);
-                    }
-                    std::vector<T> sortedVals(topValues);
-                    std::sort(sortedVals.begin(), sortedVals.end()); // sorted in ascending order
-                    
-                    for (int i = k; i < width; ++i) {
-                        T val = (*trial)(i);
-                        if (sortedVals[0] < val) { // value should be inserted to top k
-                            // only if it is not contained in
-                            auto itPos = std::find(sortedVals.begin(), sortedVals.end(), val);
-                            if (sortedVals.end() == itPos) {
-                                //exchangePos - a distance between begin and minimal existed to be suppressed by val
-                                auto exchangePos = std::distance(topValues.begin(), std::find(topValues.begin(), topValues.end(), sortedVals[0]));
-                                topValues[exchangePos] = val; //*exchangeIt = val;
-                                topIndices[exchangePos] = i;
-                                sortedVals[0] = val; // suppress in sorted
-                                std::sort(sortedVals.begin(), sortedVals.end()); // sorted in ascending order
-                            }
-                        }
-                    }
-
-                    if (needSort) {
-                        std::sort(topValues.begin(), topValues.end(), [](T a, T b) {
-                            return a > b;   
-                        });
-
-                        for (int j = 0; j < width; j++)
-                            for (int pos = 0; pos < k; ++pos)
-                                if (topValues[pos] == (*trial)(j))
-                                    topIndices[pos] = j;
-                    }
-                    else { // else sort by indices
-
-                        std::vector<std::pair<int, T>> data(topValues.size());
-                        for (size_t e = 0; e < topValues.size(); ++e) {
-                            data[e].first = topIndices[e];
-                            data[e].second = topValues[e];
-                        }
-
-                        std::sort(data.begin(), data.end(), [](std::pair<int, T> const& a, std::pair<int, T> const& b) {
-                            return a.first < b.first;
-                        });
-
-                        for (size_t e = 0; e < topValues.size(); ++e) {
-                            topIndices[e] = data[e].first;
-                            topValues[e] = data[e].second;
-                        }
-
-                    }
-
-                    for (int pos = 0; pos < k; ++pos, ++nextPos) {
-                        if (values != nullptr)
-                            (*values)(nextPos) = topValues[pos];
-
-                        (*indeces)(nextPos) = topIndices[pos];
-                    }
+        }
+
+        if (needSort)
+            std::sort(top.begin(), top.end(), comparator);
+        else
+            std::sort(top.begin(), top.end());
+    }
+
+    // ----------------------------------------------------------------------------------------------- //
+    template <typename T>
+    int topKFunctor(NDArray<T>* input, NDArray<T>* values, NDArray<T>* indeces, int k, bool needSort) {
+        int width = input->sizeAt(-1); // last dim of input
+        std::unique_ptr<ResultSet<T>> lastDimList(input->allTensorsAlongDimension({input->rankOf() - 1}));
+        const int numRows = lastDimList->size();
+
+        if (k == 0)
+            return ND4J_STATUS_OK;
+
+        if (k == 1) {
+#pragma omp parallel for if(numRows > 1) schedule(guided)
+            for (int e = 0; e < numRows; ++e) {
+                int maxPos = lastDimList->at(e)->argMax();
+                if (indeces)
+                    (*indeces)(e) = maxPos; //topIndex;
+                if (values)
+                    (*values)(e) = (*lastDimList->at(e))(maxPos);
+            }
+        }
+        else {
+#pragma omp parallel for if(numRows > 1) schedule(guided)
+            for (int e = 0; e < numRows; ++e) {
+                NDArray<T>* trial = lastDimList->at(e); // a vector to be search
+
+                // strided rows are copied once, so selection works over plain buffer
+                NDArray<T>* copy = trial->ews() < 1 ? trial->dup('c') : nullptr;
+                const T* row = copy != nullptr ? copy->getBuffer() : trial->getBuffer();
+                const Nd4jLong ews = copy != nullptr ? 1 : trial->ews();
+
+                std::vector<int> top;
+                selectTopK<T>(row, ews, width, k, needSort, top);
+
+                for (int pos = 0; pos < k; ++pos) {
+                    const Nd4jLong nextPos = (Nd4jLong) e * k + pos;
+                    if (values != nullptr)
+                        (*values)(nextPos) = row[top[pos] * ews];
+
+                    if (indeces != nullptr)
+                        (*indeces)(nextPos) = (T) top[pos];
                 }
+
+                delete copy;
+            }
         }
+
         return ND4J_STATUS_OK;
     }
 // ----------------------------------------------------------------------------------------------- //
 
     template <typename T>
     int inTopKFunctor(NDArray<T>* input, NDArray<T>* target, NDArray<T>* result, int k) {
+        const int width = input->sizeAt(-1);
+        std::unique_ptr<ResultSet<T>> lastDimList(input->allTensorsAlongDimension({input->rankOf() - 1}));
+        const int numRows = lastDimList->size();
+
+        // same as TF: target is in top k if less than k elements are strictly greater than it, so ties with k-th value are in.
+        // if target or any other element of the row isn't finite, rows can't be ranked and result is false
+#pragma omp parallel for if(numRows > 1) schedule(guided)
+        for (int e = 0; e < numRows; ++e) {
+            NDArray<T>* trial = lastDimList->at(e);
+            const int t = (int) (*target)(e);
+
+            if (t < 0 || t >= width) {
+                (*result)(e) = (T) 0.f;
+                continue;
+            }
 
-            std::vector<Nd4jLong> shapeV(input->rankOf() + 1);
-            for (int i = 0; i < input->rankOf(); i++)
-                shapeV[i] = input->sizeAt(i);
-            shapeV[input->rankOf()] = k;
-            std::unique_ptr<NDArray<T>> indices( new NDArray<T>(input->ordering(), shapeV));
-            NDArray<T>* values = nullptr;
-            int status = topKFunctor(input, values, indices.get(), k, true);
-
-            if (status == ND4J_STATUS_OK) {
-#pragma omp parallel for if(target->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
-                for (int e = 0; e < target->lengthOf(); e++) {
-                    bool found = false;
-                    for (int j = 0; j < k; j++) {
-                        if ((*target)(e) == (*indices)(e * k + j)) {
-                            found = true;
-                            break;
-                        }
-                    }
-                    if (found)
-                        (*result)(e) = (T)1.f;
-                }
+            NDArray<T>* copy = trial->ews() < 1 ? trial->dup('c') : nullptr;
+            const T* row = copy != nullptr ? copy->getBuffer() : trial->getBuffer();
+            const Nd4jLong ews = copy != nullptr ? 1 : trial->ews();
+
+            const T value = row[t * ews];
+            bool ranked = nd4j::math::nd4j_isfin<T>(value);
+
+            // once k greater elements are found, result is false anyway
+            int greater = 0;
+            for (int i = 0; i < width && ranked && greater < k; ++i) {
+                const T v = row[i * ews];
+                if (!nd4j::math::nd4j_isfin<T>(v))
+                    ranked = false;
+                else if (v > value)
+                    greater++;
             }
-            return status; 
 
+            (*result)(e) = ranked && greater < k ? (T) 1.f : (T) 0.f;
+
+            delete copy;
+        }
+
+        return ND4J_STATUS_OK;
     }
+
     template int topKFunctor<float>(NDArray<float>* input, NDArray<float>* values, NDArray<float>* indeces, int k, bool needSort);
     template int topKFunctor<float16>(NDArray<float16>* input, NDArray<float16>* values, NDArray<float16>* indeces, int k, bool needSort);
     template int topKFunctor<double>(NDArray<double>* input, NDArray<double>* values, NDArray<double>* indeces, int k, bool needSort);
@@ -541,7 +541,7 @@ void gatherND(NDArray<T>& input, NDArray<T>& indices, NDArray<T>& output) {
 
 ////////////////////////////////////////////////////////////////////////
 template<typename T>
-void gather(NDArray<T>* input, const NDArray<T>* indices, NDArray<T>* output, const std::vector<int>& intArgs) {
+void gather(NDArray<T>* input, const IndexArray* indices, NDArray<T>* output, const std::vector<int>& intArgs) {
 
     int axis = intArgs.size() > 0 ? intArgs[0] : 0;
     const int inputRank = input->rankOf();
@@ -552,9 +552,8 @@ void gather(NDArray<T>* input, const NDArray<T>* indices, NDArray<T>* output, co
 
     if (indices != nullptr) {        
 
-        for(int i = 0; i < indices->lengthOf(); ++i)
-            if((int)(*indices)(i) >= input->sizeAt(axis))
-                throw std::runtime_error("helpers::gather function: indices array contains wrong elements, each element must be smaller than corresponding dimension of input array !");
+        if(!indices->isInRange(0, input->sizeAt(axis)))
+            throw std::runtime_error("helpers::gather function: indices array contains wrong elements, each element must be smaller than corresponding dimension of input array !");
     
         // first case: indices consist of only one scalar
         if(indices->isScalar()) {
@@ -562,13 +561,13 @@ void gather(NDArray<T>* input, const NDArray<T>* indices, NDArray<T>* output, co
             shape::TAD tad(input->getShapeInfo(), dimensions.data(), dimensions.size());
             tad.createTadOnlyShapeInfo();
             tad.createOffsets();
-            NDArray<T> tadArr(input->getBuffer() + tad.tadOffsets[(int)(*indices)(0.)], tad.tadOnlyShapeInfo);
+            NDArray<T> tadArr(input->getBuffer() + tad.tadOffsets[(*indices)(0)], tad.tadOnlyShapeInfo);
             output->assign(&tadArr);
         }
         else if (input->rankOf() == 1 && indices->isVector()) {
             // special case
 #pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(guided)     
-            for (int e = 0; e < indices->lengthOf(); e++)
+            for (Nd4jLong e = 0; e < indices->lengthOf(); e++)
                 (*output)(e) = (*input)((*indices)(e));
         }
         // second case: indices is vector
@@ -577,7 +576,7 @@ void gather(NDArray<T>* input, const NDArray<T>* indices, NDArray<T>* output, co
             ResultSet<T>* listIn  = input->allTensorsAlongDimension(ShapeUtils<T>::evalDimsToExclude(input->rankOf(),  {axis}));
 #pragma omp parallel for if(listOut->size() > Environment::getInstance()->elementwiseThreshold()) schedule(guided)             
             for(int i = 0; i < listOut->size(); ++i)
-                listOut->at(i)->assign(listIn->at((int)(*indices)(i)));
+                listOut->at(i)->assign(listIn->at((*indices)(i)));
             delete listOut;
             delete listIn;
         }
@@ -591,7 +590,7 @@ void gather(NDArray<T>* input, const NDArray<T>* indices, NDArray<T>* output, co
             ResultSet<T>* listIn = input->allTensorsAlongDimension(temp2 );
 #pragma omp parallel for if(listOut->size() > Environment::getInstance()->elementwiseThreshold()) schedule(guided)
             for(int i = 0; i < listOut->size(); ++i)
-                listOut->at(i)->assign(listIn->at((int)(*indices)(i)));
+                listOut->at(i)->assign(listIn->at((*indices)(i)));
             delete listOut;
             delete listIn;
         }
@@ -1161,9 +1160,9 @@ template void gatherND<float>(NDArray<float>& input, NDArray<float>& indices, ND
 template void gatherND<float16>(NDArray<float16>& input, NDArray<float16>& indices, NDArray<float16>& output);
 template void gatherND<double>(NDArray<double>& input, NDArray<double>& indices, NDArray<double>& output);
 
-template void gather<float>(NDArray<float>* input, const NDArray<float>* indices, NDArray<float>* output, const std::vector<int>& intArgs);
-template void gather<float16>(NDArray<float16>* input, const NDArray<float16>* indices, NDArray<float16>* output, const std::vector<int>& intArgs);
-template void gather<double>(NDArray<double>* input, const NDArray<double>* indices, NDArray<double>* output, const std::vector<int>& intArgs);
+template void gather<float>(NDArray<float>* input, const IndexArray* indices, NDArray<float>* output, const std::vector<int>& intArgs);
+template void gather<float16>(NDArray<float16>* input, const IndexArray* indices, NDArray<float16>* output, const std::vector<int>& intArgs);
+template void gather<double>(NDArray<double>* input, const IndexArray* indices, NDArray<double>* output, const std::vector<int>& intArgs);
 
 template void eye<float>(NDArray<float>& output);
 template void eye<float16>(NDArray<float16>& output);
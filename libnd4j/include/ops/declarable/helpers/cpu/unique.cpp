@@ -19,25 +19,214 @@
 //
 
 #include <ops/declarable/helpers/unique.h>
+#include <algorithm>
+#include <cstring>
+#include <omp.h>
 
 namespace nd4j {
 namespace ops {
 namespace helpers {
 
+    // inputs shorter than this are always processed by single thread
+    static const Nd4jLong PARALLEL_UNIQUE_THRESHOLD = 1L << 18;
+
+    // ----------------------------------------------------------------------------------------------- //
+    // all NaNs are considered equal, as well as -0 and +0
     template <typename T>
-    int uniqueCount(NDArray<T>* input) {
-        int count = 0;
+    static FORCEINLINE bool sameValue(const T a, const T b) {
+        return a == b || (a != a && b != b);
+    }
+
+    template <typename T>
+    static FORCEINLINE uint64_t hashOf(T value) {
+        if (value != value)
+            return 0x9e3779b97f4a7c15ULL;
+
+        if (value == (T) 0.f)
+            value = (T) 0.f;
+
+        uint64_t bits = 0;
+        memcpy(&bits, &value, sizeof(T));
+
+        // murmur3 finalizer
+        bits ^= bits >> 33;
+        bits *= 0xff51afd7ed558ccdULL;
+        bits ^= bits >> 33;
+        bits *= 0xc4ceb9fe1a85ec53ULL;
+        bits ^= bits >> 33;
+
+        return bits;
+    }
+
+    // ----------------------------------------------------------------------------------------------- //
+    // open addressing hash table, unique values are numbered in order of first occurrence
+    template <typename T>
+    class UniqueTable {
+    private:
+        std::vector<int> _slots;
+        uint64_t _mask;
+
+        void grow() {
+            std::vector<int> slots(_slots.size() * 2, -1);
+            uint64_t mask = slots.size() - 1;
+
+            for (int ordinal = 0; ordinal < (int) values.size(); ordinal++) {
+                uint64_t pos = hashOf<T>(values[ordinal]) & mask;
+                while (slots[pos] >= 0)
+                    pos = (pos + 1) & mask;
+
+                slots[pos] = ordinal;
+            }
+
+            _slots.swap(slots);
+            _mask = mask;
+        }
 
+    public:
         std::vector<T> values;
+        std::vector<Nd4jLong> firsts;
+        std::vector<Nd4jLong> counts;
 
-        for (int e = 0; e < input->lengthOf(); e++) {
-            T v = (*input)(e);
-            if (std::find(values.begin(), values.end(), v) == values.end()) {
-                values.push_back(v);
-                count++;
+        explicit UniqueTable(Nd4jLong expected) {
+            uint64_t capacity = 16;
+            while (capacity < (uint64_t) expected * 2)
+                capacity <<= 1;
+
+            _slots.resize(capacity, -1);
+            _mask = capacity - 1;
+        }
+
+        int insert(const T value, const uint64_t hash, const Nd4jLong position) {
+            uint64_t pos = hash & _mask;
+            while (_slots[pos] >= 0) {
+                int ordinal = _slots[pos];
+                if (sameValue<T>(values[ordinal], value)) {
+                    counts[ordinal]++;
+                    return ordinal;
+                }
+
+                pos = (pos + 1) & _mask;
             }
+
+            int ordinal = (int) values.size();
+            _slots[pos] = ordinal;
+            values.emplace_back(value);
+            firsts.emplace_back(position);
+            counts.emplace_back(1);
+
+            // load factor is kept below 1/2
+            if (values.size() * 2 > _slots.size())
+                grow();
+
+            return ordinal;
         }
-        return count;
+
+        int find(const T value, const uint64_t hash) const {
+            uint64_t pos = hash & _mask;
+            while (_slots[pos] >= 0) {
+                int ordinal = _slots[pos];
+                if (sameValue<T>(values[ordinal], value))
+                    return ordinal;
+
+                pos = (pos + 1) & _mask;
+            }
+
+            return -1;
+        }
+    };
+
+    // ----------------------------------------------------------------------------------------------- //
+    // finds unique values of buffer in order of first occurrence, their counts, and optionally ordinal of each element
+    template <typename T>
+    static void buildUnique(const T* buffer, const Nd4jLong ews, const Nd4jLong length, std::vector<T>& values, std::vector<Nd4jLong>& counts, std::vector<int>* ordinals) {
+        const int numPartitions = length < PARALLEL_UNIQUE_THRESHOLD ? 1 : omp_get_max_threads();
+
+        if (numPartitions < 2) {
+            UniqueTable<T> table(length < 1024 ? length : 1024);
+
+            for (Nd4jLong e = 0; e < length; e++) {
+                const T v = buffer[e * ews];
+                int ordinal = table.insert(v, hashOf<T>(v), e);
+
+                if (ordinals != nullptr)
+                    (*ordinals)[e] = ordinal;
+            }
+
+            values.swap(table.values);
+            counts.swap(table.counts);
+            return;
+        }
+
+        // partitioned build: every thread owns values with its own hash range, and keeps first occurrence of each
+        std::vector<uint64_t> hashes(length);
+
+#pragma omp parallel for schedule(static)
+        for (Nd4jLong e = 0; e < length; e++)
+            hashes[e] = hashOf<T>(buffer[e * ews]);
+
+        std::vector<UniqueTable<T>*> tables(numPartitions);
+
+#pragma omp parallel for num_threads(numPartitions) schedule(static, 1)
+        for (int p = 0; p < numPartitions; p++) {
+            auto table = new UniqueTable<T>(1024);
+
+            for (Nd4jLong e = 0; e < length; e++)
+                if ((hashes[e] >> 32) % numPartitions == p)
+                    table->insert(buffer[e * ews], hashes[e], e);
+
+            tables[p] = table;
+        }
+
+        // global order is restored from positions of first occurrences
+        std::vector<std::pair<Nd4jLong, std::pair<int, int>>> firsts;
+        for (int p = 0; p < numPartitions; p++)
+            for (int ordinal = 0; ordinal < (int) tables[p]->values.size(); ordinal++)
+                firsts.emplace_back(std::make_pair(tables[p]->firsts[ordinal], std::make_pair(p, ordinal)));
+
+        std::sort(firsts.begin(), firsts.end());
+
+        std::vector<std::vector<int>> remap(numPartitions);
+        for (int p = 0; p < numPartitions; p++)
+            remap[p].resize(tables[p]->values.size());
+
+        values.resize(firsts.size());
+        counts.resize(firsts.size());
+        for (int e = 0; e < (int) firsts.size(); e++) {
+            auto p = firsts[e].second.first;
+            auto ordinal = firsts[e].second.second;
+
+            remap[p][ordinal] = e;
+            values[e] = tables[p]->values[ordinal];
+            counts[e] = tables[p]->counts[ordinal];
+        }
+
+        if (ordinals != nullptr) {
+#pragma omp parallel for schedule(static)
+            for (Nd4jLong e = 0; e < length; e++) {
+                int p = (hashes[e] >> 32) % numPartitions;
+                (*ordinals)[e] = remap[p][tables[p]->find(buffer[e * ews], hashes[e])];
+            }
+        }
+
+        for (auto table: tables)
+            delete table;
+    }
+
+    // ----------------------------------------------------------------------------------------------- //
+    template <typename T>
+    int uniqueCount(NDArray<T>* input) {
+        // strided input is copied once, so hashing works over plain buffer
+        NDArray<T>* copy = input->ews() < 1 ? input->dup(input->ordering()) : nullptr;
+        const T* buffer = copy != nullptr ? copy->getBuffer() : input->getBuffer();
+        const Nd4jLong ews = copy != nullptr ? 1 : input->ews();
+
+        std::vector<T> values;
+        std::vector<Nd4jLong> counts;
+        buildUnique<T>(buffer, ews, input->lengthOf(), values, counts, nullptr);
+
+        delete copy;
+
+        return (int) values.size();
     }
 
     template int uniqueCount(NDArray<float>* input);
@@ -47,34 +236,30 @@ namespace helpers {
 
     template <typename T>
     int uniqueFunctor(NDArray<T>* input, NDArray<T>* values, NDArray<T>* indices, NDArray<T>* counts) { 
-    
+        NDArray<T>* copy = input->ews() < 1 ? input->dup(input->ordering()) : nullptr;
+        const T* buffer = copy != nullptr ? copy->getBuffer() : input->getBuffer();
+        const Nd4jLong ews = copy != nullptr ? 1 : input->ews();
+        const Nd4jLong length = input->lengthOf();
+
         std::vector<T> valuesVector;
-        std::map<T, int> indicesMap;
-        std::map<T, int> countsMap;
-
-        for (int e = 0; e < input->lengthOf(); e++) {
-            T v = (*input)(e);
-            if (std::find(valuesVector.begin(), valuesVector.end(), v) == valuesVector.end()) {
-                valuesVector.push_back(v);
-                indicesMap[v] = e;
-                countsMap[v] = 1;
-            }
-            else {
-                countsMap[v]++;
-            }
-        }
+        std::vector<Nd4jLong> countsVector;
+        std::vector<int> ordinals(indices != nullptr ? length : 0);
+
+        buildUnique<T>(buffer, ews, length, valuesVector, countsVector, indices != nullptr ? &ordinals : nullptr);
+
+        delete copy;
 
 #pragma omp parallel for if(values->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
         for (int e = 0; e < values->lengthOf(); e++) {
             (*values)(e) = valuesVector[e];
             if (counts != nullptr) 
-                (*counts)(e) = countsMap[valuesVector[e]];
+                (*counts)(e) = (T) countsVector[e];
         }
 
-//#pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
-        for (int e = 0; e < indices->lengthOf(); e++) {
-            auto posI = std::find(valuesVector.begin(), valuesVector.end(), (*input)(e));
-            (*indices)(e) = std::distance(valuesVector.begin(), posI);//indicesMap[(*input)(e)];
+        if (indices != nullptr) {
+#pragma omp parallel for if(indices->lengthOf() > Environment::getInstance()->elementwiseThreshold()) schedule(static)
+            for (Nd4jLong e = 0; e < indices->lengthOf(); e++)
+                (*indices)(e) = (T) ordinals[e];
         }
 
         return ND4J_STATUS_OK;
@@ -34,6 +34,11 @@ namespace helpers {
 	template <typename T>
 	void rnnTimeLoop(const std::vector<NDArray<T>*>& inArrs, NDArray<T>* h, NDArray<T>* hFinal);	    
 
+	// returns c-contiguous [time*bS x inSize] matrix over x [time x bS x inSize], duplicating x into copy only if it isn't contiguous
+	// shared by rnn, lstm and gru time loops, caller deletes both returned matrix and copy
+	template <typename T>
+	NDArray<T>* sequenceAsMatrix(NDArray<T>* x, NDArray<T>*& copy);
+
 }
 }
 }
@@ -23,81 +23,81 @@
 #define __SEGMENT_HELPERS__
 #include <op_boilerplate.h>
 #include <NDArray.h>
+#include <array/IndexArray.h>
 
 namespace nd4j {
 namespace ops {
 namespace helpers {
 
-    template <typename T>
-    bool segmentIndicesValidate(NDArray<T>* indices, Nd4jLong& expected, Nd4jLong& output);
-    template <typename T>
-    bool unsortedSegmentIndicesValidate(NDArray<T>* indices, Nd4jLong numOfClasses, Nd4jLong& output);
+    // segment ids are read as exact integers, see IndexArray
+    bool segmentIndicesValidate(IndexArray* indices, Nd4jLong& expected, Nd4jLong& output);
+    bool unsortedSegmentIndicesValidate(IndexArray* indices, Nd4jLong numOfClasses, Nd4jLong& output);
 
     template <typename T>
-    void segmentMaxFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output);
+    void segmentMaxFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output);
 
     template <typename T>
-    void segmentMinFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output);
+    void segmentMinFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output);
 
     template <typename T>
-    void segmentMeanFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output);
+    void segmentMeanFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output);
 
     template <typename T>
-    void segmentSumFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output);
+    void segmentSumFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output);
 
     template <typename T>
-    void segmentProdFunctor(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* output);
+    void segmentProdFunctor(NDArray<T>* input, IndexArray* indices, NDArray<T>* output);
 
     template <typename T>
-    void unsortedSegmentSqrtNFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output);
+    void unsortedSegmentSqrtNFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    void unsortedSegmentMaxFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output);
+    void unsortedSegmentMaxFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    void unsortedSegmentMinFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output);
+    void unsortedSegmentMinFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    void unsortedSegmentMeanFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output);
+    void unsortedSegmentMeanFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    void unsortedSegmentSumFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output);
+    void unsortedSegmentSumFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    void unsortedSegmentProdFunctor(NDArray<T>* input, NDArray<T>* indices, Nd4jLong numOfClasses, NDArray<T>* output);
+    void unsortedSegmentProdFunctor(NDArray<T>* input, IndexArray* indices, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    int segmentMaxFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output);
+    int segmentMaxFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output);
 
     template <typename T>
-    int segmentMinFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output);
+    int segmentMinFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output);
 
     template <typename T>
-    int segmentMeanFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output);
+    int segmentMeanFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output);
 
     template <typename T>
-    int segmentSumFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output);
+    int segmentSumFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output);
 
     template <typename T>
-    int segmentProdFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, NDArray<T>* output);
+    int segmentProdFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, NDArray<T>* output);
 
     template <typename T>
-    int unsortedSegmentSqrtNFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
+    int unsortedSegmentSqrtNFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    int unsortedSegmentMaxFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
+    int unsortedSegmentMaxFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    int unsortedSegmentMinFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
+    int unsortedSegmentMinFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    int unsortedSegmentMeanFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
+    int unsortedSegmentMeanFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    int unsortedSegmentSumFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
+    int unsortedSegmentSumFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
 
     template <typename T>
-    int unsortedSegmentProdFunctorBP(NDArray<T>* input, NDArray<T>* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
+    int unsortedSegmentProdFunctorBP(NDArray<T>* input, IndexArray* indices, NDArray<T>* gradOut, Nd4jLong numOfClasses, NDArray<T>* output);
 
 }
 }
@@ -22,6 +22,7 @@
 #define LIBND4J_TRANSFORMS_H
 
 #include <ops/declarable/helpers/helpers.h>
+#include <array/IndexArray.h>
 
 namespace nd4j    {
 namespace ops     {
@@ -53,7 +54,7 @@ namespace helpers {
 	void gatherND(NDArray<T>& input, NDArray<T>& indices, NDArray<T>& output);
 
 	template<typename T>
-	void gather(NDArray<T>* input, const NDArray<T>* indices, NDArray<T>* output, const std::vector<int>& intArgs);
+	void gather(NDArray<T>* input, const IndexArray* indices, NDArray<T>* output, const std::vector<int>& intArgs);
 
 	template<typename T>
 	void eye(NDArray<T>& output);
@@ -157,8 +157,8 @@ namespace nd4j {
 
                 int cntIn = 0;
                 // we build list of input shapes
-                for (auto p: *ctx.inputs()) {
-                    auto var = ctx.variable(p);
+                for (int e = 0; e < ctx.width(); e++) {
+                    auto var = ctx.inputVariable(e);
                     if (var->variableType() == VariableType::NDARRAY) {
                         NDArray<T> *array = var->getNDArray();
                         inSha.push_back(array->getShapeInfo());
@@ -202,7 +202,12 @@ namespace nd4j {
                         auto var = ctx.variable(pair);
                         auto shape = var->getNDArray()->shapeInfo();
 
-                        if (!shape::equalsSoft(out, shape)) {
+                        if (var->isPlanned() && !shape::equalsSoft(out, shape)) {
+                            // memory plan was built for other shapes, so this array just leaves arena
+                            auto outArr = new NDArray<T>(out, true, workspace);
+
+                            ctx.pushNDArrayToVariableSpace(pair, outArr);
+                        } else if (!shape::equalsSoft(out, shape)) {
                             auto eShape = ShapeUtils<T>::shapeAsString(out);
                             auto aShape = ShapeUtils<T>::shapeAsString(shape);
 
@@ -302,7 +307,9 @@ namespace nd4j {
             Nd4jLong prepTime, outerTime;
 
             Nd4jLong memoryBefore = block->workspace() == nullptr ? 0L : block->workspace()->getSpilledSize() + block->workspace()->getUsedSize();
-            if (Environment::getInstance()->isProfiling())
+            bool profiling = Environment::getInstance()->isProfiling();
+            bool tracing = profiling || Environment::getInstance()->isTracing();
+            if (tracing)
                 timeEnter = std::chrono::system_clock::now();
 
             // basic validation: ensure inputs are set
@@ -314,7 +321,7 @@ namespace nd4j {
             // this method will allocate output NDArrays for this op
             auto numOutputs = this->prepareOutputs(*block);
 
-            if (Environment::getInstance()->isProfiling()) {
+            if (tracing) {
                 timeStart = std::chrono::system_clock::now();
                 prepTime = std::chrono::duration_cast<std::chrono::nanoseconds>(timeStart - timeEnter).count();
             }
@@ -322,22 +329,28 @@ namespace nd4j {
             Nd4jStatus status = this->validateAndExecute(*block);
 
             // optionally saving execution time
-            if (Environment::getInstance()->isProfiling()) {
+            if (tracing) {
                 timeEnd = std::chrono::system_clock::now();
                 outerTime = std::chrono::duration_cast<std::chrono::nanoseconds>(timeEnd - timeStart).count();
                 block->setInnerTime(outerTime);
             }
 
-            if (Environment::getInstance()->isProfiling()) {
+            if (tracing) {
                 auto fp = block->getVariableSpace()->flowPath();
                 if (fp != nullptr) {
                     auto p = fp->profile();
                     if (p != nullptr) {
-                        Nd4jLong memoryAfter = block->workspace() == nullptr ? 0L : block->workspace()->getSpilledSize() + block->workspace()->getUsedSize();
-                        Nd4jLong memoryUsed = memoryAfter - memoryBefore;
-                        p->nodeById(block->nodeId())->setPreparationTime(prepTime);
-                        p->nodeById(block->nodeId())->setExecutionTime(outerTime);
-                        p->nodeById(block->nodeId())->setTotalSize(memoryUsed);
+                        if (profiling) {
+                            Nd4jLong memoryAfter = block->workspace() == nullptr ? 0L : block->workspace()->getSpilledSize() + block->workspace()->getUsedSize();
+                            Nd4jLong memoryUsed = memoryAfter - memoryBefore;
+                            p->nodeById(block->nodeId())->setPreparationTime(prepTime);
+                            p->nodeById(block->nodeId())->setExecutionTime(outerTime);
+                            p->nodeById(block->nodeId())->setTotalSize(memoryUsed);
+                        }
+
+                        auto enterTime = (Nd4jLong) std::chrono::duration_cast<std::chrono::nanoseconds>(timeEnter.time_since_epoch()).count();
+                        p->traceNode(block->nodeId(), TracePhase_PREPARATION, enterTime, prepTime);
+                        p->traceNode(block->nodeId(), TracePhase_EXECUTION, enterTime + prepTime, outerTime);
                     }
                 }
             }
@@ -438,8 +451,8 @@ namespace nd4j {
             if (block.width() == 0)
                 return ND4J_STATUS_OK;
 
-            for (auto p: *block.inputs()) {
-                auto v = block.variable(p);
+            for (int e = 0; e < block.width(); e++) {
+                auto v = block.inputVariable(e);
                 NDArray<T> *aV = v->getNDArray();
 
                 if (aV == nullptr)
@@ -479,8 +492,9 @@ namespace nd4j {
 
 
             int cnt = 0;
-            for (auto p: *block.inputs()) {
-                auto v = block.variable(p);
+            for (int e = 0; e < block.width(); e++) {
+                auto &p = *block.input(e);
+                auto v = block.inputVariable(e);
                 if (v == nullptr) {
                     if (this->getOpName() != nullptr) {
                         nd4j_printf("Node [%i:<%s>]: Variable [%i] (%i:%i) is NULL\n", block.getNodeId(), this->getOpName()->c_str(), cnt, p.first, p.second);
@@ -519,8 +533,8 @@ namespace nd4j {
                 return ND4J_STATUS_OK;
 
             NDArray<T> *a0 = block.variable(0)->getNDArray();
-            for (auto p: *block.inputs()) {
-                auto v = block.variable(p);
+            for (int e = 0; e < block.width(); e++) {
+                auto v = block.inputVariable(e);
                 NDArray<T> *aV = v->getNDArray();
                 if (a0->ordering() != aV->ordering())
                     return ND4J_STATUS_BAD_ORDER;
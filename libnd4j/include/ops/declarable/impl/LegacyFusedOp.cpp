@@ -0,0 +1,212 @@
+/*******************************************************************************
+ * Copyright (c) 2015-2018 Skymind, Inc.
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Apache License, Version 2.0 which is available at
+ * https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ ******************************************************************************/
+
+
+#include <ops/declarable/LegacyFusedOp.h>
+#include <helpers/ShapeUtils.h>
+#include <NativeOpExcutioner.h>
+#include <loops/transform.h>
+#include <loops/scalar.h>
+#include <loops/pairwise_transform.h>
+
+// number of elements each block goes through the whole chain with, small enough to stay in L2
+#define FUSED_BLOCK_LENGTH 8192
+
+namespace nd4j {
+    namespace ops {
+        template <typename T>
+        LegacyFusedOp<T>::LegacyFusedOp() : LegacyOp<T>::LegacyOp(-1) {
+            // just a no-op
+        }
+
+        template <typename T>
+        LegacyFusedOp<T>::LegacyFusedOp(const std::vector<FusedStage<T>>& stages) : LegacyOp<T>::LegacyOp(-1) {
+            _stages = stages;
+        }
+
+        template <typename T>
+        LegacyOp<T>* LegacyFusedOp<T>::clone() {
+            return new LegacyFusedOp<T>(_stages);
+        }
+
+        template <typename T>
+        std::vector<FusedStage<T>>* LegacyFusedOp<T>::stages() {
+            return &_stages;
+        }
+
+        template <typename T>
+        bool LegacyFusedOp<T>::isFusable(OpType opType, int opNum) {
+            switch (opType) {
+                case OpType_SCALAR:
+                case OpType_PAIRWISE:
+                    return true;
+                case OpType_TRANSFORM: {
+                    switch (opNum) {
+                        case 36:    // Col2Im
+                        case 37:    // Im2col
+                        case 38:    // SoftMax
+                        case 39:    // SoftMaxDerivative
+                        case 40:    // LogSoftMax
+                        case 41:    // IsMax
+                        case 43:    // DropOut
+                        case 44:    // DropOutInverted
+                        case 48:    // Histogram
+                        case 70:    // Reverse
+                        case 71:    // Pooling2D
+                            return false;
+                        default:
+                            return true;
+                    }
+                }
+                default:
+                    return false;
+            }
+        }
+
+        template <typename T>
+        Nd4jStatus LegacyFusedOp<T>::validateAndExecute(Context<T> &block) {
+            auto x = INPUT_VARIABLE(0);
+            auto z = OUTPUT_VARIABLE(0);
+
+            const int numStages = static_cast<int>(_stages.size());
+
+            // resolving operands once: scalars for Scalar ops, buffers & strides for PairwiseTransform ops
+            std::vector<T> scalars(numStages);
+            std::vector<NDArray<T>*> operands(numStages, nullptr);
+            bool canBlock = x->ews() == 1 && z->ews() == 1 && x->ordering() == z->ordering();
+            bool aliased = false;
+
+            for (int s = 0; s < numStages; s++) {
+                auto &stage = _stages[s];
+                scalars[s] = stage.scalar;
+
+                if (stage.operand < 0)
+                    continue;
+
+                auto y = INPUT_VARIABLE(stage.operand);
+                if (stage.opType == OpType_SCALAR) {
+                    scalars[s] = y->getScalar(0);
+                    continue;
+                }
+
+                if (!z->isSameShape(y)) {
+                    std::string sz = ShapeUtils<T>::shapeAsString(z);
+                    std::string sy = ShapeUtils<T>::shapeAsString(y);
+                    REQUIRE_TRUE(!stage.operandFirst && y->isScalar(), 0, "Node_%i: For Pairwise transforms shapes of both operands should be equal but got %s vs %s", block.getNodeId(), sz.c_str(), sy.c_str());
+                }
+
+                operands[s] = y;
+                if (!y->isScalar() && (y->ews() != 1 || y->ordering() != z->ordering()))
+                    canBlock = false;
+
+                // later stages would read operand after z was already overwritten
+                if (s > 0 && y->getBuffer() == z->getBuffer())
+                    aliased = true;
+            }
+
+            auto target = aliased ? new NDArray<T>(z->ordering(), z->getShapeAsVector(), block.getWorkspace()) : z;
+
+            if (canBlock) {
+                const Nd4jLong length = z->lengthOf();
+                const Nd4jLong numBlocks = (length + FUSED_BLOCK_LENGTH - 1) / FUSED_BLOCK_LENGTH;
+
+                T* xBuffer = x->getBuffer();
+                T* zBuffer = target->getBuffer();
+
+#pragma omp parallel for schedule(static) if (numBlocks > 1 && length > Environment::getInstance()->elementwiseThreshold())
+                for (Nd4jLong b = 0; b < numBlocks; b++) {
+                    const Nd4jLong start = b * FUSED_BLOCK_LENGTH;
+                    const Nd4jLong n = nd4j::math::nd4j_min<Nd4jLong>(FUSED_BLOCK_LENGTH, length - start);
+                    T* zb = zBuffer + start;
+
+                    for (int s = 0; s < numStages; s++) {
+                        auto &stage = _stages[s];
+                        T* src = s == 0 ? xBuffer + start : zb;
+                        T* extras = stage.extraParams.data();
+
+                        switch (stage.opType) {
+                            case OpType_TRANSFORM:
+                                functions::transform::Transform<T>::exec(stage.opNum, src, 1, zb, 1, extras, n);
+                                break;
+                            case OpType_SCALAR:
+                                functions::scalar::ScalarTransform<T>::transform(stage.opNum, src, 1, zb, 1, scalars[s], extras, n);
+                                break;
+                            default: {
+                                auto y = operands[s];
+                                T* yb = y->isScalar() ? y->getBuffer() : y->getBuffer() + start;
+                                Nd4jLong yStride = y->isScalar() ? 0 : 1;
+
+                                if (stage.operandFirst)
+                                    functions::pairwise_transforms::PairWiseTransform<T>::exec(stage.opNum, yb, yStride, src, 1, zb, 1, extras, n);
+                                else
+                                    functions::pairwise_transforms::PairWiseTransform<T>::exec(stage.opNum, src, 1, yb, yStride, zb, 1, extras, n);
+                            }
+                        }
+                    }
+                }
+            } else {
+                // views & mixed orders: stages are applied one by one, but still without intermediate arrays
+                for (int s = 0; s < numStages; s++) {
+                    auto &stage = _stages[s];
+                    auto src = s == 0 ? x : target;
+                    T* extras = stage.extraParams.data();
+
+                    switch (stage.opType) {
+                        case OpType_TRANSFORM:
+                            NativeOpExcutioner<T>::execTransform(stage.opNum, src->getBuffer(), src->getShapeInfo(), target->getBuffer(), target->getShapeInfo(), extras, nullptr, nullptr);
+                            break;
+                        case OpType_SCALAR:
+                            NativeOpExcutioner<T>::execScalar(stage.opNum, src->getBuffer(), src->getShapeInfo(), target->getBuffer(), target->getShapeInfo(), scalars[s], extras);
+                            break;
+                        default: {
+                            auto y = operands[s];
+                            if (stage.operandFirst)
+                                NativeOpExcutioner<T>::execPairwiseTransform(stage.opNum, y->getBuffer(), y->getShapeInfo(), src->getBuffer(), src->getShapeInfo(), target->getBuffer(), target->getShapeInfo(), extras);
+                            else
+                                NativeOpExcutioner<T>::execPairwiseTransform(stage.opNum, src->getBuffer(), src->getShapeInfo(), y->getBuffer(), y->getShapeInfo(), target->getBuffer(), target->getShapeInfo(), extras);
+                        }
+                    }
+                }
+            }
+
+            if (aliased) {
+                z->assign(target);
+                delete target;
+            }
+
+            STORE_RESULT(*z);
+
+            return ND4J_STATUS_OK;
+        }
+
+        /**
+        *   Every stage keeps shape of its input 0, so output shape is the shape of the first input
+        */
+        template <typename T>
+        ShapeList *LegacyFusedOp<T>::calculateOutputShape(ShapeList *inputShape, nd4j::graph::Context<T> &block) {
+            auto inShape = inputShape->at(0);
+
+            Nd4jLong *newShape;
+            COPY_SHAPE(inShape, newShape);
+
+            return SHAPELIST(newShape);
+        }
+
+        template class ND4J_EXPORT LegacyFusedOp<float>;
+        template class ND4J_EXPORT LegacyFusedOp<double>;
+        template class ND4J_EXPORT LegacyFusedOp<float16>;
+    }
+}
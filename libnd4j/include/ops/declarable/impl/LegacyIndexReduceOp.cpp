@@ -19,6 +19,7 @@
 //
 
 #include <ops/declarable/LegacyIndexReduceOp.h>
+#include <helpers/TadCache.h>
 #include <helpers/ShapeUtils.h>
 #include <Status.h>
 
@@ -101,11 +102,9 @@ namespace nd4j {
                     if (dims.size() > 1)
                         std::sort(dims.begin(), dims.end());
 
-                    shape::TAD tad(x->getShapeInfo(), dims.data(), dims.size());
-                    tad.createTadOnlyShapeInfo();
-                    tad.createOffsets();
+                    auto tad = TadCache::getInstance()->tadForDimensions(x->getShapeInfo(), dims.data(), dims.size());
 
-                    NativeOpExcutioner<T>::execIndexReduce(opNum, x->getBuffer(), x->getShapeInfo(), block.getTArguments()->data(), z->getBuffer(), z->getShapeInfo(), dims.data(), (int) dims.size(), tad.tadOnlyShapeInfo, tad.tadOffsets);                }
+                    NativeOpExcutioner<T>::execIndexReduce(opNum, x->getBuffer(), x->getShapeInfo(), block.getTArguments()->data(), z->getBuffer(), z->getShapeInfo(), dims.data(), (int) dims.size(), tad->tadShapeInfo(), tad->tadOffsets());                }
             } else {
                 // TF mode
                 auto indices = INPUT_VARIABLE(1);
@@ -127,11 +126,9 @@ namespace nd4j {
 
                     REQUIRE_TRUE(axis.size() > 0, 0, "Some dimensions required for reduction!");
 
-                    shape::TAD tad(x->getShapeInfo(), axis.data(), axis.size());
-                    tad.createTadOnlyShapeInfo();
-                    tad.createOffsets();
+                    auto tad = TadCache::getInstance()->tadForDimensions(x->getShapeInfo(), axis.data(), axis.size());
 
-                    NativeOpExcutioner<T>::execIndexReduce(opNum, x->getBuffer(), x->getShapeInfo(), block.getTArguments()->data(), z->getBuffer(), z->getShapeInfo(), axis.data(), (int) axis.size(), tad.tadOnlyShapeInfo, tad.tadOffsets);
+                    NativeOpExcutioner<T>::execIndexReduce(opNum, x->getBuffer(), x->getShapeInfo(), block.getTArguments()->data(), z->getBuffer(), z->getShapeInfo(), axis.data(), (int) axis.size(), tad->tadShapeInfo(), tad->tadOffsets());
                 }
             }
 
@@ -20,6 +20,7 @@
 
 #include <ops/declarable/LegacyReduceOp.h>
 #include <helpers/TAD.h>
+#include <helpers/TadCache.h>
 #include <helpers/ShapeUtils.h>
 
 namespace nd4j {
@@ -72,11 +73,9 @@ namespace nd4j {
 
                     REQUIRE_TRUE(dims.size() > 0, 0, "Some dimensions required for reduction!");
 
-                    shape::TAD tad(x->getShapeInfo(), dims.data(), dims.size());
-                    tad.createTadOnlyShapeInfo();
-                    tad.createOffsets();
+                    auto tad = TadCache::getInstance()->tadForDimensions(x->getShapeInfo(), dims.data(), dims.size());
 
-                    NativeOpExcutioner<T>::execReduce(opNum, x->getBuffer(), x->getShapeInfo(), block.getTArguments()->data(), z->getBuffer(), z->getShapeInfo(), dims.data(), (int) dims.size(), tad.tadOnlyShapeInfo, tad.tadOffsets);
+                    NativeOpExcutioner<T>::execReduce(opNum, x->getBuffer(), x->getShapeInfo(), block.getTArguments()->data(), z->getBuffer(), z->getShapeInfo(), dims.data(), (int) dims.size(), tad->tadShapeInfo(), tad->tadOffsets());
                 }
 
                 STORE_RESULT(*z);
@@ -113,14 +112,12 @@ namespace nd4j {
 
                     REQUIRE_TRUE(axis.size() > 0, 0, "Some dimensions required for reduction!");
 
-                    shape::TAD tad(x->getShapeInfo(), axis.data(), axis.size());
-                    tad.createTadOnlyShapeInfo();
-                    tad.createOffsets();
+                    auto tad = TadCache::getInstance()->tadForDimensions(x->getShapeInfo(), axis.data(), axis.size());
 
                     auto newShape = ShapeUtils<T>::evalReduceShapeInfo(x->ordering(), axis, x);
                     auto z = new NDArray<T>(newShape, x->getWorkspace());
 
-                    NativeOpExcutioner<T>::execReduce(opNum, x->getBuffer(), x->getShapeInfo(), block.getTArguments()->data(), z->getBuffer(), z->getShapeInfo(), axis.data(), (int) axis.size(), tad.tadOnlyShapeInfo, tad.tadOffsets);
+                    NativeOpExcutioner<T>::execReduce(opNum, x->getBuffer(), x->getShapeInfo(), block.getTArguments()->data(), z->getBuffer(), z->getShapeInfo(), axis.data(), (int) axis.size(), tad->tadShapeInfo(), tad->tadOffsets());
 
                     RELEASE(newShape, x->getWorkspace());
 
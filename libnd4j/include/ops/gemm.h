@@ -31,6 +31,10 @@ namespace nd4j {
 
 
 
+        /**
+         * Fallback GEMM/GEMV used when no BLAS is available (and always for float16).
+         * GEMM packs operands into register-blocked panels and runs them in OpenMP tiles; float16 accumulates in fp32.
+         */
         template <typename T>
         class GEMM {
         protected:
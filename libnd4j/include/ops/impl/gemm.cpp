@@ -53,6 +53,158 @@ namespace nd4j {
             return ret;
         }
 
+        // accumulation type: float16 is accumulated in fp32, everything else in itself
+        template <typename T>
+        struct GemmAccumulator {
+            typedef T type;
+        };
+
+        template <>
+        struct GemmAccumulator<float16> {
+            typedef float type;
+        };
+
+        // register block of micro-kernel, and cache blocks for packed panels
+        #define GEMM_MR 8
+        #define GEMM_NR 4
+        #define GEMM_MC 128
+        #define GEMM_NC 256
+        #define GEMM_KC 256
+
+        // problems below this number of multiply-adds aren't worth packing
+        #define GEMM_SMALL 32768
+
+        /**
+         * This method packs A block [M x kc] (starting at column k0) into MR-row panels of accumulator type, zero-padded.
+         * A is packed row-major (r * K + k) if rowMajor is set, and column-major (k * M + r) otherwise.
+         */
+        template <typename T, typename A>
+        static void packA(bool rowMajor, int M, int K, int k0, int kc, T *source, A *target) {
+            int panels = (M + GEMM_MR - 1) / GEMM_MR;
+
+#pragma omp parallel for schedule(static) if(panels > 1 && M * kc > GEMM_SMALL) proc_bind(close)
+            for (int p = 0; p < panels; p++) {
+                A *panel = target + p * GEMM_MR * kc;
+                int r0 = p * GEMM_MR;
+                int rows = nd4j::math::nd4j_min<int>(GEMM_MR, M - r0);
+
+                for (int k = 0; k < kc; k++) {
+                    for (int i = 0; i < rows; i++)
+                        panel[k * GEMM_MR + i] = (A) (rowMajor ? source[(Nd4jLong) (r0 + i) * K + k0 + k] : source[(Nd4jLong) (k0 + k) * M + r0 + i]);
+
+                    for (int i = rows; i < GEMM_MR; i++)
+                        panel[k * GEMM_MR + i] = (A) 0.0f;
+                }
+            }
+        }
+
+        /**
+         * This method packs B block [kc x N] (starting at row k0) into NR-column panels of accumulator type, zero-padded.
+         * B is packed row-major (k * N + c) if rowMajor is set, and column-major (c * K + k) otherwise.
+         */
+        template <typename T, typename A>
+        static void packB(bool rowMajor, int N, int K, int k0, int kc, T *source, A *target) {
+            int panels = (N + GEMM_NR - 1) / GEMM_NR;
+
+#pragma omp parallel for schedule(static) if(panels > 1 && N * kc > GEMM_SMALL) proc_bind(close)
+            for (int p = 0; p < panels; p++) {
+                A *panel = target + p * GEMM_NR * kc;
+                int c0 = p * GEMM_NR;
+                int cols = nd4j::math::nd4j_min<int>(GEMM_NR, N - c0);
+
+                for (int k = 0; k < kc; k++) {
+                    for (int j = 0; j < cols; j++)
+                        panel[k * GEMM_NR + j] = (A) (rowMajor ? source[(Nd4jLong) (k0 + k) * N + c0 + j] : source[(Nd4jLong) (c0 + j) * K + k0 + k]);
+
+                    for (int j = cols; j < GEMM_NR; j++)
+                        panel[k * GEMM_NR + j] = (A) 0.0f;
+                }
+            }
+        }
+
+        /**
+         * Micro-kernel: C[rows x cols] += alpha * Ap[MR x kc] * Bp[kc x NR], C is column-major with leading dimension ldc
+         */
+        template <typename A>
+        static FORCEINLINE void microKernel(int kc, A alpha, A *Ap, A *Bp, A *C, int ldc, int rows, int cols) {
+            A acc[GEMM_NR][GEMM_MR];
+
+            for (int j = 0; j < GEMM_NR; j++)
+#pragma omp simd
+                for (int i = 0; i < GEMM_MR; i++)
+                    acc[j][i] = (A) 0.0f;
+
+            for (int k = 0; k < kc; k++) {
+                A *a = Ap + k * GEMM_MR;
+                A *b = Bp + k * GEMM_NR;
+
+                for (int j = 0; j < GEMM_NR; j++) {
+                    A bv = b[j];
+#pragma omp simd
+                    for (int i = 0; i < GEMM_MR; i++)
+                        acc[j][i] += a[i] * bv;
+                }
+            }
+
+            for (int j = 0; j < cols; j++) {
+                A *c = C + (Nd4jLong) j * ldc;
+                for (int i = 0; i < rows; i++)
+                    c[i] += alpha * acc[j][i];
+            }
+        }
+
+        /**
+         * C = alpha * A * B + C, with packed operands. C here is column-major [M x N] of accumulator type
+         */
+        template <typename T, typename A>
+        static void blockedGemm(bool rowMajorA, bool rowMajorB, int M, int N, int K, A alpha, T *a, T *b, A *C) {
+            int mPanels = (M + GEMM_MR - 1) / GEMM_MR;
+            int nPanels = (N + GEMM_NR - 1) / GEMM_NR;
+            int kc = nd4j::math::nd4j_min<int>(K, GEMM_KC);
+
+            A *Ap = new A[(Nd4jLong) mPanels * GEMM_MR * kc];
+            A *Bp = new A[(Nd4jLong) nPanels * GEMM_NR * kc];
+
+            int mBlocks = (M + GEMM_MC - 1) / GEMM_MC;
+            int nBlocks = (N + GEMM_NC - 1) / GEMM_NC;
+
+            for (int k0 = 0; k0 < K; k0 += GEMM_KC) {
+                int kb = nd4j::math::nd4j_min<int>(GEMM_KC, K - k0);
+
+                packA<T, A>(rowMajorA, M, K, k0, kb, a, Ap);
+                packB<T, A>(rowMajorB, N, K, k0, kb, b, Bp);
+
+                // each tile writes its own part of C, so tiles are independent
+#pragma omp parallel for collapse(2) schedule(dynamic) if(mBlocks * nBlocks > 1) proc_bind(close)
+                for (int mb = 0; mb < mBlocks; mb++) {
+                    for (int nb = 0; nb < nBlocks; nb++) {
+                        int rEnd = nd4j::math::nd4j_min<int>(M, (mb + 1) * GEMM_MC);
+                        int cEnd = nd4j::math::nd4j_min<int>(N, (nb + 1) * GEMM_NC);
+
+                        for (int c0 = nb * GEMM_NC; c0 < cEnd; c0 += GEMM_NR) {
+                            A *bPanel = Bp + (Nd4jLong) (c0 / GEMM_NR) * GEMM_NR * kb;
+                            int cols = nd4j::math::nd4j_min<int>(GEMM_NR, cEnd - c0);
+
+                            for (int r0 = mb * GEMM_MC; r0 < rEnd; r0 += GEMM_MR) {
+                                A *aPanel = Ap + (Nd4jLong) (r0 / GEMM_MR) * GEMM_MR * kb;
+                                int rows = nd4j::math::nd4j_min<int>(GEMM_MR, rEnd - r0);
+
+                                microKernel<A>(kb, alpha, aPanel, bPanel, C + (Nd4jLong) c0 * M + r0, M, rows, cols);
+                            }
+                        }
+                    }
+                }
+            }
+
+            delete[] Ap;
+            delete[] Bp;
+        }
+
+        /**
+         * Fallback GEMM. Operands are expected to be packed: A is [M x K] row-major if TransA == CblasTrans, column-major otherwise;
+         * B is [K x N] row-major if TransB == CblasTrans, column-major otherwise; C is [M x N] column-major.
+         * Order and leading dimensions are ignored, since existing callers rely on packed layout.
+         */
         template <typename T>
         void GEMM<T>::op(int Order, int TransA, int TransB,
                        int M, int N, int K,
@@ -62,51 +214,55 @@ namespace nd4j {
                        T beta,
                        T *C, int ldc) {
 
+            typedef typename GemmAccumulator<T>::type Acc;
+
             bool transAFlag = TransA == CblasTrans;
             bool transBFlag = TransB == CblasTrans;
 
-            if (beta == (T) 0.0f) {
-                int length = M*N;
-                if (length <= 8192) {
-#pragma omp simd
-                    for (int r = 0; r < length; r++)
-                        C[r] = (T) 0.0f;
-                } else {
-#pragma omp parallel for simd
-                    for (int r = 0; r < length; r++)
-                        C[r] = (T) 0.0f;
-                }
-            }
+            Nd4jLong length = (Nd4jLong) M * N;
+            Acc a = (Acc) alpha;
+            Acc b = (Acc) beta;
 
+            // C is scaled by beta once, micro-kernels accumulate on top of it
+            Acc *cAcc = sizeof(Acc) == sizeof(T) ? reinterpret_cast<Acc *>(C) : new Acc[length];
 
-#pragma omp parallel for simd collapse(2) proc_bind(close)
-            for (int r = 0; r < M; r++) {
-                for (int c = 0; c < N; c++) {
-                    int zIdx = linearIndexF(M, N, r, c);
+#pragma omp parallel for simd if(length > GEMM_SMALL) proc_bind(close)
+            for (Nd4jLong e = 0; e < length; e++)
+                cAcc[e] = b == (Acc) 0.0f ? (Acc) 0.0f : b * (Acc) C[e];
 
-                    T dot = (T) 0.0f;
+            if (a != (Acc) 0.0f && K > 0) {
+                if ((Nd4jLong) M * N * K <= GEMM_SMALL) {
+                    // tiny problems: plain loops, packing won't pay off
+                    for (int c = 0; c < N; c++) {
+                        for (int r = 0; r < M; r++) {
+                            Acc dot = (Acc) 0.0f;
 
-                    if (alpha != (T) 0.0f) {
-                        int bIdx; // = linearIndexF(K, N, 0, c);
-                        int aIdx;
+                            for (int k = 0; k < K; k++) {
+                                int aIdx = (transAFlag ? linearIndexC(M, K, r, k) : linearIndexF(M, K, r, k));
+                                int bIdx = (transBFlag ? linearIndexC(K, N, k, c) : linearIndexF(K, N, k, c));
+                                dot += (Acc) A[aIdx] * (Acc) B[bIdx];
+                            }
 
-                        for (int k = 0; k < K; k++) {
-                            aIdx = (transAFlag ? linearIndexC(M, K, r, k) : linearIndexF(M, K, r, k));
-                            bIdx = (transBFlag ? linearIndexC(K, N, k, c) : linearIndexF(K,N, k, c));
-                            dot += alpha * A[aIdx] * B[bIdx];//A[aIdx]nd4j::math::nd4j_dot<T>(aX, bX, K) * alpha;
+                            cAcc[linearIndexF(M, N, r, c)] += a * dot;
                         }
                     }
+                } else
+                    blockedGemm<T, Acc>(transAFlag, transBFlag, M, N, K, a, A, B, cAcc);
+            }
 
-                    if (beta != (T) 0.0f) {
-                        C[zIdx] = dot + beta * C[zIdx];
-                    } else {
-                        C[zIdx] = dot;
-                    }
-                }
+            if ((void *) cAcc != (void *) C) {
+#pragma omp parallel for simd if(length > GEMM_SMALL) proc_bind(close)
+                for (Nd4jLong e = 0; e < length; e++)
+                    C[e] = (T) cAcc[e];
+
+                delete[] cAcc;
             }
         }
 
 
+        /**
+         * Fallback GEMV: Y = alpha * A * X + beta * Y. A is [M x N], column-major if TRANS == CblasTrans, row-major otherwise
+         */
         template<typename T>
         void GEMV<T>::op(int TRANS, int M, int N,
                        T alpha,
@@ -118,20 +274,53 @@ namespace nd4j {
                        T* Y,
                        int incy ) {
 
-            T *aT = TRANS == CblasTrans ? GEMM<T>::transpose(CblasColMajor, CblasRowMajor, M, N, A) : A;
+            typedef typename GemmAccumulator<T>::type Acc;
 
-#pragma omp parallel for proc_bind(close)
-            for (int r = 0; r < M; r++) {
-                int aIdx = GEMM<T>::linearIndexC(M, N, r, 0);
-                T *aX = aT + aIdx;
+            Acc a = (Acc) alpha;
+            Acc b = (Acc) beta;
+            bool parallel = (Nd4jLong) M * N > GEMM_SMALL;
 
+            if (TRANS == CblasTrans) {
+                // column-major A: we stream columns, and each thread owns block of rows
+                int blocks = (M + GEMM_MC - 1) / GEMM_MC;
 
-                T dot = nd4j::math::nd4j_dot<T>(aX, X, lda) * alpha;
-                Y[r] =  beta == (T) 0.0f ? dot : dot + beta * Y[r];
-            }
+#pragma omp parallel for schedule(static) if(parallel && blocks > 1) proc_bind(close)
+                for (int bl = 0; bl < blocks; bl++) {
+                    int r0 = bl * GEMM_MC;
+                    int rows = nd4j::math::nd4j_min<int>(GEMM_MC, M - r0);
+                    Acc acc[GEMM_MC];
+
+                    for (int i = 0; i < rows; i++)
+                        acc[i] = (Acc) 0.0f;
+
+                    for (int c = 0; c < N; c++) {
+                        Acc xv = (Acc) X[(Nd4jLong) c * incx];
+                        T *col = A + (Nd4jLong) c * M + r0;
+
+#pragma omp simd
+                        for (int i = 0; i < rows; i++)
+                            acc[i] += (Acc) col[i] * xv;
+                    }
+
+                    for (int i = 0; i < rows; i++) {
+                        T *y = Y + (Nd4jLong) (r0 + i) * incy;
+                        *y = (T) (b == (Acc) 0.0f ? a * acc[i] : a * acc[i] + b * (Acc) *y);
+                    }
+                }
+            } else {
+#pragma omp parallel for schedule(static) if(parallel) proc_bind(close)
+                for (int r = 0; r < M; r++) {
+                    T *row = A + (Nd4jLong) r * N;
+                    Acc dot = (Acc) 0.0f;
+
+#pragma omp simd reduction(+:dot)
+                    for (int c = 0; c < N; c++)
+                        dot += (Acc) row[c] * (Acc) X[(Nd4jLong) c * incx];
 
-            if (TRANS == CblasTrans)
-                delete[] aT;
+                    T *y = Y + (Nd4jLong) r * incy;
+                    *y = (T) (b == (Acc) 0.0f ? a * dot : a * dot + b * (Acc) *y);
+                }
+            }
         }
 
 
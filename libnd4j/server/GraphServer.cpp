@@ -35,20 +35,33 @@
 
 namespace nd4j {
     namespace graph {
+            GraphInferenceServerImpl::GraphInferenceServerImpl(int maxBatchSize, Nd4jLong maxDelayMicros) {
+                _maxBatchSize = maxBatchSize;
+                _maxDelay = maxDelayMicros;
+            }
+
+            void GraphInferenceServerImpl::applyBatchingPolicy(Nd4jLong graphId) {
+                if (_maxBatchSize > 0)
+                    GraphHolder::getInstance()->enableBatching(graphId, _maxBatchSize, _maxDelay);
+            }
+
             grpc::Status GraphInferenceServerImpl::RegisterGraph( grpc::ServerContext *context, const flatbuffers::grpc::Message<FlatGraph> *request_msg, flatbuffers::grpc::Message<FlatResponse> *response_msg) {
                 auto flat_graph = request_msg->GetRoot();
 
                 try {
+                    flatbuffers::grpc::MessageBuilder mb;
+
                     // building our graph
                     auto graph = new Graph<float>(flat_graph);
 
                     // single data type for now
                     GraphHolder::getInstance()->registerGraph<float>(flat_graph->id(), graph);
+                    applyBatchingPolicy(flat_graph->id());
 
                     // sending out OK response
-                    auto response_offset = CreateFlatResponse(mb_, 0);
-                    mb_.Finish(response_offset);
-                    *response_msg = mb_.ReleaseMessage<FlatResponse>();
+                    auto response_offset = CreateFlatResponse(mb, 0);
+                    mb.Finish(response_offset);
+                    *response_msg = mb.ReleaseMessage<FlatResponse>();
                     assert(response_msg->Verify());
 
                     return grpc::Status::OK;
@@ -62,16 +75,19 @@ namespace nd4j {
                 auto flat_graph = request_msg->GetRoot();
 
                 try {
+                    flatbuffers::grpc::MessageBuilder mb;
+
                     // building our graph
                     auto graph = new Graph<float>(flat_graph);
 
                     // single data type for now
                     GraphHolder::getInstance()->replaceGraph(flat_graph->id(), graph);
+                    applyBatchingPolicy(flat_graph->id());
 
                     // sending out OK response
-                    auto response_offset = CreateFlatResponse(mb_, 0);
-                    mb_.Finish(response_offset);
-                    *response_msg = mb_.ReleaseMessage<FlatResponse>();
+                    auto response_offset = CreateFlatResponse(mb, 0);
+                    mb.Finish(response_offset);
+                    *response_msg = mb.ReleaseMessage<FlatResponse>();
                     assert(response_msg->Verify());
 
                     return grpc::Status::OK;
@@ -86,6 +102,7 @@ namespace nd4j {
 
             grpc::Status GraphInferenceServerImpl::ForgetGraph( grpc::ServerContext *context, const flatbuffers::grpc::Message<FlatDropRequest> *request_msg, flatbuffers::grpc::Message<FlatResponse> *response_msg) {
                 try {
+                    flatbuffers::grpc::MessageBuilder mb;
 
                     // getting drop request
                     auto request = request_msg->GetRoot();
@@ -94,9 +111,9 @@ namespace nd4j {
                     GraphHolder::getInstance()->dropGraphAny(request->id());
 
                     // sending out OK response
-                    auto response_offset = CreateFlatResponse(mb_, 0);
-                    mb_.Finish(response_offset);
-                    *response_msg = mb_.ReleaseMessage<FlatResponse>();
+                    auto response_offset = CreateFlatResponse(mb, 0);
+                    mb.Finish(response_offset);
+                    *response_msg = mb.ReleaseMessage<FlatResponse>();
                     assert(response_msg->Verify());
 
                     return grpc::Status::OK;
@@ -110,11 +127,14 @@ namespace nd4j {
                 auto request = request_msg->GetRoot();
 
                 try {
-                    // GraphHolder
-                    auto response_offset = GraphHolder::getInstance()->execute(request->id(), mb_, request);
+                    // each call gets its own builder, since calls are served concurrently
+                    flatbuffers::grpc::MessageBuilder mb;
 
-                    mb_.Finish(response_offset);
-                    *response_msg = mb_.ReleaseMessage<FlatResult>();
+                    // GraphHolder takes care of per-thread sessions and batching
+                    auto response_offset = GraphHolder::getInstance()->execute(request->id(), mb, request);
+
+                    mb.Finish(response_offset);
+                    *response_msg = mb.ReleaseMessage<FlatResult>();
                     assert(response_msg->Verify());
 
                     return grpc::Status::OK;
@@ -135,13 +155,13 @@ namespace nd4j {
     }
 }
 
-void RunServer(int port) {
+void RunServer(int port, int maxBatchSize, Nd4jLong maxDelay) {
   assert(port > 0 && port < 65535);
 
   std::string server_address("0.0.0.0:");
   server_address += nd4j::StringUtils::valueToString<int>(port);
 
-  nd4j::graph::GraphInferenceServerImpl service;
+  nd4j::graph::GraphInferenceServerImpl service(maxBatchSize, maxDelay);
   auto registrator = nd4j::ops::OpRegistrator::getInstance();
 
   grpc::ServerBuilder builder;
@@ -171,6 +191,7 @@ int main(int argc, char *argv[]) {
      * 1) port number
      * 2) if we should use gprc, json, or both
      * 3) if there's any graph(s) provided at startup
+     * 4) batching policy: max batch size and max delay in microseconds
      */
      int port = 40123;
      if(cmdOptionExists(argv, argv+argc, "-p")) {
@@ -178,13 +199,28 @@ int main(int argc, char *argv[]) {
         port = atoi(sPort);
      }
 
+     int maxBatchSize = 0;
+     if(cmdOptionExists(argv, argv+argc, "-b")) {
+        auto sBatch = getCmdOption(argv, argv + argc, "-b");
+        maxBatchSize = atoi(sBatch);
+     }
+
+     Nd4jLong maxDelay = 1000;
+     if(cmdOptionExists(argv, argv+argc, "-d")) {
+        auto sDelay = getCmdOption(argv, argv + argc, "-d");
+        maxDelay = atol(sDelay);
+     }
+
     if(cmdOptionExists(argv, argv+argc, "-f")) {
         auto file = getCmdOption(argv, argv + argc, "-f");
-        auto graph = GraphExecutioner<float>::importFromFlatBuffers(file);
+        auto graph = GraphExecutioner<float>::importFromMappedFlatBuffers(file);
         nd4j::graph::GraphHolder::getInstance()->registerGraph<float>(0L, graph);
+
+        if (maxBatchSize > 0)
+            nd4j::graph::GraphHolder::getInstance()->enableBatching(0L, maxBatchSize, maxDelay);
     }
 
-    RunServer(port);
+    RunServer(port, maxBatchSize, maxDelay);
 
     return 0;
 }
\ No newline at end of file
@@ -30,8 +30,14 @@ namespace nd4j {
     namespace graph {
         class GraphInferenceServerImpl final : public GraphInferenceServer::Service {
         private:
-            flatbuffers::grpc::MessageBuilder mb_;
+            // batching policy applied to every registered graph, batching is disabled if max batch size is 0
+            int _maxBatchSize;
+            Nd4jLong _maxDelay;
+
+            void applyBatchingPolicy(Nd4jLong graphId);
         public:
+            explicit GraphInferenceServerImpl(int maxBatchSize = 0, Nd4jLong maxDelayMicros = 0);
+
             virtual grpc::Status RegisterGraph( grpc::ServerContext *context, const flatbuffers::grpc::Message<FlatGraph> *request_msg, flatbuffers::grpc::Message<FlatResponse> *response_msg);
 
             virtual grpc::Status ForgetGraph( grpc::ServerContext *context, const flatbuffers::grpc::Message<FlatDropRequest> *request_msg, flatbuffers::grpc::Message<FlatResponse> *response_msg);
@@ -30,6 +30,7 @@
 #include <ops/declarable/CustomOperations.h>
 #include <ops/declarable/generic/helpers/convolutions.h>
 #include <ops/declarable/helpers/col2im.h>
+#include <Environment.h>
 
 using namespace nd4j;
 using namespace nd4j::graph;
@@ -2481,6 +2482,387 @@ TEST_F(ConvolutionTests, depthwise_conv2d_test4) {
     delete results; 
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, conv2d_tiled_1) {
+
+    int bS=2, iH=7,iW=6,  iC=3,oC=4,  kH=3,kW=2,  sH=2,sW=1,  pH=0,pW=0,  dH=2,dW=1;
+    int paddingMode = 1;             // 1-SAME, 0-VALID;
+
+    NDArray<double> inputNCHW('c', {bS, iC, iH, iW});
+    NDArray<double> weights ('c', {kH, kW, iC, oC});
+    NDArray<double> bias    ('c', {oC});
+    inputNCHW.linspace(0.1, 0.1);
+    weights.linspace(-0.5, 0.05);
+    bias.linspace(1.);
+
+    // untiled NCHW im2col result is the reference for both data formats
+    nd4j::ops::conv2d<double> op;
+    auto expected = op.execute({&inputNCHW, &weights, &bias}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, 0});
+    ASSERT_EQ(Status::OK(), expected->status());
+
+    auto limit = nd4j::Environment::getInstance()->convolutionMemoryLimit();
+
+    for (int dataFormat = 0; dataFormat < 2; dataFormat++) {
+        NDArray<double>* input = dataFormat ? inputNCHW.permute({0, 2, 3, 1})->dup('c') : &inputNCHW;
+
+        // columns of few output rows only fit into limit
+        nd4j::Environment::getInstance()->setConvolutionMemoryLimit(3 * 6 * (kH*kW*iC + oC) * sizeof(double));
+        auto results = op.execute({input, &weights, &bias}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, dataFormat});
+        nd4j::Environment::getInstance()->setConvolutionMemoryLimit(limit);
+
+        NDArray<double>* exp = dataFormat ? expected->at(0)->permute({0, 2, 3, 1}) : expected->at(0);
+
+        ASSERT_EQ(Status::OK(), results->status());
+        ASSERT_TRUE(exp->isSameShape(results->at(0)));
+        ASSERT_TRUE(exp->equalsTo(results->at(0)));
+
+        if (dataFormat) {
+            delete exp;
+            delete input;
+        }
+        delete results;
+    }
+
+    delete expected;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, conv3d_tiled_1) {
+
+    int bS=2, iD=4,iH=5,iW=3,  iC=2,oC=3,  kD=2,kH=3,kW=2,  sD=1,sH=2,sW=1,  pD=0,pH=0,pW=0,  dD=2,dH=1,dW=1;
+    int paddingMode = 0;             // 1-SAME,  0-VALID;
+
+    NDArray<double> inputNCDHW('c', {bS, iC, iD, iH, iW});
+    NDArray<double> weights ('c', {kD, kH, kW, iC, oC});
+    NDArray<double> bias    ('c', {oC});
+    inputNCDHW.linspace(0.2, 0.05);
+    weights.linspace(-1., 0.03);
+    bias = 0.5;
+
+    // untiled NCDHW vol2col result is the reference for both data formats
+    nd4j::ops::conv3dnew<double> op;
+    auto expected = op.execute({&inputNCDHW, &weights, &bias}, {}, {kD,kH,kW,  sD,sH,sW,  pD,pH,pW,  dD,dH,dW, paddingMode, 0});
+    ASSERT_EQ(Status::OK(), expected->status());
+
+    auto limit = nd4j::Environment::getInstance()->convolutionMemoryLimit();
+
+    for (int dataFormat = 0; dataFormat < 2; dataFormat++) {
+        NDArray<double>* input = dataFormat ? inputNCDHW.permute({0, 2, 3, 4, 1})->dup('c') : &inputNCDHW;
+
+        // single output row per tile
+        nd4j::Environment::getInstance()->setConvolutionMemoryLimit(1);
+        auto results = op.execute({input, &weights, &bias}, {}, {kD,kH,kW,  sD,sH,sW,  pD,pH,pW,  dD,dH,dW, paddingMode, dataFormat});
+        nd4j::Environment::getInstance()->setConvolutionMemoryLimit(limit);
+
+        NDArray<double>* exp = dataFormat ? expected->at(0)->permute({0, 2, 3, 4, 1}) : expected->at(0);
+
+        ASSERT_EQ(Status::OK(), results->status());
+        ASSERT_TRUE(exp->isSameShape(results->at(0)));
+        ASSERT_TRUE(exp->equalsTo(results->at(0)));
+
+        if (dataFormat) {
+            delete exp;
+            delete input;
+        }
+        delete results;
+    }
+
+    delete expected;
+}
+
+//////////////////////////////////////////////////////////////////////
+TYPED_TEST(TypedConvolutionTests, conv2d_winograd_1) {
+
+    int bS=2, iH=9,iW=7,  iC=8,oC=10,  kH=3,kW=3,  sH=1,sW=1,  pH=0,pW=0,  dH=1,dW=1;
+
+    NDArray<TypeParam> weights('c', {kH, kW, iC, oC});
+    NDArray<TypeParam> bias   ('c', {oC});
+    for (int e = 0; e < weights.lengthOf(); e++)
+        weights.putScalar(e, (TypeParam) ((e * 7 % 13) - 6) / (TypeParam) 10.f);
+    bias.linspace(-0.5, 0.1);
+
+    for (int dataFormat = 0; dataFormat < 2; dataFormat++) {
+        for (int paddingMode = 0; paddingMode < 2; paddingMode++) {
+
+            const int oH = paddingMode ? iH : iH - 2;
+            const int oW = paddingMode ? iW : iW - 2;
+            const int pad = paddingMode ? 1 : 0;
+
+            NDArray<TypeParam> input   ('c', {bS, iC, iH, iW});
+            NDArray<TypeParam> expected('c', {bS, oC, oH, oW});
+            for (int e = 0; e < input.lengthOf(); e++)
+                input.putScalar(e, (TypeParam) ((e * 5 % 11) - 5) / (TypeParam) 4.f);
+
+            // direct convolution as reference
+            for (int b = 0; b < bS; b++)
+                for (int o = 0; o < oC; o++)
+                    for (int oh = 0; oh < oH; oh++)
+                        for (int ow = 0; ow < oW; ow++) {
+                            double sum = bias(o);
+                            for (int c = 0; c < iC; c++)
+                                for (int kh = 0; kh < kH; kh++)
+                                    for (int kw = 0; kw < kW; kw++) {
+                                        int ih = oh - pad + kh, iw = ow - pad + kw;
+                                        if (ih >= 0 && ih < iH && iw >= 0 && iw < iW)
+                                            sum += (double) input(b, c, ih, iw) * (double) weights(kh, kw, c, o);
+                                    }
+                            expected(b, o, oh, ow) = (TypeParam) sum;
+                        }
+
+            NDArray<TypeParam>* in  = dataFormat ? input.permute({0, 2, 3, 1})->dup('c') : input.dup('c');
+            NDArray<TypeParam>* exp = dataFormat ? expected.permute({0, 2, 3, 1})->dup('c') : expected.dup('c');
+
+            nd4j::ops::conv2d<TypeParam> op;
+            auto results = op.execute({in, &weights, &bias}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, dataFormat});
+            ASSERT_EQ(Status::OK(), results->status());
+            ASSERT_TRUE(exp->isSameShape(results->at(0)));
+            ASSERT_TRUE(exp->equalsTo(results->at(0), (TypeParam) 1e-3));
+
+            // transformed filter must not be reused once weights are changed in place
+            weights *= (TypeParam) 2.f;
+            bias *= (TypeParam) 2.f;
+            auto results2 = op.execute({in, &weights, &bias}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, dataFormat});
+            *exp *= (TypeParam) 2.f;
+            weights /= (TypeParam) 2.f;
+            bias /= (TypeParam) 2.f;
+            ASSERT_EQ(Status::OK(), results2->status());
+            ASSERT_TRUE(exp->equalsTo(results2->at(0), (TypeParam) 2e-3));
+
+            delete results;
+            delete results2;
+            delete in;
+            delete exp;
+        }
+    }
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, conv2d_winograd_2) {
+
+    int bS=1, iH=8,iW=8,  iC=8,oC=8,  kH=3,kW=3,  sH=1,sW=1,  pH=0,pW=0,  dH=1,dW=1;
+
+    NDArray<double> input   ('c', {bS, iC, iH, iW});
+    NDArray<double> weightsA('c', {kH, kW, iC, oC});
+    NDArray<double> weightsB('c', {kH, kW, iC, oC});
+    input.linspace(-1., 0.01);
+    weightsA.linspace(-0.3, 0.001);
+    weightsB.linspace(0.2, -0.002);
+
+    nd4j::ops::conv2d<double> op;
+    auto expA = op.execute({&input, &weightsA}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, 0, 0});
+    auto expB = op.execute({&input, &weightsB}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, 0, 0});
+
+    auto limit = nd4j::Environment::getInstance()->winogradCacheLimit();
+
+    // nothing cached at all, and then room for one filter only, so A and B evict each other
+    for (Nd4jLong cacheLimit: {(Nd4jLong) 0, (Nd4jLong) (36 * iC * oC * sizeof(double))}) {
+        nd4j::Environment::getInstance()->setWinogradCacheLimit(cacheLimit);
+
+        for (int e = 0; e < 3; e++) {
+            auto resA = op.execute({&input, &weightsA}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, 0, 0});
+            auto resB = op.execute({&input, &weightsB}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, 0, 0});
+
+            ASSERT_EQ(Status::OK(), resA->status());
+            ASSERT_EQ(Status::OK(), resB->status());
+            ASSERT_TRUE(expA->at(0)->equalsTo(resA->at(0)));
+            ASSERT_TRUE(expB->at(0)->equalsTo(resB->at(0)));
+
+            delete resA;
+            delete resB;
+        }
+    }
+
+    nd4j::Environment::getInstance()->setWinogradCacheLimit(limit);
+
+    delete expA;
+    delete expB;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, nhwc_kernels_1) {
+
+    int bS=2, iH=7,iW=6,  iC=5,mC=2,  kH=3,kW=2,  sH=2,sW=1,  pH=0,pW=0,  dH=1,dW=2;
+
+    NDArray<double> inputNCHW('c', {bS, iC, iH, iW});
+    NDArray<double> weights  ('c', {kH, kW, iC, mC});
+    NDArray<double> bias     ('c', {iC*mC});
+    for (int e = 0; e < inputNCHW.lengthOf(); e++)
+        inputNCHW.putScalar(e, (double) ((e * 7 % 17) - 8) / 3.);
+    weights.linspace(-0.6, 0.02);
+    bias.linspace(0.1, 0.1);
+
+    // channels-last input as contiguous array, so NHWC kernels don't work on permuted views
+    NDArray<double>* inputNHWC = inputNCHW.permute({0, 2, 3, 1})->dup('c');
+
+    nd4j::ops::maxpool2d<double> maxPool;
+    nd4j::ops::avgpool2d<double> avgPool;
+    nd4j::ops::pnormpool2d<double> pnormPool;
+    nd4j::ops::depthwise_conv2d<double> depthwise;
+    std::vector<nd4j::ops::DeclarableOp<double>*> ops = {&maxPool, &avgPool, &avgPool, &pnormPool, &depthwise};
+    std::vector<int> extraParam0 = {0, 0, 1, 3, 0};
+
+    for (int paddingMode = 0; paddingMode < 2; paddingMode++) {
+        for (int e = 0; e < ops.size(); e++) {
+            const bool isDepthwise = e == ops.size() - 1;
+
+            ResultSet<double>* resultsNCHW = isDepthwise ? ops[e]->execute({&inputNCHW, &weights, &bias}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, 0})
+                                                         : ops[e]->execute({&inputNCHW}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, extraParam0[e], 0});
+            ResultSet<double>* resultsNHWC = isDepthwise ? ops[e]->execute({inputNHWC, &weights, &bias}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, 1})
+                                                         : ops[e]->execute({inputNHWC}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, extraParam0[e], 1});
+
+            ASSERT_EQ(Status::OK(), resultsNCHW->status());
+            ASSERT_EQ(Status::OK(), resultsNHWC->status());
+
+            NDArray<double>* expected = resultsNCHW->at(0)->permute({0, 2, 3, 1});
+            ASSERT_TRUE(expected->isSameShape(resultsNHWC->at(0)));
+            ASSERT_TRUE(expected->equalsTo(resultsNHWC->at(0)));
+
+            delete expected;
+            delete resultsNCHW;
+            delete resultsNHWC;
+        }
+    }
+
+    // regular conv2d goes through convTiled for NHWC, so it is checked against permuted NCHW result too
+    int oC=3;
+    NDArray<double> weights2d('c', {kH, kW, iC, oC});
+    NDArray<double> bias2d   ('c', {oC});
+    weights2d.linspace(-0.4, 0.03);
+    bias2d.linspace(0.1, 0.1);
+
+    nd4j::ops::conv2d<double> conv2d;
+
+    for (int paddingMode = 0; paddingMode < 2; paddingMode++) {
+        ResultSet<double>* resultsNCHW = conv2d.execute({&inputNCHW, &weights2d, &bias2d}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, 0});
+        ResultSet<double>* resultsNHWC = conv2d.execute({inputNHWC,  &weights2d, &bias2d}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, 1});
+
+        ASSERT_EQ(Status::OK(), resultsNCHW->status());
+        ASSERT_EQ(Status::OK(), resultsNHWC->status());
+
+        NDArray<double>* expected = resultsNCHW->at(0)->permute({0, 2, 3, 1});
+        ASSERT_TRUE(expected->isSameShape(resultsNHWC->at(0)));
+        ASSERT_TRUE(expected->equalsTo(resultsNHWC->at(0)));
+
+        delete expected;
+        delete resultsNCHW;
+        delete resultsNHWC;
+    }
+
+    delete inputNHWC;
+
+    // same for conv3dnew, NDHWC vs permuted NCDHW
+    int iD=5,  kD=2,  sD=1,  pD=0,  dD=1;
+
+    NDArray<double> inputNCDHW('c', {bS, iC, iD, iH, iW});
+    NDArray<double> weights3d ('c', {kD, kH, kW, iC, oC});
+    NDArray<double> bias3d    ('c', {oC});
+    for (int e = 0; e < inputNCDHW.lengthOf(); e++)
+        inputNCDHW.putScalar(e, (double) ((e * 5 % 13) - 6) / 4.);
+    weights3d.linspace(-0.5, 0.01);
+    bias3d.linspace(0.2, 0.1);
+
+    NDArray<double>* inputNDHWC = inputNCDHW.permute({0, 2, 3, 4, 1})->dup('c');
+
+    nd4j::ops::conv3dnew<double> conv3d;
+
+    for (int paddingMode = 0; paddingMode < 2; paddingMode++) {
+        ResultSet<double>* resultsNCDHW = conv3d.execute({&inputNCDHW, &weights3d, &bias3d}, {}, {kD,kH,kW,  sD,sH,sW,  pD,pH,pW,  dD,dH,dW, paddingMode, 0});
+        ResultSet<double>* resultsNDHWC = conv3d.execute({inputNDHWC,  &weights3d, &bias3d}, {}, {kD,kH,kW,  sD,sH,sW,  pD,pH,pW,  dD,dH,dW, paddingMode, 1});
+
+        ASSERT_EQ(Status::OK(), resultsNCDHW->status());
+        ASSERT_EQ(Status::OK(), resultsNDHWC->status());
+
+        NDArray<double>* expected = resultsNCDHW->at(0)->permute({0, 2, 3, 4, 1});
+        ASSERT_TRUE(expected->isSameShape(resultsNDHWC->at(0)));
+        ASSERT_TRUE(expected->equalsTo(resultsNDHWC->at(0)));
+
+        delete expected;
+        delete resultsNCDHW;
+        delete resultsNDHWC;
+    }
+
+    delete inputNDHWC;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, pointwise_conv2d_test2) {
+
+    int bS=2, iH=4,iW=3,  iC=5,oC=3;
+    int dataFormat = 0;           // 1-NHWC, 0-NCHW
+
+    NDArray<double> input   ('c', {bS, iC, iH, iW});
+    NDArray<double> weights ('c', {1,   1, iC, oC});
+    NDArray<double> bias    ('c', {oC});
+    NDArray<double> expOutput('c', {bS, oC, iH, iW});
+    input.linspace(-1., 0.1);
+    weights.linspace(0.1, 0.1);
+    bias.linspace(1.);
+
+    for (int b = 0; b < bS; b++)
+        for (int o = 0; o < oC; o++)
+            for (int h = 0; h < iH; h++)
+                for (int w = 0; w < iW; w++) {
+                    double sum = bias(o);
+                    for (int c = 0; c < iC; c++)
+                        sum += input(b, c, h, w) * weights(0, 0, c, o);
+                    expOutput(b, o, h, w) = sum;
+                }
+
+    nd4j::ops::pointwise_conv2d<double> op;
+    ResultSet<double>* results = op.execute({&input, &weights, &bias}, {}, {dataFormat});
+    NDArray<double>* output = results->at(0);
+
+    ASSERT_EQ(Status::OK(), results->status());
+
+    ASSERT_TRUE(expOutput.isSameShape(output));
+    ASSERT_TRUE(expOutput.equalsTo(output));
+
+    delete results;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(ConvolutionTests, depthwise_conv2d_test5) {
+
+    int bS=2, iH=9,iW=8,  iC=3,mC=2,  kH=3,kW=3,  sH=2,sW=2,  pH=1,pW=2,  dH=1,dW=2;
+    int oC=iC*mC;
+    int oH=(iH + 2*pH - (kH-1)*dH - 1) / sH + 1;
+    int oW=(iW + 2*pW - (kW-1)*dW - 1) / sW + 1;
+    int paddingMode = 0;             // 1-SAME, 0-VALID;
+    int dataFormat  = 0;             // 1-NHWC, 0-NCHW
+
+    NDArray<double> input    ('c', {bS, iC, iH, iW});
+    NDArray<double> weights  ('c', {kH, kW, iC, mC});
+    NDArray<double> expOutput('c', {bS, oC, oH, oW});
+    input.linspace(-2., 0.05);
+    weights.linspace(-0.5, 0.03);
+
+    for (int b = 0; b < bS; b++)
+        for (int c = 0; c < iC; c++)
+            for (int m = 0; m < mC; m++)
+                for (int oh = 0; oh < oH; oh++)
+                    for (int ow = 0; ow < oW; ow++) {
+                        double sum = 0.;
+                        for (int kh = 0; kh < kH; kh++)
+                            for (int kw = 0; kw < kW; kw++) {
+                                int ih = oh * sH - pH + kh * dH, iw = ow * sW - pW + kw * dW;
+                                if (ih >= 0 && ih < iH && iw >= 0 && iw < iW)
+                                    sum += input(b, c, ih, iw) * weights(kh, kw, c, m);
+                            }
+                        expOutput(b, c * mC + m, oh, ow) = sum;
+                    }
+
+    nd4j::ops::depthwise_conv2d<double> op;
+    ResultSet<double>* results = op.execute({&input, &weights}, {}, {kH,kW,  sH,sW,  pH,pW,  dH,dW, paddingMode, dataFormat});
+    NDArray<double>* output = results->at(0);
+
+    ASSERT_EQ(Status::OK(), results->status());
+
+    ASSERT_TRUE(expOutput.isSameShape(output));
+    ASSERT_TRUE(expOutput.equalsTo(output));
+
+    delete results;
+}
+
 #endif //LIBND4J_CONVOLUTIONTESTS_H
 
 
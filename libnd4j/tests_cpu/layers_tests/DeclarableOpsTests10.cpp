@@ -1793,3 +1793,104 @@ TEST_F(DeclarableOpsTests10, batchnorm_new_test3) {
 
 
 
+
+////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests10, KNN_Search_1) {
+    // sizes are chosen to cross both row block and column tile boundaries
+    const int N = 300, M = 2100, D = 16, K = 5;
+    NDArray<double> x('c', {N, D});
+    NDArray<double> y('c', {M, D});
+
+    // small non-negative integers for Jaccard and Hamming: they make ties, and exact sums keep tie order deterministic
+    NDArray<double> xInt('c', {N, D});
+    NDArray<double> yInt('c', {M, D});
+
+    for (int e = 0; e < x.lengthOf(); e++) {
+        x.putScalar(e, nd4j::math::nd4j_sin<double>(e * 0.37) + 0.5 * nd4j::math::nd4j_cos<double>(e * 0.011));
+        xInt.putScalar(e, (double) ((e * 7 + e / 5) % 4));
+    }
+
+    for (int e = 0; e < y.lengthOf(); e++) {
+        y.putScalar(e, nd4j::math::nd4j_cos<double>(e * 0.29) + 0.5 * nd4j::math::nd4j_sin<double>(e * 0.013));
+        yInt.putScalar(e, (double) ((e * 5 + e / 3) % 4));
+    }
+
+    nd4j::ops::knn_search<double> op;
+
+    for (int metric: {0, 1, 2, 3, 5, 6, 7}) {
+        const bool isInt = metric == 6 || metric == 7;
+        const bool isSimilarity = metric == 2 || metric == 3;
+        NDArray<double>* xm = isInt ? &xInt : &x;
+        NDArray<double>* ym = isInt ? &yInt : &y;
+
+        auto result = op.execute({xm, ym}, {}, {K, metric});
+        ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+        auto distances = result->at(0);
+        auto indices = result->at(1);
+        ASSERT_EQ(N, distances->sizeAt(0));
+        ASSERT_EQ(K, distances->sizeAt(1));
+
+        for (int r = 0; r < N; r++) {
+            std::vector<std::pair<double, int>> all(M);
+            for (int c = 0; c < M; c++) {
+                double d = 0.0, xx = 0.0, yy = 0.0, mins = 0.0, maxs = 0.0;
+                for (int e = 0; e < D; e++) {
+                    double a = xm->getScalar(r, e);
+                    double b = ym->getScalar(c, e);
+                    switch (metric) {
+                        case 0: d += nd4j::math::nd4j_abs<double>(a - b); break;
+                        case 1: d += (a - b) * (a - b); break;
+                        case 6: mins += nd4j::math::nd4j_min<double>(a, b); maxs += nd4j::math::nd4j_max<double>(a, b); break;
+                        case 7: d += a == b ? 0.0 : 1.0; break;
+                        default: d += a * b; xx += a * a; yy += b * b;
+                    }
+                }
+
+                switch (metric) {
+                    case 1: d = nd4j::math::nd4j_sqrt<double>(d); break;
+                    case 2: d = d / (nd4j::math::nd4j_sqrt<double>(xx) * nd4j::math::nd4j_sqrt<double>(yy)); break;
+                    case 5: d = 1.0 - d / (nd4j::math::nd4j_sqrt<double>(xx) * nd4j::math::nd4j_sqrt<double>(yy)); break;
+                    case 6: d = 1.0 - mins / maxs; break;
+                    case 7: d = d / D; break;
+                    default: break;
+                }
+                all[c] = {isSimilarity ? -d : d, c};
+            }
+            std::sort(all.begin(), all.end());
+
+            for (int e = 0; e < K; e++) {
+                ASSERT_NEAR(isSimilarity ? -all[e].first : all[e].first, distances->getScalar(r, e), 1e-6);
+                ASSERT_EQ(all[e].second, (int) indices->getScalar(r, e));
+            }
+        }
+
+        delete result;
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests10, KNN_Search_2) {
+    // Jaccard distance between two zero rows is 0/0, such neighbours have to go last
+    NDArray<double> x('c', {2, 4}, {0, 0, 0, 0,   1, 1, 0, 0});
+    NDArray<double> y('c', {4, 4}, {0, 0, 0, 0,   1, 0, 0, 0,   1, 1, 0, 0,   0, 0, 1, 1});
+
+    nd4j::ops::knn_search<double> op;
+    auto result = op.execute({&x, &y}, {}, {4, 6});
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto distances = result->at(0);
+    auto indices = result->at(1);
+
+    std::vector<int> expIndices = {1, 2, 3, 0,   2, 1, 0, 3};
+    std::vector<double> expDistances = {1., 1., 1., 0.,   0., 0.5, 1., 1.};
+    for (int e = 0; e < 8; e++) {
+        ASSERT_EQ(expIndices[e], (int) indices->getScalar(e));
+        if (e == 3)
+            ASSERT_TRUE(distances->getScalar(e) != distances->getScalar(e));
+        else
+            ASSERT_NEAR(expDistances[e], distances->getScalar(e), 1e-6);
+    }
+
+    delete result;
+}
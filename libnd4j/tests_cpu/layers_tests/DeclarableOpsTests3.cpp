@@ -161,6 +161,38 @@ TEST_F(DeclarableOpsTests3, Test_Unique_2) {
     delete result;
 }
 
+TEST_F(DeclarableOpsTests3, Test_Unique_3) {
+    // long enough to take partitioned path, first occurrence ordering must be kept anyway
+    const int length = 300000;
+    const int numUnique = 1000;
+
+    NDArray<double> x('c', {length});
+    for (int e = 0; e < length; e++)
+        x(e) = (double) ((e * 7) % numUnique);
+
+    nd4j::ops::unique_with_counts<double> op;
+    auto result = op.execute({&x}, {}, {});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+    ASSERT_EQ(3, result->size());
+
+    auto v = result->at(0);
+    auto i = result->at(1);
+    auto c = result->at(2);
+
+    ASSERT_EQ(numUnique, v->lengthOf());
+
+    for (int e = 0; e < numUnique; e++) {
+        ASSERT_EQ((double) ((e * 7) % numUnique), (*v)(e));
+        ASSERT_EQ((double) (length / numUnique), (*c)(e));
+    }
+
+    for (int e = 0; e < length; e++)
+        ASSERT_EQ((double) (e % numUnique), (*i)(e));
+
+    delete result;
+}
+
 TEST_F(DeclarableOpsTests3, Test_Rint_1) {
     NDArray<float> x('c', {1, 7}, {-1.7, -1.5, -0.2, 0.2, 1.5, 1.7, 2.0});
     NDArray<float> exp('c', {1, 7}, {-2., -2., -0., 0., 2., 2., 2.});
@@ -1395,6 +1395,71 @@ TEST_F(DeclarableOpsTests4, lstm_test1) {
 } 
 
 
+///////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests4, lstm_test2) {
+    
+    const int time      = 4;
+    const int batchSize = 2;
+    const int inSize    = 5;
+    const int numProj   = 3;
+    const int numUnits  = 4;
+
+    NDArray<double> x  ('c', {time, batchSize, inSize});
+    NDArray<double> h0 ('c', {batchSize, numProj});
+    NDArray<double> c0 ('c', {batchSize, numUnits});
+    NDArray<double> Wx ('c', {inSize, 4*numUnits});
+    NDArray<double> Wh ('c', {numProj, 4*numUnits});
+    NDArray<double> Wc ('c', {3*numUnits});
+    NDArray<double> Wp ('c', {numUnits, numProj});
+    NDArray<double> b  ('c', {4*numUnits});
+
+    x.linspace(-0.5, 0.05);
+    h0.linspace(0.1, 0.1);
+    c0.linspace(-0.3, 0.1);
+    Wx.linspace(-0.2, 0.01);
+    Wh.linspace(0.3, -0.01);
+    Wc.linspace(0.1, 0.05);
+    Wp.linspace(-0.4, 0.07);
+    b.linspace(0.2, -0.02);
+
+    // whole-sequence op has to match step-by-step application of the cell, with peepholes, projection and clipping turned on
+    nd4j::ops::lstm<double> op;
+    nd4j::ResultSet<double>* results = op.execute({&x, &h0, &c0, &Wx, &Wh, &Wc, &Wp, &b}, {0.9, 0.5, 1.}, {1, 1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, results->status());
+
+    NDArray<double> *h = results->at(0);    
+    NDArray<double> *c = results->at(1);
+
+    nd4j::ops::lstmCell<double> cellOp;
+    NDArray<double> ht_1(h0);
+    NDArray<double> ct_1(c0);
+
+    for (int t = 0; t < time; ++t) {
+        NDArray<double> xt = x({t,t+1, 0,0, 0,0});
+        xt.reshapei({batchSize, inSize});
+
+        nd4j::ResultSet<double>* step = cellOp.execute({&xt, &ht_1, &ct_1, &Wx, &Wh, &Wc, &Wp, &b}, {0.9, 0.5, 1.}, {1, 1});
+        ASSERT_EQ(ND4J_STATUS_OK, step->status());
+
+        NDArray<double> ht = (*h)({t,t+1, 0,0, 0,0});
+        NDArray<double> ct = (*c)({t,t+1, 0,0, 0,0});
+
+        for (int e = 0; e < batchSize; ++e) {
+            for (int j = 0; j < numProj; ++j)
+                ASSERT_NEAR(step->at(0)->getScalar(e, j), ht(0, e, j), 1e-5);
+            for (int j = 0; j < numUnits; ++j)
+                ASSERT_NEAR(step->at(1)->getScalar(e, j), ct(0, e, j), 1e-5);
+        }
+
+        ht_1.assign(step->at(0));
+        ct_1.assign(step->at(1));
+        delete step;
+    }
+
+    delete results;
+} 
+
 ///////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests4, gru_test1) {
     
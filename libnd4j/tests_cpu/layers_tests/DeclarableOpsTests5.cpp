@@ -1085,6 +1085,68 @@ TEST_F(DeclarableOpsTests5, Test_TopK_5) {
     delete result;
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, Test_TopK_6) {
+    // ties are resolved in favor of lower index, duplicates are kept
+    NDArray<float> x('c', {2, 5}, {3.0f, 7.0f, 3.0f, 7.0f, 1.0f,   2.0f, 2.0f, 2.0f, 2.0f, 2.0f});
+    NDArray<float> expV('c', {2, 3}, {7.0f, 7.0f, 3.0f,   2.0f, 2.0f, 2.0f});
+    NDArray<float> expI('c', {2, 3}, {1.0f, 3.0f, 0.0f,   0.0f, 1.0f, 2.0f});
+    NDArray<float> expUnsortedV('c', {2, 3}, {3.0f, 7.0f, 7.0f,   2.0f, 2.0f, 2.0f});
+    NDArray<float> expUnsortedI('c', {2, 3}, {0.0f, 1.0f, 3.0f,   0.0f, 1.0f, 2.0f});
+
+    nd4j::ops::top_k<float> op;
+    auto result = op.execute({&x}, {}, {3, 1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+    ASSERT_TRUE(expV.equalsTo(result->at(0)));
+    ASSERT_TRUE(expI.equalsTo(result->at(1)));
+
+    auto unsorted = op.execute({&x}, {}, {3, 0});
+
+    ASSERT_EQ(ND4J_STATUS_OK, unsorted->status());
+    ASSERT_TRUE(expUnsortedV.equalsTo(unsorted->at(0)));
+    ASSERT_TRUE(expUnsortedI.equalsTo(unsorted->at(1)));
+
+    delete result;
+    delete unsorted;
+}
+
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, Test_TopK_7) {
+    const int rows = 3;
+    const int width = 5000;
+    const int k = 100;
+
+    // values are shuffled, with plenty of duplicates
+    NDArray<double> x('c', {rows, width});
+    for (int r = 0; r < rows; r++)
+        for (int e = 0; e < width; e++)
+            x(r, e) = (double) ((e * 7919 + r * 31) % 1500);
+
+    nd4j::ops::top_k<double> op;
+    auto result = op.execute({&x}, {}, {k, 1});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto v = result->at(0);
+    auto i = result->at(1);
+
+    for (int r = 0; r < rows; r++) {
+        std::vector<std::pair<double, int>> reference(width);
+        for (int e = 0; e < width; e++)
+            reference[e] = std::pair<double, int>(-x(r, e), e);
+
+        std::sort(reference.begin(), reference.end());
+
+        for (int e = 0; e < k; e++) {
+            ASSERT_EQ(-reference[e].first, (*v)(r, e));
+            ASSERT_EQ((double) reference[e].second, (*i)(r, e));
+        }
+    }
+
+    delete result;
+}
+
 //////////////////////////////////////////////////////////////////////
 TEST_F(DeclarableOpsTests5, Test_InTopK_1) {
     NDArray<float> x('c', {2, 3}, {1.0, 11.0, 3.0, 14.0, 5.0, 6.0});
@@ -1178,6 +1240,32 @@ TEST_F(DeclarableOpsTests5, Test_InTopK_3) {
     delete result;
 }
 
+//////////////////////////////////////////////////////////////////////
+TEST_F(DeclarableOpsTests5, Test_InTopK_4) {
+    // target tied with k-th value is in top k, rows with NaN can't be ranked
+    NDArray<float> x('c', {4, 4}, {5.0, 3.0, 3.0, 2.0,
+                                   5.0, 4.0, 4.0, 4.0,
+                                   1.0, 0.0, 2.0, 3.0,
+                                   0.0, 1.0, 2.0, 3.0});
+    x.putScalar(2, 1, std::numeric_limits<float>::quiet_NaN());
+    x.putScalar(3, 0, std::numeric_limits<float>::quiet_NaN());
+
+    NDArray<float> y('c', {4}, {2, 3, 3, 0});
+    NDArray<float> expV('c', {4}, {1, 1, 0, 0});
+
+    nd4j::ops::in_top_k<float> op;
+    auto result = op.execute({&x, &y}, {}, {2});
+
+    ASSERT_EQ(ND4J_STATUS_OK, result->status());
+
+    auto v = result->at(0);
+
+    ASSERT_TRUE(expV.isSameShape(v));
+    ASSERT_TRUE(expV.equalsTo(v));
+
+    delete result;
+}
+
 ///////////////////////////////////////////////////////////
 
 TEST_F(DeclarableOpsTests5, Test_Moments_1) {
@@ -206,6 +206,61 @@ TEST_F(FlatBuffersTest, FlatGraphTest1) {
     delete resultWrapper;
 }
 
+TEST_F(FlatBuffersTest, FlatGraph_Fusion_1) {
+    flatbuffers::FlatBufferBuilder builder(4096);
+
+    NDArray<float> array('c', {5, 5});
+    array.assign(-2.0f);
+
+    auto fShape = builder.CreateVector(array.getShapeInfoAsFlatVector());
+    auto fBuffer = builder.CreateVector(array.asByteVector());
+
+    auto fArray = CreateFlatArray(builder, fShape, fBuffer, nd4j::graph::DataType::DataType_FLOAT);
+    auto fVid = CreateIntPair(builder, -1);
+    auto fVar = CreateFlatVariable(builder, fVid, 0, 0, fArray);
+
+    std::vector<int> in1({-1}), in2({1}), in3({2}), out1({2}), out2({3}), out3({0});
+
+    // abs -> cos -> neg, all of them end up in single fused node 3
+    auto node1 = CreateFlatNode(builder, 1, builder.CreateString("abs"), OpType_TRANSFORM, 0, 0, builder.CreateVector(in1), 0, nd4j::graph::DataType::DataType_FLOAT, builder.CreateVector(out1));
+    auto node2 = CreateFlatNode(builder, 2, builder.CreateString("cos"), OpType_TRANSFORM, 2, 0, builder.CreateVector(in2), 0, nd4j::graph::DataType::DataType_FLOAT, builder.CreateVector(out2));
+    auto node3 = CreateFlatNode(builder, 3, builder.CreateString("neg"), OpType_TRANSFORM, 6, 0, builder.CreateVector(in3), 0, nd4j::graph::DataType::DataType_FLOAT, builder.CreateVector(out3));
+
+    std::vector<flatbuffers::Offset<FlatVariable>> variables_vector({fVar});
+    std::vector<flatbuffers::Offset<FlatNode>> nodes_vector({node1, node2, node3});
+
+    auto configuration = CreateFlatConfiguration(builder, 0, ExecutionMode_SEQUENTIAL, ProfilingMode_NONE, OutputMode_OPTIMIZED);
+    auto flatGraph = CreateFlatGraph(builder, 119, builder.CreateVector(variables_vector), builder.CreateVector(nodes_vector), 0, configuration);
+
+    builder.Finish(flatGraph);
+    uint8_t *buf = builder.GetBufferPointer();
+
+    Graph<float> graph(GetFlatGraph(buf));
+    ASSERT_EQ(1, graph.totalNodes());
+
+    // fused away nodes must be gone from everywhere
+    ASSERT_EQ(1, graph.getAllNodes()->size());
+    ASSERT_EQ(3, graph.getAllNodes()->at(0)->id());
+    ASSERT_FALSE(graph.getVariableSpace()->hasVariable(1));
+    ASSERT_FALSE(graph.getVariableSpace()->hasVariable(2));
+
+    ASSERT_EQ(Status::OK(), GraphExecutioner<float>::execute(&graph));
+
+    // -cos(abs(-2))
+    auto z = graph.getVariableSpace()->getVariable(3)->getNDArray();
+    ASSERT_NEAR(0.4161468, z->meanNumber(), 1e-5);
+
+    // timings are collected over all nodes of the graph
+    auto resultWrapper = GraphExecutioner<float>::executeFlatBuffer((Nd4jPointer) buf);
+    ASSERT_TRUE(resultWrapper != nullptr);
+
+    auto flatResults = GetFlatResult(resultWrapper->pointer());
+    ASSERT_EQ(1, flatResults->timing()->size());
+    ASSERT_EQ(3, flatResults->timing()->Get(0)->id());
+
+    delete resultWrapper;
+}
+
 TEST_F(FlatBuffersTest, ExecutionTest1) {
     auto gA = new Node<float>(OpType_TRANSFORM);
 
@@ -369,6 +424,69 @@ TEST_F(FlatBuffersTest, ReadFile3) {
 }
 
 
+TEST_F(FlatBuffersTest, ReadFile4) {
+    auto graph = GraphExecutioner<float>::importFromMappedFlatBuffers("./resources/adam_sum.fb");
+    Nd4jStatus status = GraphExecutioner<float>::execute(graph);
+
+    ASSERT_EQ(ND4J_STATUS_OK, status);
+
+    auto z = graph->getVariableSpace()->getVariable(2)->getNDArray();
+
+    ASSERT_EQ(1, z->lengthOf());
+    ASSERT_EQ(8, z->getScalar(0));
+
+    delete graph;
+}
+
+TEST_F(FlatBuffersTest, ReadFile_Mapped_1) {
+    auto graphA = GraphExecutioner<float>::importFromFlatBuffers("./resources/mnist_00.fb");
+    auto graphB = GraphExecutioner<float>::importFromMappedFlatBuffers("./resources/mnist_00.fb");
+
+    ASSERT_EQ(Status::OK(), GraphExecutioner<float>::execute(graphA));
+    ASSERT_EQ(Status::OK(), GraphExecutioner<float>::execute(graphB));
+
+    auto zA = graphA->getVariableSpace()->getVariable(6, 0)->getNDArray();
+    auto zB = graphB->getVariableSpace()->getVariable(6, 0)->getNDArray();
+
+    ASSERT_TRUE(zA->isSameShape(zB));
+    ASSERT_TRUE(zA->equalsTo(zB));
+
+    // weights must be views over the mapped file
+    int views = 0;
+    for (auto v: graphB->getVariableSpace()->getVariables()) {
+        auto storage = v->getStorage();
+        if (storage == nullptr || v->id() >= 0)
+            continue;
+
+        auto buffer = reinterpret_cast<uint8_t *>(v->getNDArray()->getBuffer());
+        ASSERT_TRUE(buffer >= storage->data());
+        ASSERT_TRUE(buffer + v->getNDArray()->lengthOf() * sizeof(float) <= storage->data() + storage->length());
+        views++;
+    }
+
+    ASSERT_TRUE(views > 0);
+
+    // clones get their own copies, so in-place writes in one of them can't leak into others
+    auto clonedSpace = graphB->getVariableSpace()->clone();
+    for (auto v: graphB->getVariableSpace()->getVariables()) {
+        auto storage = v->getStorage();
+        if (storage == nullptr || v->id() >= 0)
+            continue;
+
+        auto c = clonedSpace->getVariable(v->id(), v->index());
+        ASSERT_TRUE(c->getStorage() == nullptr);
+        ASSERT_TRUE(c->getNDArray()->getBuffer() != v->getNDArray()->getBuffer());
+        ASSERT_TRUE(c->getNDArray()->equalsTo(v->getNDArray()));
+
+        c->getNDArray()->assign(119.f);
+        ASSERT_FALSE(c->getNDArray()->equalsTo(v->getNDArray()));
+    }
+
+    delete clonedSpace;
+    delete graphA;
+    delete graphB;
+}
+
 TEST_F(FlatBuffersTest, ReadInception1) {
     auto graph = GraphExecutioner<float>::importFromFlatBuffers("./resources/inception.fb");
 
@@ -15,6 +15,7 @@
  ******************************************************************************/
 
 #include "testlayers.h"
+#include <array>
 #include <graph/RandomGenerator.h>
 #include <array/DataTypeUtils.h>
 #include <graph/Graph.h>
@@ -27,6 +27,8 @@
 #include <graph/GraphUtils.h>
 #include <NDArray.h>
 #include <ops/declarable/DeclarableOp.h>
+#include <ops/declarable/LegacyFusedOp.h>
+#include <graph/MemoryPlanner.h>
 #include <ops/declarable/generic/parity_ops.cpp>
 
 using namespace nd4j;
@@ -1589,6 +1591,187 @@ TEST_F(GraphTests, Test_Inplace_Outputs_2) {
 #endif
 }
 
+TEST_F(GraphTests, Test_Parallel_Execution_1) {
+    auto build = [] (ExecutionMode mode) -> Graph<float>* {
+        auto graph = new Graph<float>();
+        graph->getExecutorConfiguration()->_executionMode = mode;
+
+        auto x = new NDArray<float>('c', {5, 5});
+        x->assign(-2.0);
+
+        graph->getVariableSpace()->putVariable(-1, x);
+
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2, 3, 6}));
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 14, 2, {1}, {5}));
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 2, 3, {1}, {4}));
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 4, {3}, {5}));
+        graph->addNode(new Node<float>(OpType_PAIRWISE, 0, 5, {2, 4}, {6}));
+        graph->addNode(new Node<float>(OpType_PAIRWISE, 0, 6, {5, 1}, {}));
+
+        return graph;
+    };
+
+    auto sequential = build(ExecutionMode_SEQUENTIAL);
+    auto parallel = build(ExecutionMode_AUTO);
+
+    FlowPath flowS;
+    FlowPath flowP;
+    sequential->getVariableSpace()->setFlowPath(&flowS);
+    parallel->getVariableSpace()->setFlowPath(&flowP);
+
+    ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(sequential));
+    ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(parallel));
+
+    ASSERT_FALSE(flowS.wasParallel());
+    ASSERT_TRUE(flowP.wasParallel());
+
+    for (int e = 1; e <= 6; e++) {
+        ASSERT_TRUE(parallel->getVariableSpace()->hasVariable(e));
+
+        auto exp = sequential->getVariableSpace()->getVariable(e)->getNDArray();
+        auto z = parallel->getVariableSpace()->getVariable(e)->getNDArray();
+
+        ASSERT_TRUE(exp->equalsTo(z));
+    }
+
+    auto z = parallel->getVariableSpace()->getVariable(6)->getNDArray();
+    ASSERT_NEAR(3.8303574, z->reduceNumber<simdOps::Mean<float>>(), 1e-5);
+
+    sequential->getVariableSpace()->setFlowPath(nullptr);
+    parallel->getVariableSpace()->setFlowPath(nullptr);
+
+    delete sequential;
+    delete parallel;
+}
+
+TEST_F(GraphTests, Test_Parallel_Execution_2) {
+    auto build = [] (ExecutionMode mode) -> Graph<float>* {
+        auto graph = new Graph<float>();
+        graph->getExecutorConfiguration()->_executionMode = mode;
+
+        auto x = new NDArray<float>('c', {5, 5});
+        x->assign(-2.0);
+
+        auto y = new NDArray<float>('c', {5, 5});
+        y->assign(-1.0);
+
+        auto z = new NDArray<float>('c', {5, 5});
+
+        graph->getVariableSpace()->putVariable(-1, x);
+        graph->getVariableSpace()->putVariable(-2, y);
+        graph->getVariableSpace()->putVariable(-3, z);
+
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {3}));
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 2, {-2}, {3}));
+        graph->addNode(new Node<float>(OpType_PAIRWISE, 0, 3, {1, 2}, {-3}));
+
+        return graph;
+    };
+
+    auto sequential = build(ExecutionMode_SEQUENTIAL);
+    auto parallel = build(ExecutionMode_AUTO);
+
+    FlowPath flowP;
+    parallel->getVariableSpace()->setFlowPath(&flowP);
+
+    ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(sequential));
+    ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(parallel));
+
+    ASSERT_TRUE(flowP.wasParallel());
+
+    auto exp = sequential->getVariableSpace()->getVariable(-3)->getNDArray();
+    auto z = parallel->getVariableSpace()->getVariable(-3)->getNDArray();
+
+    ASSERT_TRUE(exp->equalsTo(z));
+    ASSERT_NEAR(3.0, z->reduceNumber<simdOps::Mean<float>>(), 1e-5);
+
+    parallel->getVariableSpace()->setFlowPath(nullptr);
+
+    delete sequential;
+    delete parallel;
+}
+
+TEST_F(GraphTests, Test_Parallel_Execution_3) {
+    auto build = [] (ExecutionMode mode) -> Graph<float>* {
+        auto graph = new Graph<float>();
+        graph->getExecutorConfiguration()->_executionMode = mode;
+
+        auto x = new NDArray<float>('c', {5, 5});
+        x->assign(-2.0);
+
+        graph->getVariableSpace()->putVariable(-1, x);
+
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2, 3}));
+
+        // OneMinus overwrites output of Node_1, while Node_3 reads it within the same layer
+        auto nodeA = new Node<float>(OpType_TRANSFORM, 35, 2, {1}, {4});
+        nodeA->markInplace(true);
+
+        auto nodeB = new Node<float>(OpType_TRANSFORM, 0, 3, {1}, {4});
+        nodeB->markInplace(false);
+
+        graph->addNode(nodeA);
+        graph->addNode(nodeB);
+        graph->addNode(new Node<float>(OpType_PAIRWISE, 0, 4, {2, 3}, {}));
+
+        return graph;
+    };
+
+    auto sequential = build(ExecutionMode_SEQUENTIAL);
+
+    ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(sequential));
+
+    auto exp = sequential->getVariableSpace()->getVariable(4)->getNDArray();
+    ASSERT_NEAR(0.0, exp->reduceNumber<simdOps::Mean<float>>(), 1e-5);
+
+    // ordering of in-place writer against reader is the only thing that keeps result stable
+    for (int e = 0; e < 20; e++) {
+        auto parallel = build(ExecutionMode_AUTO);
+
+        FlowPath flowP;
+        parallel->getVariableSpace()->setFlowPath(&flowP);
+
+        ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(parallel));
+        ASSERT_TRUE(flowP.wasParallel());
+
+        auto z = parallel->getVariableSpace()->getVariable(4)->getNDArray();
+        ASSERT_TRUE(exp->equalsTo(z));
+
+        parallel->getVariableSpace()->setFlowPath(nullptr);
+        delete parallel;
+    }
+
+    delete sequential;
+}
+
+TEST_F(GraphTests, Test_Dense_Slots_1) {
+    auto graph = new Graph<float>();
+
+    auto x = new NDArray<float>('c', {5, 5});
+    x->assign(-2.0);
+
+    graph->getVariableSpace()->putVariable(-1, x);
+
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2, 3}));
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 14, 2, {1}, {3}));
+    graph->addNode(new Node<float>(OpType_PAIRWISE, 0, 3, {2, 1}, {}));
+
+    ASSERT_EQ(ND4J_STATUS_OK, graph->buildGraph());
+
+    auto block = graph->nodeById(3)->getContextPrototype();
+    ASSERT_EQ(2, block->inputSlots()->size());
+    ASSERT_TRUE(block->inputSlots()->at(0) >= 0);
+    ASSERT_NE(block->inputSlots()->at(0), block->inputSlots()->at(1));
+
+    ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(graph));
+    ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(graph));
+
+    auto z = graph->getVariableSpace()->getVariable(3)->getNDArray();
+    ASSERT_NEAR(2.0f + nd4j::math::nd4j_sqrt<float>(2.0f), z->reduceNumber<simdOps::Mean<float>>(), 1e-5);
+
+    delete graph;
+}
+
 TEST_F(GraphTests, Test_Minifier_1) {
     // run preprocessor to produce single header
     // if all ok - return value is 0, if error - non-zero value will be returned
@@ -1623,3 +1806,206 @@ TEST_F(GraphTests, Test_Minifier_3) {
     //ASSERT_EQ(0, unlink("libnd4j_mini3.hpp"));
 
 }
+
+TEST_F(GraphTests, Test_Elementwise_Fusion_1) {
+    auto graph = new Graph<float>();
+    graph->getExecutorConfiguration()->_outputMode = OutputMode_OPTIMIZED;
+
+    // 10000 elements, so fused node goes through more than one block
+    auto x = new NDArray<float>('c', {100, 100});
+    x->linspace(1);
+
+    auto y = new NDArray<float>('c', {100, 100});
+    y->assign(0.5f);
+
+    NDArray<float> exp('c', {100, 100});
+    for (int e = 0; e < exp.lengthOf(); e++)
+        exp.putScalar(e, nd4j::math::nd4j_abs<float>(0.5f - nd4j::math::nd4j_max<float>(0.f, (*x)(e) - 5000.f)));
+
+    graph->getVariableSpace()->putVariable(-1, x);
+    graph->getVariableSpace()->putVariable(-2, y);
+
+    // x - 5000
+    auto nodeA = new Node<float>(OpType_SCALAR, 1, 1, {-1}, {2}, {}, 5000.f);
+    // relu
+    auto nodeB = new Node<float>(OpType_TRANSFORM, 33, 2, {1}, {3}, {}, 0.0f, {0.0f});
+    // y - relu, chain value is the second operand here
+    auto nodeC = new Node<float>(OpType_PAIRWISE, 9, 3, {-2, 2}, {4});
+    // abs
+    auto nodeD = new Node<float>(OpType_TRANSFORM, 0, 4, {3}, {});
+
+    graph->addNode(nodeA);
+    graph->addNode(nodeB);
+    graph->addNode(nodeC);
+    graph->addNode(nodeD);
+
+    ASSERT_EQ(1, graph->totalNodes());
+
+    auto fused = dynamic_cast<nd4j::ops::LegacyFusedOp<float>*>(graph->nodeById(4)->getCustomOp());
+    ASSERT_TRUE(fused != nullptr);
+    ASSERT_EQ(4, fused->stages()->size());
+    ASSERT_TRUE(fused->stages()->at(2).operandFirst);
+
+    auto status = GraphExecutioner<float>::execute(graph);
+    ASSERT_EQ(Status::OK(), status);
+
+    auto z = graph->getVariableSpace()->getVariable(4)->getNDArray();
+
+    ASSERT_TRUE(exp.isSameShape(z));
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    delete graph;
+}
+
+TEST_F(GraphTests, Test_Elementwise_Fusion_2) {
+    auto graph = new Graph<float>();
+    graph->getExecutorConfiguration()->_outputMode = OutputMode_OPTIMIZED;
+
+    auto x = new NDArray<float>('c', {5, 5});
+    x->assign(-2.0);
+
+    graph->getVariableSpace()->putVariable(-1, x);
+
+    // node 2 has two consumers, so it ends one chain and can't be absorbed into another
+    auto nodeA = new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2});
+    auto nodeB = new Node<float>(OpType_TRANSFORM, 14, 2, {1}, {3, 5});
+    auto nodeC = new Node<float>(OpType_SCALAR, 0, 3, {2}, {4}, {}, 1.0f);
+    auto nodeD = new Node<float>(OpType_TRANSFORM, 6, 4, {3}, {5});
+    auto nodeE = new Node<float>(OpType_PAIRWISE, 0, 5, {2, 4}, {});
+
+    graph->addNode(nodeA);
+    graph->addNode(nodeB);
+    graph->addNode(nodeC);
+    graph->addNode(nodeD);
+    graph->addNode(nodeE);
+
+    // 1 -> 2 and 3 -> 4 -> 5 are fused separately
+    ASSERT_EQ(2, graph->totalNodes());
+
+    auto status = GraphExecutioner<float>::execute(graph);
+    ASSERT_EQ(Status::OK(), status);
+
+    // sqrt(abs(-2)) + -(sqrt(2) + 1) = -1
+    auto z = graph->getVariableSpace()->getVariable(5)->getNDArray();
+    ASSERT_NEAR(-1.0f, z->meanNumber(), 1e-5);
+
+    delete graph;
+}
+
+TEST_F(GraphTests, Test_Memory_Planner_1) {
+    MemoryPlanner planner;
+
+    // a and c never live at the same time, b overlaps with both
+    auto a = planner.addBuffer(100, 0, 1);
+    auto b = planner.addBuffer(100, 1, 2);
+    auto c = planner.addBuffer(100, 2, 3);
+
+    ASSERT_EQ(256, planner.plan());
+    // each buffer is padded to 64 bytes alignment
+    ASSERT_EQ(384, planner.totalSize());
+    ASSERT_EQ(planner.offset(a), planner.offset(c));
+    ASSERT_NE(planner.offset(a), planner.offset(b));
+}
+
+TEST_F(GraphTests, Test_Memory_Planner_2) {
+    auto softmaxChain = [] (OutputMode outputMode) -> Graph<float>* {
+        auto graph = new Graph<float>();
+        graph->getExecutorConfiguration()->_outputMode = outputMode;
+
+        auto x = new NDArray<float>('c', {10, 10});
+        x->linspace(1);
+
+        graph->getVariableSpace()->putVariable(-1, x);
+
+        // softmax isn't fusable, so chain stays as is
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 38, 1, {-1}, {2}));
+        for (int e = 2; e <= 5; e++)
+            graph->addNode(new Node<float>(OpType_TRANSFORM, 38, e, {e - 1}, {}));
+
+        return graph;
+    };
+
+    auto planned = softmaxChain(OutputMode_OPTIMIZED);
+    auto plain = softmaxChain(OutputMode_IMPLICIT);
+
+    ASSERT_EQ(Status::OK(), GraphExecutioner<float>::execute(plain));
+    ASSERT_FALSE(plain->planMemory());
+    ASSERT_EQ(0, plain->plannedMemory());
+
+    auto exp = plain->getVariableSpace()->getVariable(5)->getNDArray();
+
+    Nd4jLong outputsSize = 0;
+    for (int e = 1; e <= 5; e++)
+        outputsSize += plain->getVariableSpace()->getVariable(e)->getNDArray()->lengthOf() * (Nd4jLong) sizeof(float);
+
+    // first run builds the plan, second one executes within it
+    for (int r = 0; r < 2; r++) {
+        auto status = GraphExecutioner<float>::execute(planned);
+        ASSERT_EQ(Status::OK(), status);
+
+        auto z = planned->getVariableSpace()->getVariable(5)->getNDArray();
+        ASSERT_TRUE(exp->isSameShape(z));
+        // planned arena must not change a single bit of the result
+        ASSERT_TRUE(exp->equalsTo(z, 0.0f));
+    }
+
+    ASSERT_TRUE(planned->plannedMemory() > 0);
+    ASSERT_TRUE(planned->plannedMemory() < outputsSize);
+
+    delete planned;
+    delete plain;
+}
+
+TEST_F(GraphTests, Test_Memory_Planner_3) {
+    nd4j::ops::softmax<float> softmax;
+    nd4j::ops::tanh<float> tanh;
+
+    auto customChain = [&] (OutputMode outputMode) -> Graph<float>* {
+        auto graph = new Graph<float>();
+        graph->getExecutorConfiguration()->_outputMode = outputMode;
+
+        auto x = new NDArray<float>('c', {10, 10});
+        x->linspace(1);
+
+        graph->getVariableSpace()->putVariable(-1, x);
+
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 38, 1, {-1}, {2}));
+
+        // shapes of custom ops fed by other nodes can't be inferred before first run
+        for (int e = 2; e <= 5; e++) {
+            auto node = new Node<float>(OpType_CUSTOM, 0, e, {e - 1}, {});
+            node->setCustomOp(e % 2 == 0 ? (nd4j::ops::DeclarableOp<float> *) &softmax : (nd4j::ops::DeclarableOp<float> *) &tanh);
+            graph->addNode(node);
+        }
+
+        return graph;
+    };
+
+    auto planned = customChain(OutputMode_OPTIMIZED);
+    auto plain = customChain(OutputMode_IMPLICIT);
+
+    ASSERT_EQ(Status::OK(), GraphExecutioner<float>::execute(plain));
+
+    // first run only records shapes, so every output of it must stay intact
+    ASSERT_EQ(Status::OK(), GraphExecutioner<float>::execute(planned));
+    ASSERT_EQ(0, planned->plannedMemory());
+
+    for (int e = 1; e <= 5; e++) {
+        auto exp = plain->getVariableSpace()->getVariable(e)->getNDArray();
+        auto z = planned->getVariableSpace()->getVariable(e)->getNDArray();
+
+        ASSERT_TRUE(z != nullptr);
+        ASSERT_TRUE(exp->equalsTo(z, 0.0f));
+    }
+
+    // second run executes within plan built from recorded shapes
+    ASSERT_EQ(Status::OK(), GraphExecutioner<float>::execute(planned));
+    ASSERT_TRUE(planned->plannedMemory() > 0);
+
+    auto exp = plain->getVariableSpace()->getVariable(5)->getNDArray();
+    auto z = planned->getVariableSpace()->getVariable(5)->getNDArray();
+    ASSERT_TRUE(exp->equalsTo(z, 0.0f));
+
+    delete planned;
+    delete plain;
+}
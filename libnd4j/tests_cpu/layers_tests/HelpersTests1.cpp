@@ -1918,3 +1918,71 @@ TEST_F(HelpersTests1, checkGrad_test6) {
     ASSERT_TRUE(isGradCorrect);
 }
 
+
+///////////////////////////////////////////////////////////////////
+TEST_F(HelpersTests1, gemmFallback_test1) {
+    const int M = 37, N = 70, K = 300;
+
+    NDArray<double> a('f', {M, K});
+    NDArray<double> b('c', {K, N});
+    NDArray<double> exp('f', {M, N});
+    NDArray<float> c('f', {M, N});
+
+    a.linspace(-1., 0.01);
+    b.linspace(1., -0.003);
+
+    // reference product, computed directly
+    for (int r = 0; r < M; r++)
+        for (int cl = 0; cl < N; cl++) {
+            double dot = 0.;
+            for (int k = 0; k < K; k++)
+                dot += a(r, k) * b(k, cl);
+            exp(r, cl) = dot;
+        }
+
+    NDArray<float> af('f', {M, K});
+    NDArray<float> bf('c', {K, N});
+    for (int e = 0; e < a.lengthOf(); e++)
+        af(e) = (float) a(e);
+    for (int e = 0; e < b.lengthOf(); e++)
+        bf(e) = (float) b(e);
+
+    c.assign(1.f);
+    nd4j::blas::GEMM<float>::op(CblasColMajor, CblasNoTrans, CblasTrans, M, N, K, 2.f, af.getBuffer(), M, bf.getBuffer(), N, 0.5f, c.getBuffer(), M);
+
+    for (int e = 0; e < c.lengthOf(); e++)
+        ASSERT_NEAR(2. * exp(e) + 0.5, c(e), 1e-3 * (1. + nd4j::math::nd4j_abs<double>(exp(e))));
+}
+
+///////////////////////////////////////////////////////////////////
+TEST_F(HelpersTests1, gemmFallback_test2) {
+    NDArray<double> a('c', {40, 300});
+    NDArray<double> b('c', {300, 70});
+    a.linspace(-1., 0.0001);
+    b.linspace(1., -0.0001);
+
+    NDArray<float16> ah('c', {40, 300});
+    NDArray<float16> bh('c', {300, 70});
+    // reference uses exactly the same (rounded) inputs
+    for (int e = 0; e < a.lengthOf(); e++) {
+        ah(e) = (float16) a(e);
+        a(e) = (float) ah(e);
+    }
+    for (int e = 0; e < b.lengthOf(); e++) {
+        bh(e) = (float16) b(e);
+        b(e) = (float) bh(e);
+    }
+
+    // half has no BLAS, so fallback GEMM is used with fp32 accumulation
+    auto exp = MmulHelper<double>::mmul(&a, &b);
+    auto z = MmulHelper<float16>::mmul(&ah, &bh);
+
+    ASSERT_EQ(exp->rows(), z->rows());
+    ASSERT_EQ(exp->columns(), z->columns());
+    for (int r = 0; r < z->rows(); r++)
+        for (int c = 0; c < z->columns(); c++)
+            ASSERT_NEAR((*exp)(r, c), (float) (*z)(r, c), 1e-2 * (1. + nd4j::math::nd4j_abs<double>((*exp)(r, c))));
+
+    delete exp;
+    delete z;
+}
@@ -24,6 +24,7 @@
 #include <ops/declarable/OpRegistrator.h>
 #include <graph/GraphHolder.h>
 #include <graph/FlatUtils.h>
+#include <ops/aggregate_ops.h>
 #include "testlayers.h"
 #include <array>
 
@@ -863,4 +864,99 @@ TEST_F(JavaInteropTests, Test_NLP_Aggregations_1) {
 
 
     ops.execAggregateBatchFloat(nullptr, numAggregates, opNum, maxArgs, maxShapes, maxIntArrays, maxIntArraySize, maxIndexArguments, maxRealArguments, pointer.data());
-}
\ No newline at end of file
+}
+
+TEST_F(JavaInteropTests, Test_NLP_Aggregations_2) {
+    const int vectorLength = 16;
+    const int vocabSize = 10;
+    const int expLength = 1000;
+    const int ngRounds = 4;
+    const int negTableLength = 20;
+    const float alpha = 0.025f;
+    const unsigned long long seed = 119;
+
+    std::vector<float> syn0(vocabSize * vectorLength);
+    std::vector<float> syn1(vocabSize * vectorLength, 0.0f);
+    std::vector<float> syn1Neg(vocabSize * vectorLength);
+    std::vector<float> exp(expLength);
+    std::vector<float> negTable(negTableLength);
+    std::vector<float> inference(vectorLength, 0.0f);
+
+    for (size_t e = 0; e < syn0.size(); e++) {
+        syn0[e] = static_cast<float>((e * 7) % 13 - 6) / 100.f;
+        syn1Neg[e] = static_cast<float>((e * 5) % 11 - 5) / 50.f;
+    }
+
+    for (int e = 0; e < expLength; e++) {
+        auto tmp = nd4j::math::nd4j_exp<double>((static_cast<double>(e) / expLength * 2.0 - 1.0) * 6.0);
+        exp[e] = static_cast<float>(tmp / (tmp + 1.0));
+    }
+
+    for (int e = 0; e < negTableLength; e++)
+        negTable[e] = static_cast<float>(e % vocabSize);
+
+    // reference: plain word2vec negative sampling for row 2 against starter 5
+    auto refSyn0 = syn0;
+    auto refSyn1Neg = syn1Neg;
+    auto referenceStep = [&] () {
+        std::vector<float> neu1e(vectorLength, 0.0f);
+        auto next_random = seed;
+        float *row = refSyn0.data() + 2 * vectorLength;
+        for (int r = 0; r < ngRounds + 1; r++) {
+            int target = 5;
+            int label = 1;
+            if (r > 0) {
+                next_random = next_random * (unsigned long long) 25214903917 + 11;
+                target = static_cast<int>(negTable[(next_random >> 16) % negTableLength]);
+                if (target <= 0 || target >= vocabSize) target = next_random % (vocabSize - 1) + 1;
+                if (target == 5)
+                    continue;
+                label = 0;
+            }
+
+            float *neg = refSyn1Neg.data() + target * vectorLength;
+            float dot = 0.0f;
+            for (int x = 0; x < vectorLength; x++)
+                dot += row[x] * neg[x];
+
+            float g;
+            if (dot > HS_MAX_EXP)
+                g = (label - 1) * alpha;
+            else if (dot < -HS_MAX_EXP)
+                g = label * alpha;
+            else
+                g = (label - exp[static_cast<int>((dot + HS_MAX_EXP) * (expLength / HS_MAX_EXP / 2.0f))]) * alpha;
+
+            for (int x = 0; x < vectorLength; x++) {
+                neu1e[x] += g * neg[x];
+                neg[x] += g * row[x];
+            }
+        }
+
+        for (int x = 0; x < vectorLength; x++)
+            row[x] += neu1e[x];
+    };
+
+    float *arguments[] = {syn0.data(), syn1.data(), exp.data(), syn1Neg.data(), negTable.data(), inference.data()};
+    int indexArguments[] = {2, vectorLength, 0, ngRounds, expLength, vocabSize, 5, negTableLength, 0};
+    int idxSyn1[] = {0};
+    int codes[] = {0};
+    int *intArrays[] = {idxSyn1, codes};
+    float realArguments[] = {alpha, static_cast<float>(seed)};
+
+    // scratch is dirty before the first call, and second call reuses whatever first one left there
+    aggregateOps::Word2VecScratch<float> scratch;
+    auto dirty = scratch.neu1e(vectorLength);
+    for (int x = 0; x < vectorLength; x++)
+        dirty[x] = 1.0f;
+
+    for (int c = 0; c < 2; c++) {
+        referenceStep();
+        aggregateOps::SkipGram<float>::executeAggregate(arguments, 6, nullptr, 0, indexArguments, 9, intArrays, 2, realArguments, 2, scratch);
+
+        for (size_t e = 0; e < syn0.size(); e++) {
+            ASSERT_NEAR(refSyn0[e], syn0[e], 1e-5f);
+            ASSERT_NEAR(refSyn1Neg[e], syn1Neg[e], 1e-5f);
+        }
+    }
+}
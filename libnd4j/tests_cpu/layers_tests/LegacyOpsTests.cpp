@@ -26,6 +26,7 @@
 #include <ops/declarable/LegacyReduceOp.h>
 #include <ops/declarable/LegacyIndexReduceOp.h>
 #include <ops/declarable/LegacyBroadcastOp.h>
+#include <helpers/StridedIterator.h>
 
 using namespace nd4j;
 using namespace nd4j::ops;
@@ -234,6 +235,156 @@ TEST_F(LegacyOpsTests, ReduceTests_4) {
 }
 
 
+TEST_F(LegacyOpsTests, ReduceTests_5) {
+    NDArray<float> x('c', {4, 3, 5});
+    x.linspace(1);
+
+    // permuted view has no elementwise stride, so TADs are walked with strided iterator
+    x.permutei({2, 0, 1});
+    auto xC = x.dup('c');
+
+    auto exp = xC->template reduceAlongDims<simdOps::Sum<float>>({0, 2});
+    auto z = x.template reduceAlongDims<simdOps::Sum<float>>({0, 2});
+
+    ASSERT_TRUE(exp.isSameShape(z));
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    auto expIdx = xC->template applyIndexReduce<simdOps::IndexMax<float>>({0, 2});
+    auto zIdx = x.template applyIndexReduce<simdOps::IndexMax<float>>({0, 2});
+
+    ASSERT_TRUE(expIdx->equalsTo(zIdx));
+
+    delete expIdx;
+    delete zIdx;
+    delete xC;
+}
+
+
+TEST_F(LegacyOpsTests, ReduceTests_6) {
+    NDArray<float> x('c', {4, 3, 5});
+    x.linspace(1);
+    x.permutei({2, 0, 1});
+    auto xC = x.dup('c');
+
+    // summary stats over TADs of permuted view
+    auto exp = xC->template varianceAlongDimension<simdOps::SummaryStatsVariance<float>>(true, {0, 2});
+    auto z = x.template varianceAlongDimension<simdOps::SummaryStatsVariance<float>>(true, {0, 2});
+
+    ASSERT_TRUE(exp->isSameShape(z));
+    ASSERT_TRUE(exp->equalsTo(z));
+
+    // and over whole permuted view
+    auto expS = xC->template varianceNumber<simdOps::SummaryStatsStandardDeviation<float>>(false);
+    auto zS = x.template varianceNumber<simdOps::SummaryStatsStandardDeviation<float>>(false);
+
+    ASSERT_NEAR(expS, zS, 1e-4);
+
+    delete exp;
+    delete z;
+    delete xC;
+}
+
+TEST_F(LegacyOpsTests, Reduce3Tests_1) {
+    // x is bigger than y, so each x TAD is compared against whole y
+    NDArray<double> x('c', {3, 2, 4});
+    NDArray<double> y('c', {1, 2, 4});
+    x.linspace(1);
+    y.linspace(-2, 0.5);
+
+    NDArray<double> exp('c', {3});
+    for (int i = 0; i < 3; i++) {
+        double sum = 0.;
+        for (int j = 0; j < 2; j++)
+            for (int k = 0; k < 4; k++)
+                sum += nd4j::math::nd4j_abs<double>(x.getScalar(i * 8 + j * 4 + k) - y.getScalar(j * 4 + k));
+        exp.putScalar(i, sum);
+    }
+
+    auto z = x.template applyReduce3<simdOps::ManhattanDistance<double>>(&y, {1, 2});
+
+    ASSERT_EQ(3, z->lengthOf());
+    for (int i = 0; i < 3; i++)
+        ASSERT_NEAR(exp.getScalar(i), z->getScalar(i), 1e-8);
+
+    delete z;
+}
+
+TEST_F(LegacyOpsTests, Reduce3Tests_2) {
+    NDArray<double> x('c', {4, 3, 5});
+    NDArray<double> y('c', {4, 3, 5});
+    x.linspace(1);
+    y.linspace(3, -0.25);
+
+    // permuted views have no elementwise stride, so both sides are walked with strided iterator
+    x.permutei({2, 0, 1});
+    y.permutei({2, 0, 1});
+    auto xC = x.dup('c');
+    auto yC = y.dup('c');
+
+    NDArray<double> exp('c', {4}, {33.480404716789195, 100.95172113441157, 172.6512018492776, 244.89283370486774});
+
+    auto zC = xC->template applyReduce3<simdOps::EuclideanDistance<double>>(yC, {0, 2});
+    auto z = x.template applyReduce3<simdOps::EuclideanDistance<double>>(&y, {0, 2});
+
+    ASSERT_TRUE(exp.isSameShape(zC));
+    ASSERT_TRUE(exp.equalsTo(zC));
+
+    ASSERT_TRUE(exp.isSameShape(z));
+    ASSERT_TRUE(exp.equalsTo(z));
+
+    delete zC;
+    delete z;
+    delete xC;
+    delete yC;
+}
+
+TEST_F(LegacyOpsTests, StridedIterator_1) {
+    // [2, 3, 4] 'c' permuted to [3, 4, 2] with strides [4, 1, 12]: first two dimensions are contiguous and get merged
+    Nd4jLong shape[] = {3, 4, 2};
+    Nd4jLong stride[] = {4, 1, 12};
+    const Nd4jLong length = 24;
+
+    // merging happens in visiting order, so 'f' order has nothing to merge here
+    ASSERT_EQ(2, StridedIterator(3, shape, stride).rank());
+    ASSERT_EQ(3, StridedIterator(3, shape, stride, 0, 0, 'f').rank());
+
+    for (char order: {'c', 'f'}) {
+        for (Nd4jLong start: {0L, 5L, 17L}) {
+            StridedIterator it(3, shape, stride, 7, start, order);
+            Nd4jLong coord[3];
+
+            for (Nd4jLong i = start; i < length; i++, it.next()) {
+                if (order == 'c')
+                    shape::ind2subC(3, shape, i, length, coord);
+                else
+                    shape::ind2sub(3, shape, i, length, coord);
+
+                ASSERT_EQ(shape::getOffset(7, shape, stride, coord, 3), it.offset());
+            }
+        }
+    }
+}
+
+TEST_F(LegacyOpsTests, StridedIterator_2) {
+    // contiguous 'f' array collapses into single dimension in 'f' order, unit dimension is dropped
+    Nd4jLong shape[] = {2, 1, 3, 4};
+    Nd4jLong stride[] = {1, 2, 2, 6};
+
+    StridedIterator itF(4, shape, stride, 0, 0, 'f');
+    ASSERT_EQ(1, itF.rank());
+    for (Nd4jLong i = 0; i < 24; i++, itF.next())
+        ASSERT_EQ(i, itF.offset());
+
+    // same array in 'c' order walks with stride 6 first
+    StridedIterator itC(4, shape, stride);
+    Nd4jLong coord[4];
+    for (Nd4jLong i = 0; i < 24; i++, itC.next()) {
+        shape::ind2subC(4, shape, i, 24, coord);
+        ASSERT_EQ(shape::getOffset(0, shape, stride, coord, 4), itC.offset());
+    }
+}
+
+
 TEST_F(LegacyOpsTests, IndexReduceTests_1) {
     NDArray<double> x('c', {5, 5});
     x.linspace(1);
@@ -295,6 +446,25 @@ TEST_F(LegacyOpsTests, BroadcastingTests_1) {
     delete list;
 }
 
+TEST_F(LegacyOpsTests, BroadcastingTests_2) {
+    NDArray<double> x('c', {4, 3, 5});
+    NDArray<double> y('c', {4, 3});
+    x.linspace(1);
+    y.linspace(-1, 0.5);
+
+    // broadcast along several dimensions of permuted view goes through strided branch
+    x.permutei({2, 0, 1});
+    auto exp = x.dup('c');
+    exp->template applyBroadcast<simdOps::Multiply<double>>({1, 2}, &y);
+
+    x.template applyBroadcast<simdOps::Multiply<double>>({1, 2}, &y);
+
+    ASSERT_TRUE(exp->isSameShape(&x));
+    ASSERT_TRUE(exp->equalsTo(&x));
+
+    delete exp;
+}
+
 TEST_F(LegacyOpsTests, PowDerivative_1) {
     NDArray<float> x('c', {5, 5});
     NDArray<float> exp('c', {5, 5});
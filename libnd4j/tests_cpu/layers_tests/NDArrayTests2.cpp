@@ -21,6 +21,7 @@
 #include "testlayers.h"
 #include <memory>
 #include <NDArray.h>
+#include <array/NDArrayExpression.h>
 
 using namespace nd4j;
 
@@ -786,4 +787,66 @@ TEST_F(NDArrayTest2, allTensorsAlongDimension_test1) {
     ASSERT_TRUE(exp.equalsTo(set->at(0)));
 
     delete set;
-}
\ No newline at end of file
+}
+
+////////////////////////////////////////////////////////////////////
+TEST_F(NDArrayTest2, Expression_test1) {
+
+    NDArray<float> x('c', {3, 4});
+    NDArray<float> y('f', {3, 4});
+    NDArray<float> b('c', {1, 4}, {1, 2, 3, 4});
+    x.linspace(1);
+    y.linspace(-3);
+
+    // eager reference
+    NDArray<float> exp = (x * y + b) / 2.f - 1.f;
+
+    NDArray<float> z('c', {3, 4});
+    z.assign((expr::lazy(x) * y + b) / 2.f - 1.f);
+
+    ASSERT_TRUE(exp.equalsTo(&z));
+
+    // same expression, evaluated into 'f' view of a bigger array
+    NDArray<float> big('f', {3, 8});
+    big.assign(0.f);
+    NDArray<float> view = big({0,0, 2,6});
+    view.assign((expr::lazy(x) * y + b) / 2.f - 1.f);
+
+    ASSERT_TRUE(exp.equalsTo(&view));
+    ASSERT_NEAR(0.f, big(0, 0), 1e-5);
+    ASSERT_NEAR(0.f, big(2, 7), 1e-5);
+}
+
+////////////////////////////////////////////////////////////////////
+TEST_F(NDArrayTest2, Expression_test2) {
+
+    NDArray<double> x('c', {2, 3, 4});
+    NDArray<double> b('c', {4}, {0.1, 0.2, 0.3, 0.4});
+    x.linspace(1);
+
+    NDArray<double> exp = x + b;
+    exp.template applyTransform<simdOps::Tanh<double>>();
+    exp = 1. - exp;
+
+    // bias is broadcast, result goes into new array
+    NDArray<double> z = expr::evaluate(1. - expr::transform<simdOps::Tanh<double>>(expr::lazy(x) + b));
+
+    ASSERT_TRUE(exp.isSameShape(&z));
+    ASSERT_TRUE(exp.equalsTo(&z));
+
+    // shortcut gives the same result as generic transform
+    NDArray<double> zTanh = expr::evaluate(1. - expr::tanh(expr::lazy(x) + b));
+    ASSERT_TRUE(exp.equalsTo(&zTanh));
+
+    NDArray<double> expSigmoid = x.template transform<simdOps::Sigmoid<double>>();
+    NDArray<double> zSigmoid = expr::evaluate(expr::sigmoid(expr::lazy(x)));
+    ASSERT_TRUE(expSigmoid.equalsTo(&zSigmoid));
+
+    // flat, in place
+    x.assign(-expr::lazy(x));
+    ASSERT_NEAR(-24., x(23), 1e-10);
+
+    // shapes can't be broadcast
+    NDArray<double> w('c', {3, 5});
+    ASSERT_ANY_THROW(z.assign(expr::lazy(x) + w));
+}
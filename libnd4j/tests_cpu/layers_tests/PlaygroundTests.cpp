@@ -26,6 +26,14 @@
 #include <graph/profiling/GraphProfilingHelper.h>
 #include <type_conversions.h>
 #include <helpers/threshold.h>
+#include <helpers/BlasHelper.h>
+#include <ops/gemm.h>
+#include <graph/GraphHolder.h>
+#include <graph/InferenceRequest.h>
+#include <graph/ExecutionResult.h>
+#include <thread>
+#include <atomic>
+#include <algorithm>
 
 using namespace nd4j;
 using namespace nd4j::graph;
@@ -323,6 +331,131 @@ TEST_F(PlaygroundTests, Test_Profile_2) {
     delete profile;
 }
 
+TEST_F(PlaygroundTests, Test_Profile_Export_1) {
+    GraphProfile profA;
+    GraphProfile profB;
+
+    auto nodeA = profA.nodeById(1, "MatMul");
+    nodeA->setPreparationTime(100);
+    nodeA->setInputTime(20);
+    nodeA->setExecutionTime(1500);
+    nodeA->setTotalTime(1700);
+
+    profB.nodeById(1, "MatMul")->setExecutionTime(500);
+    profB.nodeById(2, "Sum")->setExecutionTime(250);
+
+    profA.trace()->prepare();
+    profB.trace()->prepare();
+    profA.traceNode(1, TracePhase_TOTAL, 1000, 1700);
+    profB.traceNode(1, TracePhase_TOTAL, 5000, 600);
+    profB.traceNode(2, TracePhase_EXECUTION, 5600, 250);
+
+    profA.merge(&profB);
+
+    ASSERT_EQ(3, profA.trace()->size());
+    ASSERT_EQ(2000, profA.nodeById(1)->getExecutionTime());
+    ASSERT_TRUE(profA.nodeExists(2));
+
+    auto trace = profA.asChromeTrace();
+    ASSERT_NE(std::string::npos, trace.find("\"traceEvents\""));
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"Sum:execute\""));
+    // timestamps are relative to first event, in microseconds
+    ASSERT_NE(std::string::npos, trace.find("\"ts\":4.000"));
+
+    auto folded = profA.asFoldedStacks();
+    ASSERT_NE(std::string::npos, folded.find("graph;MatMul#1;execution 2000\n"));
+    ASSERT_NE(std::string::npos, folded.find("graph;MatMul#1;preparation;input 20\n"));
+    ASSERT_NE(std::string::npos, folded.find("graph;Sum#2;execution 250\n"));
+}
+
+TEST_F(PlaygroundTests, Test_Profile_Export_2) {
+    TraceRecorder recorder(4);
+
+    // nothing is recorded until buffer is prepared
+    recorder.record(1, TracePhase_TOTAL, 0, 1);
+    ASSERT_EQ(0, recorder.size());
+
+    recorder.prepare();
+    for (int e = 0; e < 6; e++)
+        recorder.record(e, TracePhase_TOTAL, e * 10, 5);
+
+    auto events = recorder.events();
+    ASSERT_EQ(4, events.size());
+    ASSERT_EQ(2, recorder.dropped());
+    ASSERT_EQ(2, events[0].nodeId);
+    ASSERT_EQ(5, events[3].nodeId);
+}
+
+TEST_F(PlaygroundTests, Test_Profile_Export_3) {
+    TraceRecorder recorder(64);
+    recorder.prepare();
+
+    // readers running next to writers should never see half-written events
+    std::atomic<int> torn(0);
+#pragma omp parallel for num_threads(4) schedule(static, 1)
+    for (int e = 0; e < 20000; e++) {
+        recorder.record(e, TracePhase_EXECUTION, e * 10L, e);
+
+        if (e % 50 == 0)
+            for (auto &event: recorder.events())
+                if (event.start != event.nodeId * 10L || event.duration != event.nodeId)
+                    torn++;
+    }
+
+    ASSERT_EQ(0, torn.load());
+    ASSERT_EQ(64, recorder.size());
+    ASSERT_FALSE(recorder.events().empty());
+}
+
+TEST_F(PlaygroundTests, Test_Profile_Export_5) {
+    TraceRecorder recorder(16);
+    recorder.prepare();
+
+    // plain threads, outside of any OpenMP region, still have to be told apart
+    std::vector<std::thread> threads;
+    for (int e = 0; e < 4; e++)
+        threads.emplace_back([&recorder, e] {
+            recorder.record(e, TracePhase_EXECUTION, e * 10L, 1);
+        });
+
+    for (auto &t: threads)
+        t.join();
+
+    std::vector<int> ids;
+    for (auto &event: recorder.events())
+        ids.emplace_back(event.threadId);
+
+    std::sort(ids.begin(), ids.end());
+    ASSERT_EQ(4, ids.size());
+    ASSERT_TRUE(std::unique(ids.begin(), ids.end()) == ids.end());
+}
+
+TEST_F(PlaygroundTests, Test_Profile_Export_4) {
+    bool profiling = Environment::getInstance()->isProfiling();
+    Environment::getInstance()->setProfiling(false);
+    Environment::getInstance()->setTracing(true);
+
+    auto graph = GraphExecutioner<float>::importFromFlatBuffers("./resources/ae_00.fb");
+    FlowPath flowPath;
+    graph->getVariableSpace()->setFlowPath(&flowPath);
+
+    auto status = GraphExecutioner<float>::execute(graph);
+
+    Environment::getInstance()->setTracing(false);
+    Environment::getInstance()->setProfiling(profiling);
+
+    ASSERT_EQ(Status::OK(), status);
+
+    // tracing alone fills ring buffer, but doesn't build per-node profiles
+    auto events = flowPath.profile()->trace()->events();
+    ASSERT_FALSE(events.empty());
+    for (auto &event: events)
+        ASSERT_FALSE(flowPath.profile()->nodeExists(event.nodeId));
+
+    graph->getVariableSpace()->setFlowPath(nullptr);
+    delete graph;
+}
+
 TEST_F(PlaygroundTests, Test_Im2Col_1) {
     
     int bS=16, iH=224,iW=224,  iC=3,oC=3,  kH=11,kW=11,  sH=4,sW=4,  pH=2,pW=2,  dH=1,dW=1;    
@@ -647,3 +780,115 @@ TEST_F(PlaygroundTests, ndarray_tile_test2) {
     
     ASSERT_TRUE(tiled.isSameShape(&exp)); 
 }
+
+TEST_F(PlaygroundTests, Test_Gemm_Fallback_Benchmark_1) {
+    const int M = 256, N = 256, K = 256;
+
+    NDArray<float> a('f', {M, K});
+    NDArray<float> b('f', {K, N});
+    NDArray<float> c('f', {M, N});
+    NDArray<float> d('f', {M, N});
+    a.linspace(1.f, 0.0001f);
+    b.linspace(-1.f, 0.0001f);
+
+    auto timeStart = std::chrono::system_clock::now();
+    for (int e = 0; e < numIterations; e++)
+        nd4j::blas::GEMM<float>::op(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, a.getBuffer(), M, b.getBuffer(), K, 0.0f, c.getBuffer(), M);
+    auto timeEnd = std::chrono::system_clock::now();
+
+    auto fallbackTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count();
+    // nd4j_printf("Fallback GEMM time: %lld us; GFLOPS: %f\n", fallbackTime / numIterations, 2.0 * M * N * K * numIterations / (fallbackTime * 1000.0));
+
+    if (BlasHelper::getInstance()->template hasGEMM<float>()) {
+        timeStart = std::chrono::system_clock::now();
+        for (int e = 0; e < numIterations; e++)
+            BlasHelper::getInstance()->sgemm()(CblasColMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, a.getBuffer(), M, b.getBuffer(), K, 0.0f, d.getBuffer(), M);
+        timeEnd = std::chrono::system_clock::now();
+
+        auto blasTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count();
+        // nd4j_printf("BLAS GEMM time: %lld us; GFLOPS: %f\n", blasTime / numIterations, 2.0 * M * N * K * numIterations / (blasTime * 1000.0));
+
+        ASSERT_TRUE(c.equalsTo(&d, 1e-3));
+    }
+}
+
+/**
+ * Stand-in for gRPC clients: each client thread serializes FlatInferenceRequest and parses FlatResult,
+ * exactly as GraphServer does, just without network transport. Reports QPS and latency per number of clients.
+ */
+TEST_F(PlaygroundTests, Test_GraphServer_Benchmark_1) {
+    const int numRequests = 50;
+    const int features = 256;
+
+    for (int batching = 0; batching < 2; batching++) {
+        auto graph = new Graph<float>();
+        graph->getVariableSpace()->putVariable(-1, new NDArray<float>('c', {1, features}));
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2}));
+        graph->addNode(new Node<float>(OpType_TRANSFORM, 2, 2, {1}, {}));
+
+        GraphHolder::getInstance()->registerGraph<float>(11990L, graph);
+        if (batching > 0)
+            GraphHolder::getInstance()->enableBatching(11990L, 32, 500L);
+
+        for (int numClients = 1; numClients <= 8; numClients *= 2) {
+            std::vector<std::thread> clients;
+            std::vector<Nd4jLong> latencies(numClients * numRequests);
+            std::atomic<int> failures(0);
+
+            auto timeStart = std::chrono::system_clock::now();
+
+            for (int c = 0; c < numClients; c++) {
+                clients.emplace_back(std::thread([&latencies, &failures, c] {
+                    NDArray<float> input('c', {1, features});
+                    input.linspace(c);
+
+                    NDArray<float> exp('c', {1, features});
+                    input.template applyTransform<simdOps::Abs<float>>(&exp);
+                    exp.template applyTransform<simdOps::Cosine<float>>();
+
+                    for (int r = 0; r < numRequests; r++) {
+                        auto requestStart = std::chrono::system_clock::now();
+
+                        flatbuffers::FlatBufferBuilder requestBuilder(4096);
+                        flatbuffers::FlatBufferBuilder responseBuilder(4096);
+
+                        InferenceRequest<float> ir(11990L);
+                        ir.appendVariable(-1, 0, &input);
+                        requestBuilder.Finish(ir.asFlatInferenceRequest(requestBuilder));
+
+                        auto request = GetFlatInferenceRequest(requestBuilder.GetBufferPointer());
+                        responseBuilder.Finish(GraphHolder::getInstance()->execute(11990L, responseBuilder, request));
+
+                        ExecutionResult<float> result(GetFlatResult(responseBuilder.GetBufferPointer()));
+
+                        auto requestEnd = std::chrono::system_clock::now();
+                        latencies[c * numRequests + r] = std::chrono::duration_cast<std::chrono::microseconds> (requestEnd - requestStart).count();
+
+                        // merged requests must get their own rows back
+                        if (result.size() != 1 || !exp.equalsTo(result.at(0)->getNDArray()))
+                            failures++;
+                    }
+                }));
+            }
+
+            for (auto &t: clients)
+                t.join();
+
+            auto timeEnd = std::chrono::system_clock::now();
+            auto totalTime = std::chrono::duration_cast<std::chrono::microseconds> (timeEnd - timeStart).count();
+
+            std::sort(latencies.begin(), latencies.end());
+            auto p50 = latencies[latencies.size() / 2];
+            auto p99 = latencies[latencies.size() * 99 / 100];
+            auto qps = latencies.size() * 1000000.0 / totalTime;
+
+            ASSERT_EQ(0, failures.load());
+            nd4j_printf("Batching: %i; clients: %i; QPS: %f; p50: %lld us; p99: %lld us;\n", batching, numClients, qps, p50, p99);
+        }
+
+        if (batching > 0)
+            ASSERT_EQ(15 * numRequests, GraphHolder::getInstance()->numberOfBatchedRequests(11990L));
+
+        GraphHolder::getInstance()->dropGraphAny(11990L);
+    }
+}
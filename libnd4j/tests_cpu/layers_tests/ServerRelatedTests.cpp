@@ -22,6 +22,9 @@
 #include <GraphExecutioner.h>
 #include <graph/GraphHolder.h>
 #include <graph/InferenceRequest.h>
+#include <ops/declarable/CustomOperations.h>
+#include <thread>
+#include <atomic>
 
 using namespace nd4j;
 using namespace nd4j::graph;
@@ -183,4 +186,296 @@ TEST_F(ServerRelatedTests, BasicExecutionTests_3) {
     ASSERT_EQ(exp, *restored.at(0)->getNDArray());
 
     GraphHolder::getInstance()->dropGraphAny(11903L);
-}
\ No newline at end of file
+}
+
+// cos(abs(x)), every row is processed independently
+static Graph<float>* rowwiseGraph() {
+    auto graph = new Graph<float>();
+
+    graph->getVariableSpace()->putVariable(-1, new NDArray<float>('c', {1, 3}));
+
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 0, 1, {-1}, {2}));
+    graph->addNode(new Node<float>(OpType_TRANSFORM, 2, 2, {1}, {}));
+
+    return graph;
+}
+
+static void executeRowwise(Nd4jLong graphId, NDArray<float> &input, NDArray<float> &output) {
+    flatbuffers::FlatBufferBuilder builder(4096);
+    flatbuffers::FlatBufferBuilder otherBuilder(4096);
+
+    InferenceRequest<float> ir(graphId);
+    ir.appendVariable(-1, 0, &input);
+
+    auto af = ir.asFlatInferenceRequest(otherBuilder);
+    otherBuilder.Finish(af);
+    auto fir = GetFlatInferenceRequest(otherBuilder.GetBufferPointer());
+
+    auto flatResult = GraphHolder::getInstance()->execute(graphId, builder, fir);
+    builder.Finish(flatResult);
+
+    ExecutionResult<float> restored(GetFlatResult(builder.GetBufferPointer()));
+    output.assign(restored.at(0)->getNDArray());
+}
+
+TEST_F(ServerRelatedTests, Test_Sessions_1) {
+    Environment::getInstance()->setDebug(false);
+    Environment::getInstance()->setVerbose(false);
+
+    GraphHolder::getInstance()->registerGraph<float>(11904L, rowwiseGraph());
+
+    const int numThreads = 4;
+    std::vector<std::thread> threads;
+    std::atomic<int> failures(0);
+
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back(std::thread([&failures, t] {
+            for (int i = 0; i < 10; i++) {
+                NDArray<float> input('c', {2, 3});
+                NDArray<float> output('c', {2, 3});
+                input.linspace(t * 10 + i);
+
+                NDArray<float> exp('c', {2, 3});
+                input.template applyTransform<simdOps::Abs<float>>(&exp);
+                exp.template applyTransform<simdOps::Cosine<float>>();
+
+                executeRowwise(11904L, input, output);
+
+                if (!exp.equalsTo(&output))
+                    failures++;
+            }
+        }));
+    }
+
+    for (auto &t: threads)
+        t.join();
+
+    ASSERT_EQ(0, failures.load());
+
+    // contexts are pooled, so there's at most one per concurrent request
+    auto numSessions = GraphHolder::getInstance()->numberOfSessions(11904L);
+    ASSERT_TRUE(numSessions >= 1 && numSessions <= numThreads);
+
+    GraphHolder::getInstance()->dropGraphAny(11904L);
+}
+
+TEST_F(ServerRelatedTests, Test_Sessions_2) {
+    Environment::getInstance()->setDebug(false);
+    Environment::getInstance()->setVerbose(false);
+
+    auto graph = rowwiseGraph();
+
+    NDArray<float> x('c', {1, 3}, {-1.f, 2.f, -3.f});
+    NDArray<float> y('c', {1, 3}, {4.f, -5.f, 6.f});
+    NDArray<float> expX('c', {1, 3});
+    NDArray<float> expY('c', {1, 3});
+    x.template applyTransform<simdOps::Abs<float>>(&expX);
+    expX.template applyTransform<simdOps::Cosine<float>>();
+    y.template applyTransform<simdOps::Abs<float>>(&expY);
+    expY.template applyTransform<simdOps::Cosine<float>>();
+
+    {
+        GraphSessions<float> sessions(graph);
+
+        ASSERT_TRUE(graph->isFrozen());
+        ASSERT_TRUE(sessions.isShared());
+
+        auto a = sessions.acquire();
+        auto b = sessions.acquire();
+
+        // contexts borrow nodes of registered graph, but not its state
+        ASSERT_NE(a, b);
+        ASSERT_EQ(graph->getMapped(), a->getMapped());
+        ASSERT_EQ(graph->getMapped(), b->getMapped());
+        ASSERT_NE(a->getVariableSpace(), b->getVariableSpace());
+
+        a->getVariableSpace()->replaceVariable(new Variable<float>(x.dup(), nullptr, -1, 0));
+        b->getVariableSpace()->replaceVariable(new Variable<float>(y.dup(), nullptr, -1, 0));
+
+        ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(a));
+        ASSERT_EQ(ND4J_STATUS_OK, GraphExecutioner<float>::execute(b));
+
+        ASSERT_TRUE(expX.equalsTo(a->getVariableSpace()->getVariable(2)->getNDArray()));
+        ASSERT_TRUE(expY.equalsTo(b->getVariableSpace()->getVariable(2)->getNDArray()));
+
+        // results never reach registered graph
+        ASSERT_FALSE(graph->getVariableSpace()->getVariable(2)->hasNDArray());
+
+        // released context is reused for next request, without results of previous one
+        sessions.release(a);
+        auto c = sessions.acquire();
+
+        ASSERT_EQ(a, c);
+        ASSERT_FALSE(c->getVariableSpace()->hasVariable(2));
+        ASSERT_EQ(2, sessions.numberOfSessions());
+
+        sessions.release(b);
+        sessions.release(c);
+    }
+
+    delete graph;
+}
+
+TEST_F(ServerRelatedTests, Test_Batching_1) {
+    Environment::getInstance()->setDebug(false);
+    Environment::getInstance()->setVerbose(false);
+
+    GraphHolder::getInstance()->registerGraph<float>(11905L, rowwiseGraph());
+    // max batch size is exactly 1 + 2 + 3 + 4 rows of all requests, and delay is long enough for all of them to arrive
+    GraphHolder::getInstance()->enableBatching(11905L, 10, 60000000L);
+
+    ASSERT_TRUE(GraphHolder::getInstance()->isBatching(11905L));
+
+    // requests have different number of rows, but results must be split back properly
+    const int numThreads = 4;
+    std::vector<std::thread> threads;
+    std::atomic<int> failures(0);
+
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back(std::thread([&failures, t] {
+            NDArray<float> input('c', {t + 1, 3});
+            NDArray<float> output('c', {t + 1, 3});
+            input.linspace(-t * 3.f);
+
+            NDArray<float> exp('c', {t + 1, 3});
+            input.template applyTransform<simdOps::Abs<float>>(&exp);
+            exp.template applyTransform<simdOps::Cosine<float>>();
+
+            executeRowwise(11905L, input, output);
+
+            if (!exp.equalsTo(&output))
+                failures++;
+        }));
+    }
+
+    for (auto &t: threads)
+        t.join();
+
+    ASSERT_EQ(0, failures.load());
+
+    // leader waits until batch is full, so every request is served once, as part of single batch
+    ASSERT_EQ(numThreads, GraphHolder::getInstance()->numberOfBatchedRequests(11905L));
+    ASSERT_EQ(1, GraphHolder::getInstance()->numberOfBatches(11905L));
+
+    GraphHolder::getInstance()->dropGraphAny(11905L);
+    ASSERT_FALSE(GraphHolder::getInstance()->isBatching(11905L));
+}
+
+TEST_F(ServerRelatedTests, Test_Batching_2) {
+    Environment::getInstance()->setDebug(false);
+    Environment::getInstance()->setVerbose(false);
+
+    // x + y, where y has fixed shape, so merged batch of 2+ rows can't be executed
+    auto graph = new Graph<float>();
+    graph->getVariableSpace()->putVariable(-1, new NDArray<float>('c', {1, 3}));
+    graph->getVariableSpace()->putVariable(-2, new NDArray<float>('c', {1, 3}, {1.f, 2.f, 3.f}));
+    graph->addNode(new Node<float>(OpType_PAIRWISE, 0, 1, {-1, -2}, {}));
+
+    GraphHolder::getInstance()->registerGraph<float>(11906L, graph);
+    GraphHolder::getInstance()->enableBatching(11906L, 8, 20000L);
+
+    // failed batch must wake up all of its requests, and give context back to the pool
+    const int numThreads = 4;
+    std::vector<std::thread> threads;
+    std::atomic<int> failures(0);
+
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back(std::thread([&failures] {
+            NDArray<float> input('c', {2, 3});
+            NDArray<float> output('c', {2, 3});
+
+            try {
+                executeRowwise(11906L, input, output);
+            } catch (std::exception &) {
+                failures++;
+            }
+        }));
+    }
+
+    for (auto &t: threads)
+        t.join();
+
+    ASSERT_EQ(numThreads, failures.load());
+    ASSERT_EQ(0, GraphHolder::getInstance()->numberOfBatches(11906L));
+
+    // graph is still usable afterwards
+    NDArray<float> input('c', {1, 3}, {1.f, 1.f, 1.f});
+    NDArray<float> output('c', {1, 3});
+    NDArray<float> exp('c', {1, 3}, {2.f, 3.f, 4.f});
+
+    executeRowwise(11906L, input, output);
+    ASSERT_EQ(exp, output);
+    ASSERT_TRUE(GraphHolder::getInstance()->numberOfSessions(11906L) <= numThreads);
+
+    GraphHolder::getInstance()->dropGraphAny(11906L);
+}
+
+// sends ids as INT64 input -2, with shape [ids, 1]
+static void executeIndices(Nd4jLong graphId, const std::vector<int64_t> &ids, std::vector<float> &output) {
+    flatbuffers::FlatBufferBuilder builder(4096);
+    flatbuffers::FlatBufferBuilder otherBuilder(4096);
+
+    NDArray<float> shapeHolder('c', {(Nd4jLong) ids.size(), 1});
+    std::vector<int8_t> vec(ids.size() * sizeof(int64_t));
+    memcpy(vec.data(), ids.data(), vec.size());
+
+    auto fShape = otherBuilder.CreateVector(shapeHolder.getShapeInfoAsFlatVector());
+    auto fBuffer = otherBuilder.CreateVector(vec);
+    auto fVid = CreateIntPair(otherBuilder, -2, 0);
+    auto fArray = CreateFlatArray(otherBuilder, fShape, fBuffer, nd4j::graph::DataType::DataType_INT64);
+    std::vector<flatbuffers::Offset<FlatVariable>> vars = {CreateFlatVariable(otherBuilder, fVid, 0, 0, fArray)};
+
+    auto af = CreateFlatInferenceRequest(otherBuilder, graphId, otherBuilder.CreateVector(vars), 0);
+    otherBuilder.Finish(af);
+    auto fir = GetFlatInferenceRequest(otherBuilder.GetBufferPointer());
+
+    auto flatResult = GraphHolder::getInstance()->execute(graphId, builder, fir);
+    builder.Finish(flatResult);
+
+    ExecutionResult<float> restored(GetFlatResult(builder.GetBufferPointer()));
+    auto z = restored.at(0)->getNDArray();
+    for (int e = 0; e < z->lengthOf(); e++)
+        output.emplace_back(z->getScalar(e));
+}
+
+TEST_F(ServerRelatedTests, Test_Batching_3) {
+    Environment::getInstance()->setDebug(false);
+    Environment::getInstance()->setVerbose(false);
+
+    // gather from [2^24 + 2, 1] table: 2^24 + 1 becomes 2^24 once converted to float
+    const Nd4jLong rows = 16777218L;
+    auto params = new NDArray<float>('c', {rows, 1});
+    auto buffer = params->getBuffer();
+    for (Nd4jLong e = 0; e < rows; e++)
+        buffer[e] = (float) (e % 7);
+
+    auto graph = new Graph<float>();
+    graph->getVariableSpace()->putVariable(-1, params);
+    graph->getVariableSpace()->putVariable(-2, new NDArray<float>('c', {1, 1}));
+
+    auto node = new Node<float>(OpType_CUSTOM, 0, 1, {-1, -2});
+    node->markInplace(false);
+    node->setCustomOp(nd4j::ops::OpRegistrator::getInstance()->getOperationFloat("gather"));
+    graph->addNode(node);
+
+    // both requests go into single batch of 3 rows
+    GraphHolder::getInstance()->registerGraph<float>(11907L, graph);
+    GraphHolder::getInstance()->enableBatching(11907L, 3, 60000000L);
+
+    std::vector<float> outputA;
+    std::vector<float> outputB;
+    std::thread threadA([&outputA] { executeIndices(11907L, {16777217L}, outputA); });
+    std::thread threadB([&outputB] { executeIndices(11907L, {16777217L, 3L}, outputB); });
+
+    threadA.join();
+    threadB.join();
+
+    ASSERT_EQ(1, GraphHolder::getInstance()->numberOfBatches(11907L));
+    ASSERT_EQ(2, GraphHolder::getInstance()->numberOfBatchedRequests(11907L));
+
+    // 2^24 + 1 = 2 (mod 7), while 2^24 = 1 (mod 7)
+    ASSERT_EQ(std::vector<float>({2.f}), outputA);
+    ASSERT_EQ(std::vector<float>({2.f, 3.f}), outputB);
+
+    GraphHolder::getInstance()->dropGraphAny(11907L);
+}
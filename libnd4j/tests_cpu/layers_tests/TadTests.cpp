@@ -23,6 +23,7 @@
 
 #include "testlayers.h"
 #include <NDArray.h>
+#include <helpers/TadCache.h>
 
 using namespace nd4j;
 
@@ -159,6 +160,31 @@ TEST_F(TadTests, TadEdgeCase_2) {
     delete tad;
 }
 
+TEST_F(TadTests, TadCache_1) {
+    NDArray<float> array('c', {3, 5, 7});
+    std::vector<int> dimensions = {0, 2};
+
+    auto cache = TadCache::getInstance();
+    auto misses = cache->misses();
+    auto hits = cache->hits();
+
+    auto packA = cache->tadForDimensions(array.getShapeInfo(), dimensions);
+    auto packB = cache->tadForDimensions(array.getShapeInfo(), dimensions);
+
+    ASSERT_EQ(misses + 1, cache->misses());
+    ASSERT_EQ(hits + 1, cache->hits());
+    ASSERT_TRUE(packA.get() == packB.get());
+
+    shape::TAD tad(array.getShapeInfo(), dimensions.data(), dimensions.size());
+    tad.createTadOnlyShapeInfo();
+    tad.createOffsets();
+
+    ASSERT_EQ(tad.numTads, packA->numberOfTads());
+    ASSERT_TRUE(shape::equalsStrict(tad.tadOnlyShapeInfo, packA->tadShapeInfo()));
+    for (int e = 0; e < tad.numTads; e++)
+        ASSERT_EQ(tad.tadOffsets[e], packA->tadOffsets()[e]);
+}
+
 /*
  // FIXME: we want this test passing eventually
 TEST_F(TadTests, Tad_1D_1) {
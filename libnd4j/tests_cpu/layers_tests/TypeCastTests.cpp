@@ -63,4 +63,71 @@ TEST_F(TypeCastTests, Test_ConvertDtype_1) {
 
     for (int e = 0; e < 5; e++)
         ASSERT_NEAR(exp[e], dst[e], (float16) 0.01f);
-}
\ No newline at end of file
+}
+
+TEST_F(TypeCastTests, Test_ThresholdV2_1) {
+    const Nd4jLong length = 100000;
+    const Nd4jLong limit = 1000;
+    std::vector<float> x(length, 0.1f);
+    std::vector<float> z(length, 0.0f);
+
+    // hits are spread over the whole array, with both signs
+    for (Nd4jLong e = 0; e < length; e += 997)
+        x[e] = (e / 997) % 2 == 0 ? 1.5f : -1.5f;
+
+    std::vector<int8_t> encoded(TypeCast::estimateThresholdV2Size(limit));
+    auto header = reinterpret_cast<Nd4jLong *>(encoded.data());
+    FloatBits fb;
+    fb.f_ = 1.0f;
+    header[0] = limit;
+    reinterpret_cast<int *>(header)[4] = fb.i_;
+
+    NativeOps ops;
+    ops.convertTypes(nullptr, ND4J_FLOAT32, x.data(), length, ND4J_THRESHOLD_V2, encoded.data());
+
+    Nd4jLong hits = (length + 996) / 997;
+    ASSERT_EQ(length, header[1]);
+    ASSERT_EQ(hits, header[3]);
+
+    // deltas fit into 2 bytes here, raw ints would take 4
+    ASSERT_TRUE(header[5] <= hits * 2);
+    ASSERT_TRUE(TypeCast::thresholdV2Length(encoded.data()) < TypeCast::estimateThresholdV2Size(limit));
+
+    ops.convertTypes(nullptr, ND4J_THRESHOLD_V2, encoded.data(), length, ND4J_FLOAT32, z.data());
+
+    for (Nd4jLong e = 0; e < length; e++) {
+        if (e % 997 == 0) {
+            auto sign = (e / 997) % 2 == 0 ? 1.0f : -1.0f;
+            ASSERT_NEAR(sign * 0.5f, x[e], 1e-5f);
+            ASSERT_NEAR(sign, z[e], 1e-5f);
+        } else {
+            ASSERT_NEAR(0.1f, x[e], 1e-5f);
+            ASSERT_NEAR(0.0f, z[e], 1e-5f);
+        }
+    }
+}
+
+TEST_F(TypeCastTests, Test_ThresholdV2_2) {
+    const Nd4jLong length = 50000;
+    const Nd4jLong limit = 3;
+    std::vector<double> x(length, 2.0);
+    std::vector<double> z(length, 0.0);
+
+    std::vector<int8_t> encoded(TypeCast::estimateThresholdV2Size(limit));
+    auto header = reinterpret_cast<Nd4jLong *>(encoded.data());
+    FloatBits fb;
+    fb.f_ = 0.5f;
+    header[0] = limit;
+    reinterpret_cast<int *>(header)[4] = fb.i_;
+
+    TypeCast::convertToThresholdV2<double>(nullptr, x.data(), length, encoded.data());
+    ASSERT_EQ(limit, header[3]);
+
+    // limit is honored in index order, everything else stays untouched for the next round
+    for (Nd4jLong e = 0; e < length; e++)
+        ASSERT_NEAR(e < limit ? 1.5 : 2.0, x[e], 1e-5);
+
+    TypeCast::convertFromThresholdV2<double>(nullptr, encoded.data(), length, z.data());
+    for (Nd4jLong e = 0; e < length; e++)
+        ASSERT_NEAR(e < limit ? 0.5 : 0.0, z[e], 1e-5);
+}
@@ -215,4 +215,43 @@ TEST_F(VariableSpaceTest, Test_DType_Conversion_1) {
 
     delete sd;
     delete sf;
-}
\ No newline at end of file
+}
+
+TEST_F(VariableSpaceTest, Test_Slots_1) {
+    VariableSpace<float> space;
+
+    std::pair<int, int> pairA(2, 0);
+    std::pair<int, int> pairB(2, 1);
+    std::pair<int, int> pairC(-1, 0);
+
+    auto slotA = space.registerSlot(pairA);
+    auto slotB = space.registerSlot(pairB);
+    auto slotC = space.registerSlot(pairC);
+
+    ASSERT_EQ(slotA, space.registerSlot(pairA));
+    ASSERT_EQ(3, space.numberOfSlots());
+
+    // nothing stored yet
+    ASSERT_TRUE(space.getSlotVariable(slotA, pairA) == nullptr);
+
+    space.putVariable(-1, new NDArray<float>('c', {2, 2}));
+    space.putVariable(pairA, new NDArray<float>('c', {3, 3}));
+
+    ASSERT_TRUE(space.getVariable(pairA) == space.getSlotVariable(slotA, pairA));
+    ASSERT_TRUE(space.getVariable(pairC) == space.getSlotVariable(slotC, pairC));
+    ASSERT_TRUE(space.getSlotVariable(slotB, pairB) == nullptr);
+
+    // slot should follow replaced variable
+    auto replacement = new Variable<float>(new NDArray<float>('c', {4, 4}), nullptr, 2, 0);
+    space.putVariable(pairA, replacement);
+    ASSERT_TRUE(replacement == space.getSlotVariable(slotA, pairA));
+
+    // mismatched address never resolves through slot
+    ASSERT_TRUE(space.getSlotVariable(slotA, pairB) == nullptr);
+
+    auto clone = space.clone();
+    ASSERT_EQ(3, clone->numberOfSlots());
+    ASSERT_TRUE(clone->getVariable(pairA) == clone->getSlotVariable(slotA, pairA));
+
+    delete clone;
+}
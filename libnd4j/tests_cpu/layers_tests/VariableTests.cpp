@@ -24,6 +24,8 @@
 #include "testlayers.h"
 #include <NDArray.h>
 #include <graph/Variable.h>
+#include <graph/Context.h>
+#include <ops/declarable/CustomOperations.h>
 #include <flatbuffers/flatbuffers.h>
 
 using namespace nd4j;
@@ -199,6 +201,84 @@ TEST_F(VariableTests, Test_FlatVariableDataType_4) {
     delete rv;
 }
 
+TEST_F(VariableTests, Test_FlatVariableDataType_5) {
+    flatbuffers::FlatBufferBuilder builder(1024);
+    NDArray<float16> shapeHolder('c', {1, 2});
+
+    // 2049 can't be represented by float16, so it has to survive as integer
+    std::vector<int64_t> indices = {2049, 1};
+    std::vector<int8_t> vec(indices.size() * sizeof(int64_t));
+    memcpy(vec.data(), indices.data(), vec.size());
+
+    auto fShape = builder.CreateVector(shapeHolder.getShapeInfoAsFlatVector());
+    auto fBuffer = builder.CreateVector(vec);
+    auto fVid = CreateIntPair(builder, -2, 0);
+
+    auto fArray = CreateFlatArray(builder, fShape, fBuffer, nd4j::graph::DataType::DataType_INT64);
+
+    auto flatVar = CreateFlatVariable(builder, fVid, 0, 0, fArray);
+
+    builder.Finish(flatVar);
+
+    auto restoredVar = GetFlatVariable(builder.GetBufferPointer());
+
+    auto rv = new Variable<float16>(restoredVar);
+
+    ASSERT_TRUE(rv->hasIndexArray());
+    ASSERT_EQ(2049, (*rv->getIndexArray())(0));
+    ASSERT_EQ(1, (*rv->getIndexArray())(1));
+
+    auto input = new NDArray<float16>('c', {2050});
+    for (int e = 0; e < input->lengthOf(); e++)
+        input->putScalar(e, (float16) (e % 7));
+
+    VariableSpace<float16> variableSpace;
+    variableSpace.putVariable(-1, input);
+    variableSpace.putVariable(-2, rv);
+
+    auto nodeVar = new Variable<float16>();
+    variableSpace.putVariable(1, nodeVar);
+
+    Context<float16> block(1, &variableSpace);
+    block.fillInputs({-1, -2});
+    block.getIArguments()->push_back(0);
+
+    nd4j::ops::gather<float16> op;
+    ASSERT_EQ(ND4J_STATUS_OK, op.execute(&block));
+
+    auto z = nodeVar->getNDArray();
+    NDArray<float16> exp('c', {2}, {5.f, 1.f});
+
+    ASSERT_TRUE(exp.isSameShape(z));
+    ASSERT_TRUE(exp.equalsTo(z));
+}
+
+TEST_F(VariableTests, Test_FlatVariableDataType_6) {
+    // 2^24 + 1 can't be represented by float, segment ids have to be read from IndexArray
+    auto rv = new Variable<float>(new NDArray<float>('c', {2}, {16777217.f, 16777216.f}), nullptr, -2);
+    rv->setIndexArray(std::make_shared<IndexArray>(std::vector<Nd4jLong>({2}), std::vector<Nd4jLong>({16777217L, 16777216L})));
+
+    VariableSpace<float> variableSpace;
+    variableSpace.putVariable(-1, new NDArray<float>('c', {2}, {3.f, 5.f}));
+    variableSpace.putVariable(-2, rv);
+
+    auto nodeVar = new Variable<float>();
+    variableSpace.putVariable(1, nodeVar);
+
+    Context<float> block(1, &variableSpace);
+    block.fillInputs({-1, -2});
+    block.getIArguments()->push_back(16777218);
+
+    nd4j::ops::unsorted_segment_sum<float> op;
+    ASSERT_EQ(ND4J_STATUS_OK, op.execute(&block));
+
+    auto z = nodeVar->getNDArray();
+
+    ASSERT_EQ(16777218, z->lengthOf());
+    ASSERT_NEAR(5.f, z->getScalar(16777216), 1e-5f);
+    ASSERT_NEAR(3.f, z->getScalar(16777217), 1e-5f);
+}
+
 TEST_F(VariableTests, Test_Dtype_Conversion_1) {
     auto x = new NDArray<float>('c', {2, 3}, {1, 2, 3, 4, 5, 6});
     Variable<float> v(x, "alpha", 12, 3);
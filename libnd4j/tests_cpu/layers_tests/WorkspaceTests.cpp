@@ -243,6 +243,53 @@ TEST_F(WorkspaceTests, Test_Externalized_1) {
     ASSERT_NEAR(2.0f, m, 1e-5);
 }
 
+TEST_F(WorkspaceTests, Test_Alignment_1) {
+    Workspace ws(1024);
+
+    auto ptrA = ws.allocateBytes(3);
+    auto ptrB = ws.allocateBytes(7);
+
+    ASSERT_EQ(0, ((Nd4jLong) ptrB - (Nd4jLong) ptrA) % Workspace::ALIGNMENT);
+    ASSERT_EQ(2 * Workspace::ALIGNMENT, ws.getCurrentOffset());
+}
+
+TEST_F(WorkspaceTests, Test_Learning_1) {
+    Workspace ws(256);
+
+    for (int e = 0; e < 3; e++) {
+        ws.scopeIn();
+
+        #pragma omp parallel for schedule(static)
+        for (int i = 0; i < 16; i++)
+            ws.allocateBytes(64);
+
+        if (e == 0)
+            ASSERT_EQ(768, ws.getSpilledSize());
+        else
+            ASSERT_EQ(0, ws.getSpilledSize());
+
+        ASSERT_EQ(e == 0 ? 256 : 1024, ws.getCurrentOffset());
+
+        ws.scopeOut();
+
+        ASSERT_EQ(1024, ws.getCurrentSize());
+        ASSERT_EQ(0, ws.getSpilledSize());
+    }
+}
+
+TEST_F(WorkspaceTests, Test_Learning_2) {
+    Workspace ws(256);
+    ws.setLearning(false);
+
+    ws.scopeIn();
+    ws.allocateBytes(1024);
+    ws.scopeOut();
+
+    ws.scopeIn();
+    ASSERT_EQ(256, ws.getCurrentSize());
+    ASSERT_EQ(0, ws.getSpilledSize());
+}
+
 // TODO: uncomment this test once long shapes are introduced
 /*
 TEST_F(WorkspaceTests, Test_Big_Allocation_1) {
@@ -1682,6 +1682,10 @@ public abstract class NativeOps extends Pointer {
     public abstract int registerGraphDouble(PointerPointer extraPointers, long graphId, Pointer flatBufferPointer);
     public abstract int registerGraphHalf(PointerPointer extraPointers, long graphId, Pointer flatBufferPointer);
 
+    public abstract int registerGraphFromFileFloat(PointerPointer extraPointers, long graphId, String fileName);
+    public abstract int registerGraphFromFileDouble(PointerPointer extraPointers, long graphId, String fileName);
+    public abstract int registerGraphFromFileHalf(PointerPointer extraPointers, long graphId, String fileName);
+
     public abstract Pointer executeStoredGraphFloat(PointerPointer extraPointers, long graphId, PointerPointer inputBuffers, PointerPointer inputShapes, IntPointer inputIndices, int numInputs);
     public abstract Pointer executeStoredGraphDouble(PointerPointer extraPointers, long graphId, PointerPointer inputBuffers, PointerPointer inputShapes, IntPointer inputIndices, int numInputs);
     public abstract Pointer executeStoredGraphHalf(PointerPointer extraPointers, long graphId, PointerPointer inputBuffers, PointerPointer inputShapes, IntPointer inputIndices, int numInputs);